@@ -0,0 +1,323 @@
+#include "bench.h"
+
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+
+#include "basic_types_serialize.h"
+#include "scheme_atomic_swap_alice.h"
+#include "scheme_atomic_swap_bob.h"
+#include "scheme_atomic_swap_serialize.h"
+#include "scheme_atomic_swap_vc_alice.h"
+#include "scheme_atomic_swap_vc_bob.h"
+#include "scheme_atomic_swap_vc_serialize.h"
+#include "scheme_complaint_alice.h"
+#include "scheme_complaint_bob.h"
+#include "scheme_complaint_serialize.h"
+#include "scheme_ot_complaint_alice.h"
+#include "scheme_ot_complaint_bob.h"
+#include "scheme_ot_complaint_serialize.h"
+#include "scheme_ot_vrfq_alice.h"
+#include "scheme_ot_vrfq_bob.h"
+#include "scheme_ot_vrfq_serialize.h"
+#include "scheme_plain_alice_data.h"
+#include "scheme_plain_bob_data.h"
+#include "scheme_table_alice_data.h"
+#include "scheme_table_bob_data.h"
+#include "scheme_vrfq_alice.h"
+#include "scheme_vrfq_bob.h"
+#include "scheme_vrfq_serialize.h"
+
+namespace {
+const h256_t kDummyAliceId = h256_t{{1}};
+const h256_t kDummyBobId = h256_t{{2}};
+
+template <typename T>
+uint64_t WireSize(T const& t) {
+  yas::mem_ostream os;
+  yas::binary_oarchive<yas::mem_ostream, YasBinF()> oa(os);
+  oa.serialize(t);
+  return os.get_intrusive_buffer().size;
+}
+
+// f returns the wire bytes of the phase, or -1 if it failed
+template <typename F>
+bool Phase(std::vector<PhaseStat>& stats, char const* name, F f) {
+  Meter meter;
+  int64_t bytes = f();
+  if (bytes < 0) {
+    std::cerr << "phase " << name << " failed\n";
+    return false;
+  }
+  stats.push_back(meter.Stop(name, (uint64_t)bytes));
+  return true;
+}
+
+template <typename NegoARequest, typename NegoAResponse, typename NegoBRequest,
+          typename NegoBResponse, typename Alice, typename Bob>
+bool Nego(Alice& alice, Bob& bob, std::vector<PhaseStat>& stats) {
+  NegoBRequest b_nego_request;
+  NegoBResponse b_nego_response;
+  NegoARequest a_nego_request;
+  NegoAResponse a_nego_response;
+
+  return Phase(stats, "bob_get_nego_request",
+               [&]() -> int64_t {
+                 bob.GetNegoReqeust(b_nego_request);
+                 return WireSize(b_nego_request);
+               }) &&
+         Phase(stats, "alice_on_nego_request",
+               [&]() -> int64_t {
+                 if (!alice.OnNegoRequest(b_nego_request, b_nego_response))
+                   return -1;
+                 return WireSize(b_nego_response);
+               }) &&
+         Phase(stats, "bob_on_nego_response",
+               [&]() -> int64_t {
+                 return bob.OnNegoResponse(b_nego_response) ? 0 : -1;
+               }) &&
+         Phase(stats, "alice_get_nego_request",
+               [&]() -> int64_t {
+                 alice.GetNegoReqeust(a_nego_request);
+                 return WireSize(a_nego_request);
+               }) &&
+         Phase(stats, "bob_on_nego_request",
+               [&]() -> int64_t {
+                 if (!bob.OnNegoRequest(a_nego_request, a_nego_response))
+                   return -1;
+                 return WireSize(a_nego_response);
+               }) &&
+         Phase(stats, "alice_on_nego_response", [&]() -> int64_t {
+           return alice.OnNegoResponse(a_nego_response) ? 0 : -1;
+         });
+}
+
+// request, response, receipt and secret, on_secret differs by protocol
+template <typename Request, typename Response, typename Receipt,
+          typename Secret, typename Alice, typename Bob, typename OnSecret>
+bool Exchange(Alice& alice, Bob& bob, OnSecret on_secret,
+              std::vector<PhaseStat>& stats) {
+  Request request;
+  Response response;
+  Receipt receipt;
+  Secret secret;
+
+  return Phase(stats, "bob_get_request",
+               [&]() -> int64_t {
+                 bob.GetRequest(request);
+                 return WireSize(request);
+               }) &&
+         Phase(stats, "alice_on_request",
+               [&]() -> int64_t {
+                 if (!alice.OnRequest(request, response)) return -1;
+                 return WireSize(response);
+               }) &&
+         Phase(stats, "bob_on_response",
+               [&]() -> int64_t {
+                 if (!bob.OnResponse(std::move(response), receipt)) return -1;
+                 return WireSize(receipt);
+               }) &&
+         Phase(stats, "alice_on_receipt",
+               [&]() -> int64_t {
+                 if (!alice.OnReceipt(receipt, secret)) return -1;
+                 return WireSize(secret);
+               }) &&
+         Phase(stats, "bob_on_secret",
+               [&]() -> int64_t { return on_secret(secret) ? 0 : -1; });
+}
+
+template <typename Bob>
+bool SaveDecrypted(Bob& bob, std::string const& output_path,
+                   std::vector<PhaseStat>& stats) {
+  return Phase(stats, "bob_save_decrypted", [&]() -> int64_t {
+    return bob.SaveDecrypted(output_path + "/decrypted_data") ? 0 : -1;
+  });
+}
+
+template <typename AliceData, typename BobData>
+bool RunRange(std::string const& publish_path, std::string const& output_path,
+              BenchCase const& c, std::vector<PhaseStat>& stats) {
+  std::shared_ptr<AliceData> alice_data;
+  std::shared_ptr<BobData> bob_data;
+  if (!Phase(stats, "alice_data",
+             [&]() -> int64_t {
+               alice_data = std::make_shared<AliceData>(publish_path);
+               return 0;
+             }) ||
+      !Phase(stats, "bob_data", [&]() -> int64_t {
+        bob_data = std::make_shared<BobData>(publish_path + "/bulletin",
+                                             publish_path + "/public");
+        return 0;
+      })) {
+    return false;
+  }
+
+  uint64_t n = alice_data->bulletin().n;
+  std::vector<Range> demands{Range(0, std::min(c.demand, n))};
+
+  if (c.protocol == "complaint") {
+    using namespace scheme::complaint;
+    Alice<AliceData> alice(alice_data, kDummyAliceId, kDummyBobId);
+    Bob<BobData> bob(bob_data, kDummyBobId, kDummyAliceId, demands);
+    auto on_secret = [&bob](Secret const& secret) {
+      return bob.OnSecret(secret);
+    };
+    return Exchange<Request, Response, Receipt, Secret>(alice, bob, on_secret,
+                                                        stats) &&
+           SaveDecrypted(bob, output_path, stats);
+  }
+
+  if (c.protocol == "ot_complaint") {
+    using namespace scheme::ot_complaint;
+    // as many phantom rows again as demanded
+    std::vector<Range> phantoms{Range(0, std::min(c.demand * 2, n))};
+    Alice<AliceData> alice(alice_data, kDummyAliceId, kDummyBobId);
+    Bob<BobData> bob(bob_data, kDummyBobId, kDummyAliceId, demands, phantoms);
+    auto on_secret = [&bob](Secret const& secret) {
+      return bob.OnSecret(secret);
+    };
+    return Nego<NegoARequest, NegoAResponse, NegoBRequest, NegoBResponse>(
+               alice, bob, stats) &&
+           Exchange<Request, Response, Receipt, Secret>(alice, bob, on_secret,
+                                                        stats) &&
+           SaveDecrypted(bob, output_path, stats);
+  }
+
+  if (c.protocol == "atomic_swap") {
+    using namespace scheme::atomic_swap;
+    Alice<AliceData> alice(alice_data, kDummyAliceId, kDummyBobId);
+    Bob<BobData> bob(bob_data, kDummyBobId, kDummyAliceId, demands);
+    auto on_secret = [&bob](Secret const& secret) {
+      return bob.OnSecret(secret);
+    };
+    return Exchange<Request, Response, Receipt, Secret>(alice, bob, on_secret,
+                                                        stats) &&
+           SaveDecrypted(bob, output_path, stats);
+  }
+
+  if (c.protocol == "atomic_swap_vc") {
+    using namespace scheme::atomic_swap_vc;
+    Alice<AliceData> alice(alice_data, kDummyAliceId, kDummyBobId);
+    Bob<BobData> bob(bob_data, kDummyBobId, kDummyAliceId, demands);
+    auto on_secret = [&bob](Secret const& secret) {
+      return bob.OnSecret(secret);
+    };
+    return Exchange<Request, Response, Receipt, Secret>(alice, bob, on_secret,
+                                                        stats) &&
+           SaveDecrypted(bob, output_path, stats);
+  }
+
+  std::cerr << "unknown protocol " << c.protocol << "\n";
+  return false;
+}
+
+bool RunQuery(std::string const& publish_path, BenchCase const& c,
+              std::vector<std::string> const& keys,
+              std::vector<PhaseStat>& stats) {
+  using scheme::table::AliceData;
+  using scheme::table::BobData;
+
+  std::shared_ptr<AliceData> alice_data;
+  std::shared_ptr<BobData> bob_data;
+  if (!Phase(stats, "alice_data",
+             [&]() -> int64_t {
+               alice_data = std::make_shared<AliceData>(publish_path);
+               return 0;
+             }) ||
+      !Phase(stats, "bob_data", [&]() -> int64_t {
+        bob_data = std::make_shared<BobData>(publish_path + "/bulletin",
+                                             publish_path + "/public");
+        return 0;
+      })) {
+    return false;
+  }
+
+  // the first demand keys are queried, the next ones are the phantoms
+  auto count = std::min<uint64_t>(c.demand, keys.size());
+  std::vector<std::string> values(keys.begin(), keys.begin() + count);
+  std::vector<std::vector<uint64_t>> positions;
+  auto on_secret = [&positions](auto& bob, auto const& secret) {
+    return bob.OnSecret(secret, positions);
+  };
+
+  if (c.protocol == "vrfq") {
+    using namespace scheme::table::vrfq;
+    Alice alice(alice_data, kDummyAliceId, kDummyBobId);
+    Bob bob(bob_data, kDummyBobId, kDummyAliceId, "key", values);
+    return Exchange<Request, Response, Receipt, Secret>(
+        alice, bob,
+        [&](Secret const& secret) { return on_secret(bob, secret); }, stats);
+  }
+
+  if (c.protocol == "ot_vrfq") {
+    using namespace scheme::table::ot_vrfq;
+    auto end = std::min<uint64_t>(count * 2, keys.size());
+    std::vector<std::string> phantoms(keys.begin() + count,
+                                      keys.begin() + end);
+    if (phantoms.empty()) phantoms.push_back("phantom");
+    Alice alice(alice_data, kDummyAliceId, kDummyBobId);
+    Bob bob(bob_data, kDummyBobId, kDummyAliceId, "key", values, phantoms);
+    return Nego<NegoARequest, NegoAResponse, NegoBRequest, NegoBResponse>(
+               alice, bob, stats) &&
+           Exchange<Request, Response, Receipt, Secret>(
+               alice, bob,
+               [&](Secret const& secret) { return on_secret(bob, secret); },
+               stats);
+  }
+
+  std::cerr << "unknown protocol " << c.protocol << "\n";
+  return false;
+}
+}  // namespace
+
+bool RunCase(std::string const& publish_path, std::string const& output_path,
+             std::vector<std::string> const& keys, BenchResult& result) {
+  auto const& c = result.bench_case;
+  result.phases.clear();
+  try {
+    if (c.protocol == "vrfq" || c.protocol == "ot_vrfq") {
+      if (!c.table) return false;
+      result.success = RunQuery(publish_path, c, keys, result.phases);
+    } else if (c.table) {
+      result.success =
+          RunRange<scheme::table::AliceData, scheme::table::BobData>(
+              publish_path, output_path, c, result.phases);
+    } else {
+      result.success =
+          RunRange<scheme::plain::AliceData, scheme::plain::BobData>(
+              publish_path, output_path, c, result.phases);
+    }
+  } catch (std::exception& e) {
+    std::cerr << __FUNCTION__ << "\t" << e.what() << "\n";
+    result.success = false;
+  }
+  return result.success;
+}
+
+bool SaveResults(std::string const& file, std::vector<BenchResult> const& v) {
+  std::ofstream os(file);
+  os << std::fixed << std::setprecision(3);
+  os << "[\n";
+  for (size_t i = 0; i < v.size(); ++i) {
+    auto const& c = v[i].bench_case;
+    os << "  {\"mode\": \"" << (c.table ? "table" : "plain")
+       << "\", \"protocol\": \"" << c.protocol << "\", \"n\": " << c.n
+       << ", \"s\": " << c.s << ", \"demand\": " << c.demand
+       << ", \"success\": " << (v[i].success ? "true" : "false")
+       << ", \"phases\": [";
+    auto const& phases = v[i].phases;
+    for (size_t j = 0; j < phases.size(); ++j) {
+      auto const& p = phases[j];
+      os << (j ? ",\n" : "\n") << "    {\"name\": \"" << p.name
+         << "\", \"wall_ms\": " << p.wall_ms << ", \"cpu_ms\": " << p.cpu_ms
+         << ", \"peak_rss_kb\": " << p.peak_rss_kb
+         << ", \"wire_bytes\": " << p.wire_bytes << "}";
+    }
+    os << (phases.empty() ? "]}" : "\n  ]}")
+       << (i + 1 < v.size() ? ",\n" : "\n");
+  }
+  os << "]\n";
+  return (bool)os;
+}
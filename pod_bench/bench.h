@@ -0,0 +1,27 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "meter.h"
+
+struct BenchCase {
+  bool table;
+  std::string protocol;  // complaint, ot_complaint, atomic_swap...
+  uint64_t n;            // rows of the generated data, table adds a pad row
+  uint64_t s;
+  uint64_t demand;  // rows for the range protocols, keys for vrfq
+};
+
+struct BenchResult {
+  BenchCase bench_case;
+  bool success = false;
+  std::vector<PhaseStat> phases;
+};
+
+// run every phase of one protocol against a published dataset, keys are the
+// table keys that vrfq can query
+bool RunCase(std::string const& publish_path, std::string const& output_path,
+             std::vector<std::string> const& keys, BenchResult& result);
+
+bool SaveResults(std::string const& file, std::vector<BenchResult> const& v);
@@ -0,0 +1,60 @@
+#include "dataset.h"
+
+#include <fstream>
+#include <iostream>
+
+#include "publish.h"
+
+namespace {
+std::string RandomString(uint64_t len, std::mt19937_64& rng) {
+  static char const kChars[] = "abcdefghijklmnopqrstuvwxyz0123456789";
+  std::uniform_int_distribution<int> dist(0, sizeof(kChars) - 2);
+  std::string s(len, '\0');
+  for (auto& c : s) c = kChars[dist(rng)];
+  return s;
+}
+}  // namespace
+
+bool MakePlainDataset(std::string const& output_path, uint64_t n, uint64_t s,
+                      std::mt19937_64& rng) {
+  if (s < 2) return false;
+  uint64_t column_num = s - 1;
+
+  std::string data_file = output_path + ".dat";
+  std::ofstream os(data_file, std::ios::binary);
+  std::uniform_int_distribution<int> dist(0, 255);
+  std::vector<char> block(column_num * 31);
+  for (uint64_t i = 0; i < n; ++i) {
+    for (auto& c : block) c = (char)dist(rng);
+    os.write(block.data(), block.size());
+  }
+  os.close();
+  if (!os) return false;
+
+  return PublishPlain(data_file, output_path, column_num);
+}
+
+bool MakeTableDataset(std::string const& output_path, uint64_t n, uint64_t s,
+                      std::mt19937_64& rng, std::vector<std::string>& keys) {
+  // s is the key count + 1 + the fr count of the longest record, and a
+  // record takes 4 bytes per column plus the values
+  if (s < 3) return false;
+  uint64_t record_size = (s - 2) * 31;
+
+  std::string data_file = output_path + ".csv";
+  std::ofstream os(data_file);
+  os << "key,payload\n";
+  keys.resize(n);
+  for (uint64_t i = 0; i < n; ++i) {
+    keys[i] = "k" + std::to_string(i);
+    auto used = 2 * sizeof(uint32_t) + keys[i].size();
+    auto payload = RandomString(record_size > used ? record_size - used : 1,
+                                rng);
+    os << keys[i] << "," << payload << "\n";
+  }
+  os.close();
+  if (!os) return false;
+
+  return PublishTable(data_file, output_path, scheme::table::Type::kCsv, {0},
+                      {false});
+}
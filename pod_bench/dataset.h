@@ -0,0 +1,17 @@
+#pragma once
+
+#include <stdint.h>
+
+#include <random>
+#include <string>
+#include <vector>
+
+// synthetic datasets published into output_path, the same seed gives the
+// same data
+bool MakePlainDataset(std::string const& output_path, uint64_t n, uint64_t s,
+                      std::mt19937_64& rng);
+
+// one unique key column and one payload column sized to get s, the keys
+// are returned for vrfq
+bool MakeTableDataset(std::string const& output_path, uint64_t n, uint64_t s,
+                      std::mt19937_64& rng, std::vector<std::string>& keys);
@@ -0,0 +1,167 @@
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <boost/filesystem.hpp>
+#include <boost/program_options.hpp>
+
+#include "bench.h"
+#include "capi/c_api.h"
+#include "dataset.h"
+
+#ifdef MULTICORE
+#include <omp.h>
+#endif
+
+namespace fs = boost::filesystem;
+
+namespace {
+bool IsQuery(std::string const& protocol) {
+  return protocol == "vrfq" || protocol == "ot_vrfq";
+}
+}  // namespace
+
+int main(int argc, char** argv) {
+  setlocale(LC_ALL, "");
+
+  namespace po = boost::program_options;
+
+  std::string data_dir;
+  std::string work_dir;
+  std::string output_file;
+  std::vector<std::string> modes;
+  std::vector<std::string> protocols;
+  std::vector<uint64_t> ns;
+  std::vector<uint64_t> ss;
+  std::vector<uint64_t> demands;
+  uint64_t seed;
+#ifdef MULTICORE
+  uint32_t omp_thread_num = 0;
+#endif
+
+  try {
+    po::options_description options("command line options");
+    options.add_options()("help,h", "Use -h or --help to list all arguments")(
+        "data_dir,d", po::value<std::string>(&data_dir)->default_value("."),
+        "Provide the configure file dir")(
+        "work_dir,w",
+        po::value<std::string>(&work_dir)->default_value("bench_data"),
+        "Provide the dir for the generated datasets")(
+        "output,o",
+        po::value<std::string>(&output_file)->default_value("pod_bench.json"),
+        "Provide the json result file")(
+        "mode,m",
+        po::value<std::vector<std::string>>(&modes)
+            ->multitoken()
+            ->default_value({"plain", "table"}, "plain table"),
+        "Provide pod modes (plain, table)")(
+        "protocol,a",
+        po::value<std::vector<std::string>>(&protocols)
+            ->multitoken()
+            ->default_value({"complaint", "ot_complaint", "atomic_swap",
+                             "atomic_swap_vc", "vrfq", "ot_vrfq"},
+                            "complaint ot_complaint atomic_swap "
+                            "atomic_swap_vc vrfq ot_vrfq"),
+        "Provide protocols, vrfq and ot_vrfq only run in table mode")(
+        "n", po::value<std::vector<uint64_t>>(&ns)
+                 ->multitoken()
+                 ->default_value({256, 1024}, "256 1024"),
+        "Provide the row counts")(
+        "s", po::value<std::vector<uint64_t>>(&ss)
+                 ->multitoken()
+                 ->default_value({16, 64}, "16 64"),
+        "Provide the column counts, table needs at least 3")(
+        "demand", po::value<std::vector<uint64_t>>(&demands)
+                      ->multitoken()
+                      ->default_value({1, 16}, "1 16"),
+        "Provide the demanded rows, or queried keys for vrfq")(
+        "seed", po::value<uint64_t>(&seed)->default_value(0),
+        "Provide the seed of the generated data")
+#ifdef MULTICORE
+        ("omp_thread_num", po::value<uint32_t>(&omp_thread_num),
+         "Provide the number of the parallel threads, 1: disable parallel, 0: "
+         "default.")
+#endif
+        ;
+
+    po::variables_map vmap;
+    po::store(po::parse_command_line(argc, argv, options), vmap);
+    po::notify(vmap);
+
+    if (vmap.count("help")) {
+      std::cerr << options << std::endl;
+      return -1;
+    }
+  } catch (std::exception& e) {
+    std::cerr << "Unknown parameters.\n"
+              << e.what() << "\n"
+              << "-h or --help to list all arguments.\n";
+    return -1;
+  }
+
+#ifdef MULTICORE
+  if (omp_thread_num) {
+    omp_set_num_threads(omp_thread_num);
+    SetParallelThreads(omp_thread_num);
+  }
+#endif
+
+  if (!E_InitAll(data_dir.c_str())) {
+    std::cerr << "Init failed\n";
+    return -1;
+  }
+
+  std::vector<BenchResult> results;
+  for (auto const& mode : modes) {
+    if (mode != "plain" && mode != "table") {
+      std::cerr << "Unknown mode " << mode << "\n";
+      return -1;
+    }
+    bool table = mode == "table";
+    for (auto n : ns) {
+      for (auto s : ss) {
+        std::string name = mode + "_" + std::to_string(n) + "_" +
+                           std::to_string(s);
+        std::string publish_path = work_dir + "/" + name;
+        fs::create_directories(publish_path);
+
+        // every dataset has its own stream so a subset of the grid gives
+        // the same data
+        std::seed_seq seq{seed, n, s, (uint64_t)table};
+        std::mt19937_64 rng(seq);
+        std::vector<std::string> keys;
+        bool ret = table ? MakeTableDataset(publish_path, n, s, rng, keys)
+                         : MakePlainDataset(publish_path, n, s, rng);
+        if (!ret) {
+          std::cerr << "Make dataset " << name << " failed\n";
+          continue;
+        }
+
+        for (auto const& protocol : protocols) {
+          if (IsQuery(protocol) && !table) continue;
+          for (auto demand : demands) {
+            if (!demand || demand > n) continue;
+            BenchResult result;
+            result.bench_case = BenchCase{table, protocol, n, s, demand};
+            std::string output_path = work_dir + "/output/" + name + "_" +
+                                      protocol + "_" + std::to_string(demand);
+            fs::create_directories(output_path);
+            if (!RunCase(publish_path, output_path, keys, result)) {
+              std::cerr << "Bench " << name << " " << protocol << " "
+                        << demand << " failed\n";
+            }
+            results.emplace_back(std::move(result));
+          }
+        }
+      }
+    }
+  }
+
+  if (!SaveResults(output_file, results)) {
+    std::cerr << "Save " << output_file << " failed\n";
+    return -1;
+  }
+  std::cout << "save results to " << output_file << "\n";
+  return 0;
+}
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <sys/resource.h>
+#include <time.h>
+
+#include <chrono>
+#include <string>
+
+struct PhaseStat {
+  std::string name;
+  double wall_ms = 0;
+  double cpu_ms = 0;         // all threads of the process, omp included
+  uint64_t peak_rss_kb = 0;  // high-water mark of the process so far
+  uint64_t wire_bytes = 0;   // binary size of the message the phase sent
+};
+
+class Meter {
+ public:
+  Meter() {
+    wall_start_ = std::chrono::steady_clock::now();
+    cpu_start_ = CpuMs();
+  }
+
+  PhaseStat Stop(std::string const& name, uint64_t wire_bytes) const {
+    PhaseStat stat;
+    stat.name = name;
+    auto t = std::chrono::steady_clock::now() - wall_start_;
+    stat.wall_ms =
+        std::chrono::duration_cast<std::chrono::microseconds>(t).count() /
+        1000.0;
+    stat.cpu_ms = CpuMs() - cpu_start_;
+    stat.peak_rss_kb = PeakRssKb();
+    stat.wire_bytes = wire_bytes;
+    return stat;
+  }
+
+  static double CpuMs() {
+    timespec ts;
+    clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &ts);
+    return ts.tv_sec * 1000.0 + ts.tv_nsec / 1000000.0;
+  }
+
+  static uint64_t PeakRssKb() {
+    rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+#ifdef __APPLE__
+    return usage.ru_maxrss / 1024;
+#else
+    return usage.ru_maxrss;
+#endif
+  }
+
+ private:
+  std::chrono::steady_clock::time_point wall_start_;
+  double cpu_start_;
+};
@@ -0,0 +1,149 @@
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <boost/program_options.hpp>
+
+#include "ecc.h"
+#include "ecc_pub.h"
+#include "primitives.h"
+
+namespace {
+struct MicroResult {
+  std::string name;
+  uint64_t size;
+  uint32_t threads;
+  std::vector<double> ms;  // one per repeat, sorted
+};
+
+bool SaveResults(std::string const& file, std::vector<MicroResult> const& v) {
+  std::ofstream os(file);
+  os << std::fixed << std::setprecision(3);
+  os << "[\n";
+  for (size_t i = 0; i < v.size(); ++i) {
+    auto const& r = v[i];
+    os << "  {\"name\": \"" << r.name << "\", \"size\": " << r.size
+       << ", \"threads\": " << r.threads << ", \"repeat\": " << r.ms.size()
+       << ", \"min_ms\": " << r.ms.front()
+       << ", \"median_ms\": " << r.ms[r.ms.size() / 2]
+       << ", \"max_ms\": " << r.ms.back() << "}"
+       << (i + 1 < v.size() ? ",\n" : "\n");
+  }
+  os << "]\n";
+  return (bool)os;
+}
+}  // namespace
+
+int main(int argc, char** argv) {
+  setlocale(LC_ALL, "");
+
+  namespace po = boost::program_options;
+
+  std::string data_dir;
+  std::string output_file;
+  std::vector<std::string> names;
+  std::vector<uint64_t> sizes;
+  std::vector<uint32_t> threads;
+  uint32_t repeat;
+  uint64_t seed;
+
+  try {
+    po::options_description options("command line options");
+    options.add_options()("help,h", "Use -h or --help to list all arguments")(
+        "data_dir,d", po::value<std::string>(&data_dir)->default_value("."),
+        "Provide the configure file dir")(
+        "output,o",
+        po::value<std::string>(&output_file)
+            ->default_value("pod_microbench.json"),
+        "Provide the json result file")(
+        "bench,b", po::value<std::vector<std::string>>(&names)->multitoken(),
+        "Provide the benchmarks to run, all if not given")(
+        "size", po::value<std::vector<uint64_t>>(&sizes)
+                    ->multitoken()
+                    ->default_value({1024, 16384}, "1024 16384"),
+        "Provide the input sizes")(
+        "threads", po::value<std::vector<uint32_t>>(&threads)
+                       ->multitoken()
+                       ->default_value({1}, "1"),
+        "Provide the thread counts")(
+        "repeat", po::value<uint32_t>(&repeat)->default_value(5),
+        "Provide the runs of every case")(
+        "seed", po::value<uint64_t>(&seed)->default_value(0),
+        "Provide the seed of the inputs")("list", "List the benchmarks");
+
+    po::variables_map vmap;
+    po::store(po::parse_command_line(argc, argv, options), vmap);
+    po::notify(vmap);
+
+    if (vmap.count("help")) {
+      std::cerr << options << std::endl;
+      return -1;
+    }
+
+    if (vmap.count("list")) {
+      for (auto const& i : GetMicroBenches()) std::cout << i.name << "\n";
+      return 0;
+    }
+  } catch (std::exception& e) {
+    std::cerr << "Unknown parameters.\n"
+              << e.what() << "\n"
+              << "-h or --help to list all arguments.\n";
+    return -1;
+  }
+
+  if (!repeat) repeat = 1;
+
+  // the pool is sized once, every count below runs under a concurrency limit
+  SetParallelThreads(*std::max_element(threads.begin(), threads.end()));
+
+  InitEcc();
+  auto ecc_pub_file = data_dir + "/" + "ecc_pub.bin";
+  if (!OpenOrCreateEccPub(ecc_pub_file)) {
+    std::cerr << "Open or create ecc pub file " << ecc_pub_file << " failed\n";
+    return -1;
+  }
+
+  h256_t seed_h;
+  seed_h.fill(0);
+  for (size_t i = 0; i < 8; ++i) seed_h[i] = (uint8_t)(seed >> (i * 8));
+
+  std::vector<MicroResult> results;
+  for (auto const& bench : GetMicroBenches()) {
+    if (!names.empty() &&
+        std::find(names.begin(), names.end(), bench.name) == names.end())
+      continue;
+    for (auto size : sizes) {
+      auto f = bench.setup(size, seed_h);
+      for (auto t : threads) {
+#ifndef MULTICORE
+        if (t != 1) continue;
+#endif
+        ConcurrencyScope scope(t ? t : 1);
+        MicroResult result{bench.name, size, t, {}};
+        for (uint32_t i = 0; i < repeat; ++i) {
+          auto start = std::chrono::steady_clock::now();
+          f();
+          auto d = std::chrono::steady_clock::now() - start;
+          result.ms.push_back(
+              std::chrono::duration_cast<std::chrono::microseconds>(d)
+                  .count() /
+              1000.0);
+        }
+        std::sort(result.ms.begin(), result.ms.end());
+        std::cerr << bench.name << " size " << size << " threads " << t
+                  << ": " << result.ms[result.ms.size() / 2] << " ms\n";
+        results.emplace_back(std::move(result));
+      }
+    }
+  }
+
+  if (!SaveResults(output_file, results)) {
+    std::cerr << "Save " << output_file << " failed\n";
+    return -1;
+  }
+  return 0;
+}
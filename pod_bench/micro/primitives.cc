@@ -0,0 +1,209 @@
+#include "primitives.h"
+
+#include <algorithm>
+#include <memory>
+
+#include "bp.h"
+#include "chain.h"
+#include "ecc.h"
+#include "ecc_pub.h"
+#include "mkl_tree.h"
+#include "multiexp.h"
+#include "vrf.h"
+
+namespace {
+// the same seed always gives the same inputs
+std::vector<Fr> SeedFr(h256_t const& seed, uint64_t n) {
+  std::vector<Fr> v;
+  ChainKeccak256(seed, n, v);
+  return v;
+}
+
+std::vector<G1> SeedG1(h256_t const& seed, uint64_t n) {
+  h256_t g_seed = seed;
+  g_seed[0] ^= 0x5a;
+  auto f = SeedFr(g_seed, n);
+  auto const& ecc_pub = GetEccPub();
+  std::vector<G1> g(n);
+  ParallelFor(0, n, [&](int64_t i) {
+    g[i] = ecc_pub.PowerG1(f[i]);
+  });
+  return g;
+}
+
+h256_t SeedItem(h256_t const& seed, uint64_t i) {
+  h256_t item = seed;
+  for (size_t j = 0; j < 8; ++j) item[j] ^= (uint8_t)(i >> (j * 8));
+  return item;
+}
+
+std::vector<MicroBench> MakeMicroBenches() {
+  std::vector<MicroBench> v;
+
+  v.push_back({"multiexp_bdlo12", [](uint64_t size, h256_t const& seed) {
+                 auto g = std::make_shared<std::vector<G1>>(SeedG1(seed, size));
+                 auto f = std::make_shared<std::vector<Fr>>(SeedFr(seed, size));
+                 return [g, f]() { MultiExpBdlo12(*g, *f); };
+               }});
+
+  v.push_back({"multiexp_bdlo12_parallel", [](uint64_t size,
+                                              h256_t const& seed) {
+                 auto g = std::make_shared<std::vector<G1>>(SeedG1(seed, size));
+                 auto f = std::make_shared<std::vector<Fr>>(SeedFr(seed, size));
+                 return [g, f]() {
+                   auto get_g = [&g](size_t i) -> G1 const& { return (*g)[i]; };
+                   auto get_f = [&f](size_t i) -> Fr const& { return (*f)[i]; };
+                   ParallelMultiExpBdlo12Inner<G1>(get_g, get_f, g->size());
+                 };
+               }});
+
+  v.push_back({"multiexp_bos_coster", [](uint64_t size, h256_t const& seed) {
+                 auto g = std::make_shared<std::vector<G1>>(SeedG1(seed, size));
+                 auto f = std::make_shared<std::vector<Fr>>(SeedFr(seed, size));
+                 return [g, f]() {
+                   MultiExpBosCoster(g->data(), f->data(), g->size());
+                 };
+               }});
+
+  v.push_back({"power_u1", [](uint64_t size, h256_t const& seed) {
+                 auto f = std::make_shared<std::vector<Fr>>(SeedFr(seed, size));
+                 return [f]() {
+                   auto const& ecc_pub = GetEccPub();
+                   auto u1_size = ecc_pub.u1_size();
+                   std::vector<G1> g(f->size());
+                   ParallelFor(0, g.size(), [&](int64_t i) {
+                     g[i] = ecc_pub.PowerU1(i % u1_size, (*f)[i]);
+                   });
+                 };
+               }});
+
+  v.push_back({"bin_to_g1", [](uint64_t size, h256_t const& seed) {
+                 auto g = SeedG1(seed, size);
+                 auto bin = std::make_shared<std::vector<uint8_t>>(size * 32);
+                 for (uint64_t i = 0; i < size; ++i) {
+                   G1ToBin(g[i], bin->data() + i * 32);
+                 }
+                 return [bin, size]() {
+                   std::vector<G1> g(size);
+                   BinToG1(bin->data(), g.data(), size);
+                 };
+               }});
+
+  v.push_back({"g1_to_bin", [](uint64_t size, h256_t const& seed) {
+                 auto g = std::make_shared<std::vector<G1>>(SeedG1(seed, size));
+                 return [g]() {
+                   std::vector<uint8_t> bin(g->size() * 32);
+                   G1ToBin(g->data(), bin.data(), g->size());
+                 };
+               }});
+
+  v.push_back({"chain_keccak256", [](uint64_t size, h256_t const& seed) {
+                 return [seed, size]() {
+                   std::vector<Fr> v;
+                   ChainKeccak256(seed, size, v);
+                 };
+               }});
+
+  v.push_back({"chain_mimc_inv", [](uint64_t size, h256_t const& seed) {
+                 Fr f = SeedFr(seed, 1)[0];
+                 return [f, size]() {
+                   std::vector<Fr> v;
+                   ChainMimcInv(f, size, v);
+                 };
+               }});
+
+  v.push_back({"mkl_build_tree", [](uint64_t size, h256_t const& seed) {
+                 auto items = std::make_shared<std::vector<h256_t>>(size);
+                 for (uint64_t i = 0; i < size; ++i) {
+                   (*items)[i] = SeedItem(seed, i);
+                 }
+                 return [items]() {
+                   mkl::BuildTree(items->size(),
+                                  [&items](uint64_t i) { return (*items)[i]; });
+                 };
+               }});
+
+  // size is the number of proofs
+  v.push_back({"vrf_prove", [](uint64_t size, h256_t const& seed) {
+                 auto sk = std::make_shared<vrf::Sk<>>();
+                 auto f = SeedFr(seed, sk->size());
+                 std::copy(f.begin(), f.end(), sk->begin());
+                 return [sk, seed, size]() {
+                   ParallelFor(0, size, [&](int64_t i) {
+                     auto x = SeedItem(seed, i);
+                     vrf::Psk<> psk;
+                     vrf::Prove<>(*sk, x.data(), psk);
+                   });
+                 };
+               }});
+
+  v.push_back({"vrf_verify", [](uint64_t size, h256_t const& seed) {
+                 vrf::Sk<> sk;
+                 auto f = SeedFr(seed, sk.size());
+                 std::copy(f.begin(), f.end(), sk.begin());
+                 auto const& ecc_pub = GetEccPub();
+                 auto pk = std::make_shared<vrf::Pk<>>();
+                 for (size_t i = 0; i < sk.size(); ++i) {
+                   (*pk)[i] = ecc_pub.PowerG2(sk[i]);
+                 }
+                 auto fsks = std::make_shared<std::vector<vrf::Fsk>>(size);
+                 auto psks = std::make_shared<std::vector<vrf::Psk<>>>(size);
+                 for (uint64_t i = 0; i < size; ++i) {
+                   auto x = SeedItem(seed, i);
+                   (*fsks)[i] = vrf::Vrf<>(sk, x.data());
+                   vrf::Prove<>(sk, x.data(), (*psks)[i]);
+                 }
+                 return [pk, fsks, psks, seed, size]() {
+                   ParallelFor(0, size, [&](int64_t i) {
+                     auto x = SeedItem(seed, i);
+                     vrf::Verify<>(*pk, x.data(), (*fsks)[i], (*psks)[i]);
+                   });
+                 };
+               }});
+
+  v.push_back({"bp_p1_prove", [](uint64_t size, h256_t const& seed) {
+                 auto g = std::make_shared<std::vector<G1>>(SeedG1(seed, size));
+                 auto f = std::make_shared<std::vector<Fr>>(SeedFr(seed, size));
+                 return [g, f]() {
+                   auto get_g = [&g](uint64_t i) {
+                     return i < g->size() ? (*g)[i] : G1Zero();
+                   };
+                   auto get_f = [&f](uint64_t i) {
+                     return i < f->size() ? (*f)[i] : FrZero();
+                   };
+                   bp::P1Prove(get_g, get_f, g->size());
+                 };
+               }});
+
+  v.push_back({"bp_p1_verify", [](uint64_t size, h256_t const& seed) {
+                 auto g = std::make_shared<std::vector<G1>>(SeedG1(seed, size));
+                 auto f = SeedFr(seed, size);
+                 auto get_g = [g](uint64_t i) {
+                   return i < g->size() ? (*g)[i] : G1Zero();
+                 };
+                 auto get_f = [&f](uint64_t i) {
+                   return i < f.size() ? f[i] : FrZero();
+                 };
+                 auto proof = std::make_shared<bp::P1Proof>(
+                     bp::P1Prove(get_g, get_f, size));
+                 return [get_g, proof, size]() {
+                   bp::P1Verify(*proof, get_g, size);
+                 };
+               }});
+
+  v.push_back({"fr_inv", [](uint64_t size, h256_t const& seed) {
+                 auto f = std::make_shared<std::vector<Fr>>(SeedFr(seed, size));
+                 return [f]() {
+                   auto v = *f;
+                   FrInv(v);
+                 };
+               }});
+
+  return v;
+}
+}  // namespace
+
+std::vector<MicroBench> const& GetMicroBenches() {
+  static std::vector<MicroBench> const benches = MakeMicroBenches();
+  return benches;
+}
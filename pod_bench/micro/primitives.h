@@ -0,0 +1,17 @@
+#pragma once
+
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "basic_types.h"
+
+// setup builds the inputs from the seed outside of the timing and returns
+// the operation to time
+struct MicroBench {
+  std::string name;
+  std::function<std::function<void()>(uint64_t size, h256_t const& seed)>
+      setup;
+};
+
+std::vector<MicroBench> const& GetMicroBenches();
@@ -31,6 +31,21 @@ inline constexpr size_t YasBinF() {
   return yas::options::binary | yas::options::ebig | yas::options::compacted;
 }
 
+// counts the bytes an archive writes, used to size a buffer up front
+struct YasSizeStream {
+  template <typename T>
+  size_t write(T const *, size_t size) {
+    total += size;
+    return size;
+  }
+  uint64_t total = 0;
+};
+
+template <typename Ar>
+constexpr bool IsYasSizing() {
+  return std::is_same<typename Ar::stream_type, YasSizeStream>::value;
+}
+
 // save
 template <typename Ar>
 void serialize(Ar &ar, Range const &t) {
@@ -112,6 +127,70 @@ void serialize(Ar &ar, G1 &t) {
   }
 }
 
+// the top bit of the binary seq size marks uncompressed (x, y) points
+constexpr uint64_t kG1SeqUncompressed = 1ULL << 63;
+
+// the binary load reads and decodes this many points at a time
+constexpr uint64_t kG1SeqChunk = 1ULL << 16;
+
+// save
+template <typename Ar>
+void serialize(Ar &ar, std::vector<G1> const &t) {
+  if (ar.type() == yas::binary) {
+    // compressed is the same layout as the generic vector
+    bool uncompressed = G1WireUncompressed();
+    size_t point_size = uncompressed ? 64 : 32;
+    uint64_t seq = t.size();
+    if (uncompressed) seq |= kG1SeqUncompressed;
+    ar.write_seq_size(seq);
+    if (t.empty()) return;
+    if constexpr (IsYasSizing<Ar>()) {
+      // only the length is wanted, skip the conversion
+      ar.write(static_cast<uint8_t const *>(nullptr), t.size() * point_size);
+      return;
+    }
+    std::vector<uint8_t> bin(t.size() * point_size);
+    if (uncompressed) {
+      G1ToBinUncompressed(t.data(), bin.data(), t.size());
+    } else {
+      G1ToBin(t.data(), bin.data(), t.size());
+    }
+    ar.write(bin.data(), bin.size());
+  } else {
+    assert(ar.type() == yas::json);
+    yas::detail::concepts::array::save<yas::json>(ar, t);
+  }
+}
+
+// load, the binary points come in chunks so the seq size of a peer can not
+// make us allocate more than it actually sent
+template <typename Ar>
+void serialize(Ar &ar, std::vector<G1> &t) {
+  if (ar.type() == yas::binary) {
+    uint64_t seq = ar.read_seq_size();
+    bool uncompressed = (seq & kG1SeqUncompressed) != 0;
+    uint64_t size = seq & ~kG1SeqUncompressed;
+    size_t point_size = uncompressed ? 64 : 32;
+    t.clear();
+    std::vector<uint8_t> bin;
+    for (uint64_t done = 0; done < size;) {
+      uint64_t count = std::min(size - done, kG1SeqChunk);
+      bin.resize(count * point_size);
+      ar.read(bin.data(), bin.size());  // throw
+      t.resize(done + count);
+      bool ret = uncompressed
+                     ? BinToG1Uncompressed(bin.data(), t.data() + done, count)
+                     : BinToG1(bin.data(), t.data() + done, count);
+      if (!ret) throw std::runtime_error("invalid G1");
+      done += count;
+    }
+  } else {
+    assert(ar.type() == yas::json);
+    t.clear();
+    yas::detail::concepts::array::load<yas::json>(ar, t);
+  }
+}
+
 // save
 template <typename Ar>
 void serialize(Ar &ar, G2 const &t) {
@@ -0,0 +1,68 @@
+#include "basic_types_serialize_test.h"
+
+#include <iostream>
+
+#include "basic_types_serialize.h"
+
+namespace {
+// a binary archive holding seq as the seq size and then len bytes
+std::vector<uint8_t> SeqInput(uint64_t seq, size_t len) {
+  yas::mem_ostream os;
+  yas::binary_oarchive<yas::mem_ostream, YasBinF()> oa(os);
+  oa.write_seq_size(seq);
+  std::vector<uint8_t> bytes(len);
+  if (len) oa.write(bytes.data(), bytes.size());
+  auto buf = os.get_intrusive_buffer();
+  return std::vector<uint8_t>(buf.data, buf.data + buf.size);
+}
+
+bool LoadFails(std::vector<uint8_t> const& input) {
+  try {
+    yas::mem_istream is(input.data(), input.size());
+    yas::binary_iarchive<yas::mem_istream, YasBinF()> ia(is);
+    std::vector<G1> t;
+    ia.serialize(t);
+  } catch (std::exception&) {
+    return true;
+  }
+  return false;
+}
+
+bool RoundTrip(bool uncompressed) {
+  std::vector<G1> points(3);
+  G1Rand(points.data(), points.size());
+  yas::mem_ostream os;
+  {
+    G1WireScope wire(uncompressed);
+    yas::binary_oarchive<yas::mem_ostream, YasBinF()> oa(os);
+    oa.serialize(points);
+  }
+  auto buf = os.get_intrusive_buffer();
+  yas::mem_istream is(buf.data, buf.size);
+  yas::binary_iarchive<yas::mem_istream, YasBinF()> ia(is);
+  std::vector<G1> loaded;
+  ia.serialize(loaded);
+  return loaded == points;
+}
+}  // namespace
+
+bool TestG1SeqSize() {
+  if (!RoundTrip(false) || !RoundTrip(true)) {
+    assert(false);
+    return false;
+  }
+
+  // size * 32 and size * 64 wrap around
+  if (!LoadFails(SeqInput((1ULL << 58) + 1, 64)) ||
+      !LoadFails(SeqInput(mcl::kG1SeqUncompressed | ((1ULL << 58) + 1), 64))) {
+    assert(false);
+    return false;
+  }
+
+  // a valid but far too large size, and one point short
+  if (!LoadFails(SeqInput(1ULL << 40, 32)) || !LoadFails(SeqInput(2, 32))) {
+    assert(false);
+    return false;
+  }
+  return true;
+}
@@ -0,0 +1,5 @@
+#pragma once
+
+// the binary std::vector<G1> round trip, and seq sizes larger than the input
+// (or overflowing the byte count) fail without allocating them
+bool TestG1SeqSize();
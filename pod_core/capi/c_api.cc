@@ -1,11 +1,154 @@
 #include "c_api.h"
 
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <fstream>
+#include <mutex>
 #include <string>
+#include <thread>
+#include <vector>
+
+#include "c_api_async.h"
+#include "c_api_object.h"
+#include "ecc.h"
+#include "task.h"
+#include "trace.h"
 
 bool InitAll(std::string const& data_dir);
 
+namespace {
+struct CapiTask {
+  Task task;
+  done_t done = nullptr;
+  void* ctx = nullptr;
+  std::atomic<uint32_t> concurrency{0};  // 0: the whole scheduler
+};
+
+// the tasks run their loops on the shared scheduler, so a few workers are
+// enough. Never destroyed, the detached workers still wait on cv_ at exit.
+class AsyncPool {
+ public:
+  static AsyncPool& Instance() {
+    static AsyncPool* pool = new AsyncPool(4);
+    return *pool;
+  }
+
+  void Post(std::function<void()> job) {
+    {
+      std::scoped_lock<std::mutex> lock(mutex_);
+      jobs_.push_back(std::move(job));
+    }
+    cv_.notify_one();
+  }
+
+ private:
+  AsyncPool(size_t thread_num) {
+    for (size_t i = 0; i < thread_num; ++i) {
+      std::thread([this]() { Run(); }).detach();
+    }
+  }
+
+  void Run() {
+#ifdef MULTICORE
+#ifndef __clang__
+    // the omp regions left inside libsnark must not add a team per task
+    omp_set_num_threads(1);
+#endif
+#endif
+    for (;;) {
+      std::function<void()> job;
+      {
+        std::unique_lock<std::mutex> lock(mutex_);
+        cv_.wait(lock, [this]() { return !jobs_.empty(); });
+        job = std::move(jobs_.front());
+        jobs_.pop_front();
+      }
+      job();
+    }
+  }
+
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  std::deque<std::function<void()>> jobs_;
+};
+}  // namespace
+
+bool CapiAsync(handle_t c_task, std::function<bool()> f) {
+  auto task = CapiObject<CapiTask>::Get(c_task);
+  if (!task) return false;
+
+  AsyncPool::Instance().Post([task, f = std::move(f)]() {
+    bool ret;
+    {
+      TaskScope scope(&task->task);
+      ConcurrencyScope limit(task->concurrency);
+      try {
+        ret = f();
+      } catch (std::exception&) {
+        ret = false;
+      }
+      if (ret) TaskProgress("done", 1.0);
+    }
+    if (task->done) task->done(task->ctx, ret);
+  });
+  return true;
+}
+
 extern "C" {
 EXPORT bool E_InitAll(char const* data_dir) {
   return InitAll(data_dir);
 }
+
+EXPORT void E_SetParallelThreads(uint32_t threads) {
+  SetParallelThreads(threads);
+}
+
+EXPORT void E_TraceEnable(bool enable, bool console) {
+  trace::Enable(enable);
+  trace::SetConsole(console);
+}
+
+EXPORT bool E_TraceSave(char const* chrome_file, char const* summary_file) {
+  if (chrome_file && !trace::SaveChromeTrace(chrome_file)) return false;
+  if (summary_file) {
+    std::ofstream os(summary_file);
+    trace::DumpSummary(os);
+    if (!os) return false;
+  }
+  return true;
+}
+
+EXPORT void E_TraceReset() { trace::Reset(); }
+
+EXPORT handle_t E_TaskNew(progress_t progress, done_t done, void* ctx) {
+  auto p = new CapiTask;
+  if (progress) {
+    p->task.progress = [progress, ctx](char const* stage, double fraction) {
+      progress(ctx, stage, fraction);
+    };
+  }
+  p->done = done;
+  p->ctx = ctx;
+  CapiObject<CapiTask>::Add(p);
+  return p;
+}
+
+EXPORT bool E_TaskCancel(handle_t c_task) {
+  auto task = CapiObject<CapiTask>::Get(c_task);
+  if (!task) return false;
+  task->task.cancelled = true;
+  return true;
+}
+
+EXPORT bool E_TaskSetConcurrency(handle_t c_task, uint32_t threads) {
+  auto task = CapiObject<CapiTask>::Get(c_task);
+  if (!task) return false;
+  task->concurrency = threads;
+  return true;
+}
+
+EXPORT bool E_TaskFree(handle_t c_task) {
+  return CapiObject<CapiTask>::Del(c_task);
+}
 }  // extern "C"
\ No newline at end of file
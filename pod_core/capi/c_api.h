@@ -22,6 +22,32 @@ extern "C"
 
     EXPORT bool E_InitAll(char const *data_dir);
 
+    // size of the shared thread pool, call before any other call, 0: the
+    // number of cores
+    EXPORT void E_SetParallelThreads(uint32_t threads);
+
+    // record spans and counters, console prints every span like the old tick
+    EXPORT void E_TraceEnable(bool enable, bool console);
+
+    // chrome trace-event json and the summary text, either may be null
+    EXPORT bool E_TraceSave(char const *chrome_file, char const *summary_file);
+
+    EXPORT void E_TraceReset();
+
+    // a task drives the *Async calls, done is called on the worker thread,
+    // progress on the worker or the pool threads of its loops but never
+    // concurrently. The task may be cancelled or freed at any time, the
+    // running call stops at its next check and reports false.
+    EXPORT handle_t E_TaskNew(progress_t progress, done_t done, void *ctx);
+
+    EXPORT bool E_TaskCancel(handle_t c_task);
+
+    // at most threads pool threads work for the calls of this task, 0: no
+    // limit, takes effect from the next *Async call
+    EXPORT bool E_TaskSetConcurrency(handle_t c_task, uint32_t threads);
+
+    EXPORT bool E_TaskFree(handle_t c_task);
+
 #ifdef __cplusplus
 }
 #endif
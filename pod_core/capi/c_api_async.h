@@ -0,0 +1,9 @@
+#pragma once
+
+#include <functional>
+
+#include "c_api_types.h"
+
+// run f on the async worker pool under the task c_task, the task's done
+// callback gets the result of f
+bool CapiAsync(handle_t c_task, std::function<bool()> f);
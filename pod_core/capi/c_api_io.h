@@ -0,0 +1,105 @@
+#pragma once
+
+#include <stdexcept>
+#include <type_traits>
+
+#include "../basic_types_serialize.h"
+#include "c_api_types.h"
+
+// a message comes from a file or from a caller buffer
+struct CapiIn {
+  explicit CapiIn(char const* file) : file(file) {}
+  explicit CapiIn(buffer_t const* buf) : buf(buf) {}
+  char const* file = nullptr;
+  buffer_t const* buf = nullptr;
+};
+
+// a message goes to a file or to a buffer got from the caller's alloc
+struct CapiOut {
+  explicit CapiOut(char const* file) : file(file) {}
+  CapiOut(buffer_t* buf, alloc_t alloc, void* ctx)
+      : buf(buf), alloc(alloc), ctx(ctx) {}
+  char const* file = nullptr;
+  buffer_t* buf = nullptr;
+  alloc_t alloc = nullptr;
+  void* ctx = nullptr;
+};
+
+// save(os) writes the message to the stream os. It runs once to count the
+// bytes and once more straight into the caller's buffer, so a big message is
+// never held twice. out.buf is set as soon as alloc returns, so the caller
+// can free the buffer even if the second save throws.
+// throw
+template <typename Save>
+void CapiOutput(CapiOut const& out, Save const& save) {
+  YasSizeStream counter;
+  save(counter);
+  uint64_t size = counter.total;
+  uint8_t* p = out.alloc(out.ctx, size);
+  if (!p && size) throw std::runtime_error("alloc failed");
+  out.buf->p = p;
+  out.buf->len = size;
+  yas::mem_ostream os(p, size);
+  save(os);
+  auto data = os.get_intrusive_buffer();
+  if (data.data != reinterpret_cast<char const*>(p) || data.size != size)
+    throw std::runtime_error("size mismatch");
+}
+
+// throw
+template <typename T>
+void CapiLoadJson(CapiIn const& in, T& t) {
+  if (in.file) {
+    yas::file_istream is(in.file);
+    yas::json_iarchive<yas::file_istream> ia(is);
+    ia.serialize(t);
+  } else {
+    yas::mem_istream is(in.buf->p, in.buf->len);
+    yas::json_iarchive<yas::mem_istream> ia(is);
+    ia.serialize(t);
+  }
+}
+
+// throw
+template <typename T>
+void CapiLoadBin(CapiIn const& in, T& t) {
+  if (in.file) {
+    yas::file_istream is(in.file);
+    yas::binary_iarchive<yas::file_istream, YasBinF()> ia(is);
+    ia.serialize(t);
+  } else {
+    yas::mem_istream is(in.buf->p, in.buf->len);
+    yas::binary_iarchive<yas::mem_istream, YasBinF()> ia(is);
+    ia.serialize(t);
+  }
+}
+
+// throw
+template <typename T>
+void CapiSaveJson(CapiOut const& out, T const& t) {
+  if (out.file) {
+    yas::file_ostream os(out.file);
+    yas::json_oarchive<yas::file_ostream> oa(os);
+    oa.serialize(t);
+  } else {
+    CapiOutput(out, [&t](auto& os) {
+      yas::json_oarchive<std::decay_t<decltype(os)>> oa(os);
+      oa.serialize(t);
+    });
+  }
+}
+
+// throw
+template <typename T>
+void CapiSaveBin(CapiOut const& out, T const& t) {
+  if (out.file) {
+    yas::file_ostream os(out.file);
+    yas::binary_oarchive<yas::file_ostream, YasBinF()> oa(os);
+    oa.serialize(t);
+  } else {
+    CapiOutput(out, [&t](auto& os) {
+      yas::binary_oarchive<std::decay_t<decltype(os)>, YasBinF()> oa(os);
+      oa.serialize(t);
+    });
+  }
+}
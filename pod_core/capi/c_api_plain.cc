@@ -22,12 +22,53 @@
 #include "../scheme_ot_complaint_serialize.h"
 #include "../scheme_plain_alice_data.h"
 #include "../scheme_plain_bob_data.h"
+#include "../sigma_slice_serialize.h"
 
 #include "ecc.h"
 #include "ecc_pub.h"
 
+#include "c_api_async.h"
+#include "c_api_io.h"
 #include "c_api_object.h"
 
+namespace {
+bool PlainAliceSigmaSlice(handle_t c_alice_data, range_t const* c_demand,
+                          uint64_t c_demand_count, CapiOut const& slice_msg) {
+  using namespace scheme::plain;
+  AliceDataPtr alice_data = CapiObject<AliceData>::Get(c_alice_data);
+  if (!alice_data) return false;
+
+  std::vector<Range> demands(c_demand_count);
+  for (uint64_t i = 0; i < c_demand_count; ++i) {
+    demands[i].start = c_demand[i].start;
+    demands[i].count = c_demand[i].count;
+  }
+
+  try {
+    scheme::SigmaSlice slice;
+    alice_data->GetSigmaSlice(demands, slice);
+    CapiSaveBin(slice_msg, slice);
+  } catch (std::exception&) {
+    return false;
+  }
+  return true;
+}
+
+handle_t PlainBobDataNewFromSlice(char const* bulletin_file,
+                                  CapiIn const& slice_msg) {
+  using namespace scheme::plain;
+  try {
+    scheme::SigmaSlice slice;
+    CapiLoadBin(slice_msg, slice);
+    auto p = new BobData(bulletin_file, slice);
+    CapiObject<BobData>::Add(p);
+    return p;
+  } catch (std::exception&) {
+    return nullptr;
+  }
+}
+}  // namespace
+
 extern "C" {
 EXPORT handle_t E_PlainAliceDataNew(char const* publish_path) {
   using namespace scheme::plain;
@@ -52,6 +93,32 @@ EXPORT handle_t E_PlainBobDataNew(char const* bulletin_file,
   }
 }
 
+EXPORT bool E_PlainAliceSigmaSlice(handle_t c_alice_data,
+                                   range_t const* c_demand,
+                                   uint64_t c_demand_count,
+                                   char const* slice_file) {
+  return PlainAliceSigmaSlice(c_alice_data, c_demand, c_demand_count,
+                              CapiOut(slice_file));
+}
+
+EXPORT bool E_PlainAliceSigmaSliceBuf(handle_t c_alice_data,
+                                      range_t const* c_demand,
+                                      uint64_t c_demand_count, buffer_t* slice,
+                                      alloc_t alloc, void* ctx) {
+  return PlainAliceSigmaSlice(c_alice_data, c_demand, c_demand_count,
+                              CapiOut(slice, alloc, ctx));
+}
+
+EXPORT handle_t E_PlainBobDataNewFromSlice(char const* bulletin_file,
+                                           char const* slice_file) {
+  return PlainBobDataNewFromSlice(bulletin_file, CapiIn(slice_file));
+}
+
+EXPORT handle_t E_PlainBobDataNewFromSliceBuf(char const* bulletin_file,
+                                              buffer_t const* slice) {
+  return PlainBobDataNewFromSlice(bulletin_file, CapiIn(slice));
+}
+
 EXPORT bool E_PlainAliceBulletin(handle_t c_alice_data,
                                  plain_bulletin_t* bulletin) {
   using namespace scheme::plain;
@@ -90,32 +157,9 @@ EXPORT bool E_PlainBobDataFree(handle_t c_bob_data) {
 }  // extern "C"
 
 // complaint
-extern "C" {
-EXPORT handle_t E_PlainComplaintAliceNew(handle_t c_alice_data,
-                                         uint8_t const* c_self_id,
-                                         uint8_t const* c_peer_id) {
-  using namespace scheme::plain;
-  using namespace scheme::complaint;
-  AliceDataPtr alice_data = CapiObject<AliceData>::Get(c_alice_data);
-  if (!alice_data) return nullptr;
-
-  h256_t self_id;
-  memcpy(self_id.data(), c_self_id, h256_t::size_value);
-  h256_t peer_id;
-  memcpy(peer_id.data(), c_peer_id, h256_t::size_value);
-
-  try {
-    auto p = new Alice<AliceData>(alice_data, self_id, peer_id);
-    CapiObject<Alice<AliceData>>::Add(p);
-    return p;
-  } catch (std::exception&) {
-    return nullptr;
-  }
-}
-
-EXPORT bool E_PlainComplaintAliceOnRequest(handle_t c_alice,
-                                           char const* request_file,
-                                           char const* response_file) {
+namespace {
+bool PlainComplaintAliceOnRequest(handle_t c_alice, CapiIn const& request_msg,
+                                  CapiOut const& response_msg) {
   using namespace scheme::plain;
   using namespace scheme::complaint;
   auto alice = CapiObject<Alice<AliceData>>::Get(c_alice);
@@ -123,16 +167,12 @@ EXPORT bool E_PlainComplaintAliceOnRequest(handle_t c_alice,
 
   try {
     Request request;
-    yas::file_istream is(request_file);
-    yas::json_iarchive<yas::file_istream> ia(is);
-    ia.serialize(request);
+    CapiLoadJson(request_msg, request);
 
     Response response;
     if (!alice->OnRequest(request, response)) return false;
 
-    yas::file_ostream os(response_file);
-    yas::binary_oarchive<yas::file_ostream, YasBinF()> oa(os);
-    oa.serialize(response);
+    CapiSaveBin(response_msg, response);
   } catch (std::exception&) {
     return false;
   }
@@ -140,9 +180,8 @@ EXPORT bool E_PlainComplaintAliceOnRequest(handle_t c_alice,
   return true;
 }
 
-EXPORT bool E_PlainComplaintAliceOnReceipt(handle_t c_alice,
-                                           char const* receipt_file,
-                                           char const* secret_file) {
+bool PlainComplaintAliceOnReceipt(handle_t c_alice, CapiIn const& receipt_msg,
+                                  CapiOut const& secret_msg) {
   using namespace scheme::plain;
   using namespace scheme::complaint;
   auto alice = CapiObject<Alice<AliceData>>::Get(c_alice);
@@ -150,16 +189,12 @@ EXPORT bool E_PlainComplaintAliceOnReceipt(handle_t c_alice,
 
   try {
     Receipt receipt;
-    yas::file_istream is(receipt_file);
-    yas::json_iarchive<yas::file_istream> ia(is);
-    ia.serialize(receipt);
+    CapiLoadJson(receipt_msg, receipt);
 
     Secret secret;
     if (!alice->OnReceipt(receipt, secret)) return false;
 
-    yas::file_ostream os(secret_file);
-    yas::json_oarchive<yas::file_ostream> oa(os);
-    oa.serialize(secret);
+    CapiSaveJson(secret_msg, secret);
   } catch (std::exception&) {
     return false;
   }
@@ -167,53 +202,7 @@ EXPORT bool E_PlainComplaintAliceOnReceipt(handle_t c_alice,
   return true;
 }
 
-EXPORT bool E_PlainComplaintAliceSetEvil(handle_t c_alice) {
-  using namespace scheme::plain;
-  using namespace scheme::complaint;
-  auto alice = CapiObject<Alice<AliceData>>::Get(c_alice);
-  if (!alice) return false;
-  alice->TestSetEvil();
-  return true;
-}
-
-EXPORT bool E_PlainComplaintAliceFree(handle_t c_alice) {
-  using namespace scheme::plain;
-  using namespace scheme::complaint;
-  return CapiObject<Alice<AliceData>>::Del(c_alice);
-}
-
-EXPORT handle_t E_PlainComplaintBobNew(handle_t c_bob_data,
-                                       uint8_t const* c_self_id,
-                                       uint8_t const* c_peer_id,
-                                       range_t const* c_demand,
-                                       uint64_t c_demand_count) {
-  using namespace scheme::plain;
-  using namespace scheme::complaint;
-  BobDataPtr bob_data = CapiObject<BobData>::Get(c_bob_data);
-  if (!bob_data) return nullptr;
-
-  h256_t self_id;
-  memcpy(self_id.data(), c_self_id, h256_t::size_value);
-  h256_t peer_id;
-  memcpy(peer_id.data(), c_peer_id, h256_t::size_value);
-
-  std::vector<Range> demands(c_demand_count);
-  for (uint64_t i = 0; i < c_demand_count; ++i) {
-    demands[i].start = c_demand[i].start;
-    demands[i].count = c_demand[i].count;
-  }
-
-  try {
-    auto p = new Bob<BobData>(bob_data, self_id, peer_id, std::move(demands));
-    CapiObject<Bob<BobData>>::Add(p);
-    return p;
-  } catch (std::exception&) {
-    return nullptr;
-  }
-}
-
-EXPORT bool E_PlainComplaintBobGetRequest(handle_t c_bob,
-                                          char const* request_file) {
+bool PlainComplaintBobGetRequest(handle_t c_bob, CapiOut const& request_msg) {
   using namespace scheme::plain;
   using namespace scheme::complaint;
   auto bob = CapiObject<Bob<BobData>>::Get(c_bob);
@@ -222,9 +211,7 @@ EXPORT bool E_PlainComplaintBobGetRequest(handle_t c_bob,
   try {
     Request request;
     bob->GetRequest(request);
-    yas::file_ostream os(request_file);
-    yas::json_oarchive<yas::file_ostream> oa(os);
-    oa.serialize(request);
+    CapiSaveJson(request_msg, request);
   } catch (std::exception&) {
     return false;
   }
@@ -232,9 +219,8 @@ EXPORT bool E_PlainComplaintBobGetRequest(handle_t c_bob,
   return true;
 }
 
-EXPORT bool E_PlainComplaintBobOnResponse(handle_t c_bob,
-                                          char const* response_file,
-                                          char const* receipt_file) {
+bool PlainComplaintBobOnResponse(handle_t c_bob, CapiIn const& response_msg,
+                                 CapiOut const& receipt_msg) {
   using namespace scheme::plain;
   using namespace scheme::complaint;
   auto bob = CapiObject<Bob<BobData>>::Get(c_bob);
@@ -242,16 +228,12 @@ EXPORT bool E_PlainComplaintBobOnResponse(handle_t c_bob,
 
   try {
     Response response;
-    yas::file_istream is(response_file);
-    yas::binary_iarchive<yas::file_istream, YasBinF()> ia(is);
-    ia.serialize(response);
+    CapiLoadBin(response_msg, response);
 
     Receipt receipt;
     if (!bob->OnResponse(std::move(response), receipt)) return false;
 
-    yas::file_ostream os(receipt_file);
-    yas::json_oarchive<yas::file_ostream> oa(os);
-    oa.serialize(receipt);
+    CapiSaveJson(receipt_msg, receipt);
   } catch (std::exception&) {
     return false;
   }
@@ -259,8 +241,7 @@ EXPORT bool E_PlainComplaintBobOnResponse(handle_t c_bob,
   return true;
 }
 
-EXPORT bool E_PlainComplaintBobOnSecret(handle_t c_bob,
-                                        char const* secret_file) {
+bool PlainComplaintBobOnSecret(handle_t c_bob, CapiIn const& secret_msg) {
   using namespace scheme::plain;
   using namespace scheme::complaint;
   auto bob = CapiObject<Bob<BobData>>::Get(c_bob);
@@ -268,9 +249,7 @@ EXPORT bool E_PlainComplaintBobOnSecret(handle_t c_bob,
 
   try {
     Secret secret;
-    yas::file_istream is(secret_file);
-    yas::json_iarchive<yas::file_istream> ia(is);
-    ia.serialize(secret);
+    CapiLoadJson(secret_msg, secret);
     return bob->OnSecret(secret);
   } catch (std::exception&) {
     return false;
@@ -279,8 +258,7 @@ EXPORT bool E_PlainComplaintBobOnSecret(handle_t c_bob,
   return true;
 }
 
-EXPORT bool E_PlainComplaintBobGenerateClaim(handle_t c_bob,
-                                             char const* claim_file) {
+bool PlainComplaintBobGenerateClaim(handle_t c_bob, CapiOut const& claim_msg) {
   using namespace scheme::plain;
   using namespace scheme::complaint;
   auto bob = CapiObject<Bob<BobData>>::Get(c_bob);
@@ -290,43 +268,21 @@ EXPORT bool E_PlainComplaintBobGenerateClaim(handle_t c_bob,
     Claim claim;
     if (!bob->GenerateClaim(claim)) return false;
 
-    yas::file_ostream os(claim_file);
-    yas::json_oarchive<yas::file_ostream> oa(os);
-    oa.serialize(claim);
+    CapiSaveJson(claim_msg, claim);
   } catch (std::exception&) {
     return false;
   }
 
   return true;
 }
+}  // namespace
 
-EXPORT bool E_PlainComplaintBobSaveDecrypted(handle_t c_bob, char const* file) {
-  using namespace scheme::plain;
-  using namespace scheme::complaint;
-  auto bob = CapiObject<Bob<BobData>>::Get(c_bob);
-  if (!bob) return false;
-
-  try {
-    return bob->SaveDecrypted(file);
-  } catch (std::exception&) {
-    return false;
-  }
-}
-
-EXPORT bool E_PlainComplaintBobFree(handle_t c_bob) {
-  using namespace scheme::plain;
-  using namespace scheme::complaint;
-  return CapiObject<Bob<BobData>>::Del(c_bob);
-}
-}  // extern "C" complaint
-
-// atomic_swap
 extern "C" {
-EXPORT handle_t E_PlainAtomicSwapAliceNew(handle_t c_alice_data,
-                                          uint8_t const* c_self_id,
-                                          uint8_t const* c_peer_id) {
+EXPORT handle_t E_PlainComplaintAliceNew(handle_t c_alice_data,
+                                         uint8_t const* c_self_id,
+                                         uint8_t const* c_peer_id) {
   using namespace scheme::plain;
-  using namespace scheme::atomic_swap;
+  using namespace scheme::complaint;
   AliceDataPtr alice_data = CapiObject<AliceData>::Get(c_alice_data);
   if (!alice_data) return nullptr;
 
@@ -344,82 +300,81 @@ EXPORT handle_t E_PlainAtomicSwapAliceNew(handle_t c_alice_data,
   }
 }
 
-EXPORT bool E_PlainAtomicSwapAliceOnRequest(handle_t c_alice,
-                                            char const* request_file,
-                                            char const* response_file) {
-  using namespace scheme::plain;
-  using namespace scheme::atomic_swap;
-  auto alice = CapiObject<Alice<AliceData>>::Get(c_alice);
-  if (!alice) return false;
-
-  try {
-    Request request;
-    yas::file_istream is(request_file);
-    yas::json_iarchive<yas::file_istream> ia(is);
-    ia.serialize(request);
-
-    Response response;
-    if (!alice->OnRequest(request, response)) return false;
-
-    yas::file_ostream os(response_file);
-    yas::binary_oarchive<yas::file_ostream, YasBinF()> oa(os);
-    oa.serialize(response);
-  } catch (std::exception&) {
-    return false;
-  }
-
-  return true;
+EXPORT bool E_PlainComplaintAliceOnRequest(handle_t c_alice,
+                                           char const* request_file,
+                                           char const* response_file) {
+  return PlainComplaintAliceOnRequest(c_alice, CapiIn(request_file),
+                                      CapiOut(response_file));
 }
 
-EXPORT bool E_PlainAtomicSwapAliceOnReceipt(handle_t c_alice,
-                                            char const* receipt_file,
-                                            char const* secret_file) {
-  using namespace scheme::plain;
-  using namespace scheme::atomic_swap;
-  auto alice = CapiObject<Alice<AliceData>>::Get(c_alice);
-  if (!alice) return false;
+EXPORT bool E_PlainComplaintAliceOnRequestBuf(handle_t c_alice,
+                                              buffer_t const* request,
+                                              buffer_t* response, alloc_t alloc,
+                                              void* ctx) {
+  return PlainComplaintAliceOnRequest(c_alice, CapiIn(request),
+                                      CapiOut(response, alloc, ctx));
+}
 
-  try {
-    Receipt receipt;
-    yas::file_istream is(receipt_file);
-    yas::json_iarchive<yas::file_istream> ia(is);
-    ia.serialize(receipt);
+EXPORT bool E_PlainComplaintAliceOnRequestAsync(handle_t c_alice,
+                                                char const* request_file,
+                                                char const* response_file,
+                                                handle_t c_task) {
+  std::string request(request_file);
+  std::string response(response_file);
+  return CapiAsync(c_task, [=]() {
+    return PlainComplaintAliceOnRequest(c_alice, CapiIn(request.c_str()),
+                                        CapiOut(response.c_str()));
+  });
+}
 
-    Secret secret;
-    if (!alice->OnReceipt(receipt, secret)) return false;
+EXPORT bool E_PlainComplaintAliceOnRequestBufAsync(handle_t c_alice,
+                                                   buffer_t const* request,
+                                                   buffer_t* response,
+                                                   alloc_t alloc, void* ctx,
+                                                   handle_t c_task) {
+  return CapiAsync(c_task, [=]() {
+    return PlainComplaintAliceOnRequest(c_alice, CapiIn(request),
+                                        CapiOut(response, alloc, ctx));
+  });
+}
 
-    yas::file_ostream os(secret_file);
-    yas::json_oarchive<yas::file_ostream> oa(os);
-    oa.serialize(secret);
-  } catch (std::exception&) {
-    return false;
-  }
+EXPORT bool E_PlainComplaintAliceOnReceipt(handle_t c_alice,
+                                           char const* receipt_file,
+                                           char const* secret_file) {
+  return PlainComplaintAliceOnReceipt(c_alice, CapiIn(receipt_file),
+                                      CapiOut(secret_file));
+}
 
-  return true;
+EXPORT bool E_PlainComplaintAliceOnReceiptBuf(handle_t c_alice,
+                                              buffer_t const* receipt,
+                                              buffer_t* secret, alloc_t alloc,
+                                              void* ctx) {
+  return PlainComplaintAliceOnReceipt(c_alice, CapiIn(receipt),
+                                      CapiOut(secret, alloc, ctx));
 }
 
-EXPORT bool E_PlainAtomicSwapAliceSetEvil(handle_t c_alice) {
+EXPORT bool E_PlainComplaintAliceSetEvil(handle_t c_alice) {
   using namespace scheme::plain;
-  using namespace scheme::atomic_swap;
+  using namespace scheme::complaint;
   auto alice = CapiObject<Alice<AliceData>>::Get(c_alice);
   if (!alice) return false;
   alice->TestSetEvil();
   return true;
 }
 
-EXPORT bool E_PlainAtomicSwapAliceFree(handle_t c_alice) {
+EXPORT bool E_PlainComplaintAliceFree(handle_t c_alice) {
   using namespace scheme::plain;
-  using namespace scheme::atomic_swap;
+  using namespace scheme::complaint;
   return CapiObject<Alice<AliceData>>::Del(c_alice);
 }
 
-EXPORT handle_t E_PlainAtomicSwapBobNew(handle_t c_bob_data,
-                                        uint8_t const* c_self_id,
-                                        uint8_t const* c_peer_id,
-                                        range_t const* c_demand,
-                                        uint64_t c_demand_count) {
+EXPORT handle_t E_PlainComplaintBobNew(handle_t c_bob_data,
+                                       uint8_t const* c_self_id,
+                                       uint8_t const* c_peer_id,
+                                       range_t const* c_demand,
+                                       uint64_t c_demand_count) {
   using namespace scheme::plain;
-  using namespace scheme::atomic_swap;
+  using namespace scheme::complaint;
   BobDataPtr bob_data = CapiObject<BobData>::Get(c_bob_data);
   if (!bob_data) return nullptr;
 
@@ -443,66 +398,121 @@ EXPORT handle_t E_PlainAtomicSwapBobNew(handle_t c_bob_data,
   }
 }
 
-EXPORT bool E_PlainAtomicSwapBobGetRequest(handle_t c_bob,
-                                           char const* request_file) {
+EXPORT bool E_PlainComplaintBobSetG1Uncompressed(handle_t c_bob,
+                                                 bool uncompressed) {
   using namespace scheme::plain;
-  using namespace scheme::atomic_swap;
+  using namespace scheme::complaint;
   auto bob = CapiObject<Bob<BobData>>::Get(c_bob);
   if (!bob) return false;
-
-  try {
-    Request request;
-    bob->GetRequest(request);
-    yas::file_ostream os(request_file);
-    yas::json_oarchive<yas::file_ostream> oa(os);
-    oa.serialize(request);
-  } catch (std::exception&) {
-    return false;
-  }
-
+  bob->SetG1Uncompressed(uncompressed);
   return true;
 }
 
-EXPORT bool E_PlainAtomicSwapBobOnResponse(handle_t c_bob,
-                                           char const* response_file,
-                                           char const* receipt_file) {
-  using namespace scheme::plain;
-  using namespace scheme::atomic_swap;
-  auto bob = CapiObject<Bob<BobData>>::Get(c_bob);
-  if (!bob) return false;
+EXPORT bool E_PlainComplaintBobGetRequest(handle_t c_bob,
+                                          char const* request_file) {
+  return PlainComplaintBobGetRequest(c_bob, CapiOut(request_file));
+}
 
-  try {
-    Response response;
-    yas::file_istream is(response_file);
-    yas::binary_iarchive<yas::file_istream, YasBinF()> ia(is);
-    ia.serialize(response);
+EXPORT bool E_PlainComplaintBobGetRequestBuf(handle_t c_bob, buffer_t* request,
+                                             alloc_t alloc, void* ctx) {
+  return PlainComplaintBobGetRequest(c_bob, CapiOut(request, alloc, ctx));
+}
 
-    Receipt receipt;
-    if (!bob->OnResponse(std::move(response), receipt)) return false;
+EXPORT bool E_PlainComplaintBobOnResponse(handle_t c_bob,
+                                          char const* response_file,
+                                          char const* receipt_file) {
+  return PlainComplaintBobOnResponse(c_bob, CapiIn(response_file),
+                                     CapiOut(receipt_file));
+}
 
-    yas::file_ostream os(receipt_file);
-    yas::json_oarchive<yas::file_ostream> oa(os);
-    oa.serialize(receipt);
-  } catch (std::exception&) {
-    return false;
-  }
+EXPORT bool E_PlainComplaintBobOnResponseBuf(handle_t c_bob,
+                                             buffer_t const* response,
+                                             buffer_t* receipt, alloc_t alloc,
+                                             void* ctx) {
+  return PlainComplaintBobOnResponse(c_bob, CapiIn(response),
+                                     CapiOut(receipt, alloc, ctx));
+}
 
-  return true;
+EXPORT bool E_PlainComplaintBobOnResponseAsync(handle_t c_bob,
+                                               char const* response_file,
+                                               char const* receipt_file,
+                                               handle_t c_task) {
+  std::string response(response_file);
+  std::string receipt(receipt_file);
+  return CapiAsync(c_task, [=]() {
+    return PlainComplaintBobOnResponse(c_bob, CapiIn(response.c_str()),
+                                       CapiOut(receipt.c_str()));
+  });
 }
 
-EXPORT bool E_PlainAtomicSwapBobOnSecret(handle_t c_bob,
-                                         char const* secret_file) {
-  using namespace scheme::plain;
-  using namespace scheme::atomic_swap;
-  auto bob = CapiObject<Bob<BobData>>::Get(c_bob);
-  if (!bob) return false;
+EXPORT bool E_PlainComplaintBobOnResponseBufAsync(handle_t c_bob,
+                                                  buffer_t const* response,
+                                                  buffer_t* receipt,
+                                                  alloc_t alloc, void* ctx,
+                                                  handle_t c_task) {
+  return CapiAsync(c_task, [=]() {
+    return PlainComplaintBobOnResponse(c_bob, CapiIn(response),
+                                       CapiOut(receipt, alloc, ctx));
+  });
+}
 
-  try {
-    Secret secret;
-    yas::file_istream is(secret_file);
-    yas::json_iarchive<yas::file_istream> ia(is);
-    ia.serialize(secret);
-    return bob->OnSecret(secret);
+EXPORT bool E_PlainComplaintBobOnSecret(handle_t c_bob,
+                                        char const* secret_file) {
+  return PlainComplaintBobOnSecret(c_bob, CapiIn(secret_file));
+}
+
+EXPORT bool E_PlainComplaintBobOnSecretBuf(handle_t c_bob,
+                                           buffer_t const* secret) {
+  return PlainComplaintBobOnSecret(c_bob, CapiIn(secret));
+}
+
+EXPORT bool E_PlainComplaintBobGenerateClaim(handle_t c_bob,
+                                             char const* claim_file) {
+  return PlainComplaintBobGenerateClaim(c_bob, CapiOut(claim_file));
+}
+
+EXPORT bool E_PlainComplaintBobGenerateClaimBuf(handle_t c_bob, buffer_t* claim,
+                                                alloc_t alloc, void* ctx) {
+  return PlainComplaintBobGenerateClaim(c_bob, CapiOut(claim, alloc, ctx));
+}
+
+EXPORT bool E_PlainComplaintBobSaveDecrypted(handle_t c_bob, char const* file) {
+  using namespace scheme::plain;
+  using namespace scheme::complaint;
+  auto bob = CapiObject<Bob<BobData>>::Get(c_bob);
+  if (!bob) return false;
+
+  try {
+    return bob->SaveDecrypted(file);
+  } catch (std::exception&) {
+    return false;
+  }
+}
+
+EXPORT bool E_PlainComplaintBobFree(handle_t c_bob) {
+  using namespace scheme::plain;
+  using namespace scheme::complaint;
+  return CapiObject<Bob<BobData>>::Del(c_bob);
+}
+}  // extern "C" complaint
+
+// atomic_swap
+namespace {
+bool PlainAtomicSwapAliceOnRequest(handle_t c_alice, CapiIn const& request_msg,
+                                   CapiOut const& response_msg) {
+  using namespace scheme::plain;
+  using namespace scheme::atomic_swap;
+  auto alice = CapiObject<Alice<AliceData>>::Get(c_alice);
+  if (!alice) return false;
+
+  try {
+    Request request;
+    CapiLoadJson(request_msg, request);
+
+    Response response;
+    if (!alice->OnRequest(request, response)) return false;
+
+    CapiSaveBin(response_msg, response);
   } catch (std::exception&) {
     return false;
   }
@@ -510,34 +520,91 @@ EXPORT bool E_PlainAtomicSwapBobOnSecret(handle_t c_bob,
   return true;
 }
 
-EXPORT bool E_PlainAtomicSwapBobSaveDecrypted(handle_t c_bob,
-                                              char const* file) {
+bool PlainAtomicSwapAliceOnReceipt(handle_t c_alice, CapiIn const& receipt_msg,
+                                   CapiOut const& secret_msg) {
+  using namespace scheme::plain;
+  using namespace scheme::atomic_swap;
+  auto alice = CapiObject<Alice<AliceData>>::Get(c_alice);
+  if (!alice) return false;
+
+  try {
+    Receipt receipt;
+    CapiLoadJson(receipt_msg, receipt);
+
+    Secret secret;
+    if (!alice->OnReceipt(receipt, secret)) return false;
+
+    CapiSaveJson(secret_msg, secret);
+  } catch (std::exception&) {
+    return false;
+  }
+
+  return true;
+}
+
+bool PlainAtomicSwapBobGetRequest(handle_t c_bob, CapiOut const& request_msg) {
   using namespace scheme::plain;
   using namespace scheme::atomic_swap;
   auto bob = CapiObject<Bob<BobData>>::Get(c_bob);
   if (!bob) return false;
 
   try {
-    return bob->SaveDecrypted(file);
+    Request request;
+    bob->GetRequest(request);
+    CapiSaveJson(request_msg, request);
   } catch (std::exception&) {
     return false;
   }
+
+  return true;
 }
 
-EXPORT bool E_PlainAtomicSwapBobFree(handle_t c_bob) {
+bool PlainAtomicSwapBobOnResponse(handle_t c_bob, CapiIn const& response_msg,
+                                  CapiOut const& receipt_msg) {
   using namespace scheme::plain;
   using namespace scheme::atomic_swap;
-  return CapiObject<Bob<BobData>>::Del(c_bob);
+  auto bob = CapiObject<Bob<BobData>>::Get(c_bob);
+  if (!bob) return false;
+
+  try {
+    Response response;
+    CapiLoadBin(response_msg, response);
+
+    Receipt receipt;
+    if (!bob->OnResponse(std::move(response), receipt)) return false;
+
+    CapiSaveJson(receipt_msg, receipt);
+  } catch (std::exception&) {
+    return false;
+  }
+
+  return true;
 }
-}  // extern "C" atomic_swap
 
-// ot_complaint
+bool PlainAtomicSwapBobOnSecret(handle_t c_bob, CapiIn const& secret_msg) {
+  using namespace scheme::plain;
+  using namespace scheme::atomic_swap;
+  auto bob = CapiObject<Bob<BobData>>::Get(c_bob);
+  if (!bob) return false;
+
+  try {
+    Secret secret;
+    CapiLoadJson(secret_msg, secret);
+    return bob->OnSecret(secret);
+  } catch (std::exception&) {
+    return false;
+  }
+
+  return true;
+}
+}  // namespace
+
 extern "C" {
-EXPORT handle_t E_PlainOtComplaintAliceNew(handle_t c_alice_data,
-                                           uint8_t const* c_self_id,
-                                           uint8_t const* c_peer_id) {
+EXPORT handle_t E_PlainAtomicSwapAliceNew(handle_t c_alice_data,
+                                          uint8_t const* c_self_id,
+                                          uint8_t const* c_peer_id) {
   using namespace scheme::plain;
-  using namespace scheme::ot_complaint;
+  using namespace scheme::atomic_swap;
   AliceDataPtr alice_data = CapiObject<AliceData>::Get(c_alice_data);
   if (!alice_data) return nullptr;
 
@@ -555,8 +622,197 @@ EXPORT handle_t E_PlainOtComplaintAliceNew(handle_t c_alice_data,
   }
 }
 
-EXPORT bool E_PlainOtComplaintAliceGetNegoRequest(handle_t c_alice,
-                                                  char const* request_file) {
+EXPORT bool E_PlainAtomicSwapAliceOnRequest(handle_t c_alice,
+                                            char const* request_file,
+                                            char const* response_file) {
+  return PlainAtomicSwapAliceOnRequest(c_alice, CapiIn(request_file),
+                                       CapiOut(response_file));
+}
+
+EXPORT bool E_PlainAtomicSwapAliceOnRequestBuf(handle_t c_alice,
+                                               buffer_t const* request,
+                                               buffer_t* response,
+                                               alloc_t alloc, void* ctx) {
+  return PlainAtomicSwapAliceOnRequest(c_alice, CapiIn(request),
+                                       CapiOut(response, alloc, ctx));
+}
+
+EXPORT bool E_PlainAtomicSwapAliceOnRequestAsync(handle_t c_alice,
+                                                 char const* request_file,
+                                                 char const* response_file,
+                                                 handle_t c_task) {
+  std::string request(request_file);
+  std::string response(response_file);
+  return CapiAsync(c_task, [=]() {
+    return PlainAtomicSwapAliceOnRequest(c_alice, CapiIn(request.c_str()),
+                                         CapiOut(response.c_str()));
+  });
+}
+
+EXPORT bool E_PlainAtomicSwapAliceOnRequestBufAsync(handle_t c_alice,
+                                                    buffer_t const* request,
+                                                    buffer_t* response,
+                                                    alloc_t alloc, void* ctx,
+                                                    handle_t c_task) {
+  return CapiAsync(c_task, [=]() {
+    return PlainAtomicSwapAliceOnRequest(c_alice, CapiIn(request),
+                                         CapiOut(response, alloc, ctx));
+  });
+}
+
+EXPORT bool E_PlainAtomicSwapAliceOnReceipt(handle_t c_alice,
+                                            char const* receipt_file,
+                                            char const* secret_file) {
+  return PlainAtomicSwapAliceOnReceipt(c_alice, CapiIn(receipt_file),
+                                       CapiOut(secret_file));
+}
+
+EXPORT bool E_PlainAtomicSwapAliceOnReceiptBuf(handle_t c_alice,
+                                               buffer_t const* receipt,
+                                               buffer_t* secret, alloc_t alloc,
+                                               void* ctx) {
+  return PlainAtomicSwapAliceOnReceipt(c_alice, CapiIn(receipt),
+                                       CapiOut(secret, alloc, ctx));
+}
+
+EXPORT bool E_PlainAtomicSwapAliceSetEvil(handle_t c_alice) {
+  using namespace scheme::plain;
+  using namespace scheme::atomic_swap;
+  auto alice = CapiObject<Alice<AliceData>>::Get(c_alice);
+  if (!alice) return false;
+  alice->TestSetEvil();
+  return true;
+}
+
+EXPORT bool E_PlainAtomicSwapAliceFree(handle_t c_alice) {
+  using namespace scheme::plain;
+  using namespace scheme::atomic_swap;
+  return CapiObject<Alice<AliceData>>::Del(c_alice);
+}
+
+EXPORT handle_t E_PlainAtomicSwapBobNew(handle_t c_bob_data,
+                                        uint8_t const* c_self_id,
+                                        uint8_t const* c_peer_id,
+                                        range_t const* c_demand,
+                                        uint64_t c_demand_count) {
+  using namespace scheme::plain;
+  using namespace scheme::atomic_swap;
+  BobDataPtr bob_data = CapiObject<BobData>::Get(c_bob_data);
+  if (!bob_data) return nullptr;
+
+  h256_t self_id;
+  memcpy(self_id.data(), c_self_id, h256_t::size_value);
+  h256_t peer_id;
+  memcpy(peer_id.data(), c_peer_id, h256_t::size_value);
+
+  std::vector<Range> demands(c_demand_count);
+  for (uint64_t i = 0; i < c_demand_count; ++i) {
+    demands[i].start = c_demand[i].start;
+    demands[i].count = c_demand[i].count;
+  }
+
+  try {
+    auto p = new Bob<BobData>(bob_data, self_id, peer_id, std::move(demands));
+    CapiObject<Bob<BobData>>::Add(p);
+    return p;
+  } catch (std::exception&) {
+    return nullptr;
+  }
+}
+
+EXPORT bool E_PlainAtomicSwapBobSetG1Uncompressed(handle_t c_bob,
+                                                  bool uncompressed) {
+  using namespace scheme::plain;
+  using namespace scheme::atomic_swap;
+  auto bob = CapiObject<Bob<BobData>>::Get(c_bob);
+  if (!bob) return false;
+  bob->SetG1Uncompressed(uncompressed);
+  return true;
+}
+
+EXPORT bool E_PlainAtomicSwapBobGetRequest(handle_t c_bob,
+                                           char const* request_file) {
+  return PlainAtomicSwapBobGetRequest(c_bob, CapiOut(request_file));
+}
+
+EXPORT bool E_PlainAtomicSwapBobGetRequestBuf(handle_t c_bob, buffer_t* request,
+                                              alloc_t alloc, void* ctx) {
+  return PlainAtomicSwapBobGetRequest(c_bob, CapiOut(request, alloc, ctx));
+}
+
+EXPORT bool E_PlainAtomicSwapBobOnResponse(handle_t c_bob,
+                                           char const* response_file,
+                                           char const* receipt_file) {
+  return PlainAtomicSwapBobOnResponse(c_bob, CapiIn(response_file),
+                                      CapiOut(receipt_file));
+}
+
+EXPORT bool E_PlainAtomicSwapBobOnResponseBuf(handle_t c_bob,
+                                              buffer_t const* response,
+                                              buffer_t* receipt, alloc_t alloc,
+                                              void* ctx) {
+  return PlainAtomicSwapBobOnResponse(c_bob, CapiIn(response),
+                                      CapiOut(receipt, alloc, ctx));
+}
+
+EXPORT bool E_PlainAtomicSwapBobOnResponseAsync(handle_t c_bob,
+                                                char const* response_file,
+                                                char const* receipt_file,
+                                                handle_t c_task) {
+  std::string response(response_file);
+  std::string receipt(receipt_file);
+  return CapiAsync(c_task, [=]() {
+    return PlainAtomicSwapBobOnResponse(c_bob, CapiIn(response.c_str()),
+                                        CapiOut(receipt.c_str()));
+  });
+}
+
+EXPORT bool E_PlainAtomicSwapBobOnResponseBufAsync(handle_t c_bob,
+                                                   buffer_t const* response,
+                                                   buffer_t* receipt,
+                                                   alloc_t alloc, void* ctx,
+                                                   handle_t c_task) {
+  return CapiAsync(c_task, [=]() {
+    return PlainAtomicSwapBobOnResponse(c_bob, CapiIn(response),
+                                        CapiOut(receipt, alloc, ctx));
+  });
+}
+
+EXPORT bool E_PlainAtomicSwapBobOnSecret(handle_t c_bob,
+                                         char const* secret_file) {
+  return PlainAtomicSwapBobOnSecret(c_bob, CapiIn(secret_file));
+}
+
+EXPORT bool E_PlainAtomicSwapBobOnSecretBuf(handle_t c_bob,
+                                            buffer_t const* secret) {
+  return PlainAtomicSwapBobOnSecret(c_bob, CapiIn(secret));
+}
+
+EXPORT bool E_PlainAtomicSwapBobSaveDecrypted(handle_t c_bob,
+                                              char const* file) {
+  using namespace scheme::plain;
+  using namespace scheme::atomic_swap;
+  auto bob = CapiObject<Bob<BobData>>::Get(c_bob);
+  if (!bob) return false;
+
+  try {
+    return bob->SaveDecrypted(file);
+  } catch (std::exception&) {
+    return false;
+  }
+}
+
+EXPORT bool E_PlainAtomicSwapBobFree(handle_t c_bob) {
+  using namespace scheme::plain;
+  using namespace scheme::atomic_swap;
+  return CapiObject<Bob<BobData>>::Del(c_bob);
+}
+}  // extern "C" atomic_swap
+
+// ot_complaint
+namespace {
+bool PlainOtComplaintAliceGetNegoRequest(handle_t c_alice,
+                                         CapiOut const& request_msg) {
   using namespace scheme::plain;
   using namespace scheme::ot_complaint;
   auto alice = CapiObject<Alice<AliceData>>::Get(c_alice);
@@ -565,9 +821,7 @@ EXPORT bool E_PlainOtComplaintAliceGetNegoRequest(handle_t c_alice,
   try {
     NegoARequest request;
     alice->GetNegoReqeust(request);
-    yas::file_ostream os(request_file);
-    yas::binary_oarchive<yas::file_ostream, YasBinF()> oa(os);
-    oa.serialize(request);
+    CapiSaveBin(request_msg, request);
   } catch (std::exception&) {
     return false;
   }
@@ -575,9 +829,9 @@ EXPORT bool E_PlainOtComplaintAliceGetNegoRequest(handle_t c_alice,
   return true;
 }
 
-EXPORT bool E_PlainOtComplaintAliceOnNegoRequest(handle_t c_alice,
-                                                 char const* request_file,
-                                                 char const* response_file) {
+bool PlainOtComplaintAliceOnNegoRequest(handle_t c_alice,
+                                        CapiIn const& request_msg,
+                                        CapiOut const& response_msg) {
   using namespace scheme::plain;
   using namespace scheme::ot_complaint;
   auto alice = CapiObject<Alice<AliceData>>::Get(c_alice);
@@ -585,96 +839,327 @@ EXPORT bool E_PlainOtComplaintAliceOnNegoRequest(handle_t c_alice,
 
   try {
     NegoBRequest request;
-    yas::file_istream is(request_file);
-    yas::binary_iarchive<yas::file_istream, YasBinF()> ia(is);
-    ia.serialize(request);
+    CapiLoadBin(request_msg, request);
 
     NegoBResponse response;
     if (!alice->OnNegoRequest(request, response)) return false;
 
-    yas::file_ostream os(response_file);
-    yas::binary_oarchive<yas::file_ostream, YasBinF()> oa(os);
-    oa.serialize(response);
+    CapiSaveBin(response_msg, response);
+  } catch (std::exception&) {
+    return false;
+  }
+
+  return true;
+}
+
+bool PlainOtComplaintAliceOnNegoResponse(handle_t c_alice,
+                                         CapiIn const& response_msg) {
+  using namespace scheme::plain;
+  using namespace scheme::ot_complaint;
+  auto alice = CapiObject<Alice<AliceData>>::Get(c_alice);
+  if (!alice) return false;
+
+  try {
+    NegoAResponse response;
+    CapiLoadBin(response_msg, response);
+
+    if (!alice->OnNegoResponse(response)) return false;
+  } catch (std::exception&) {
+    return false;
+  }
+
+  return true;
+}
+
+bool PlainOtComplaintAliceOnRequest(handle_t c_alice, CapiIn const& request_msg,
+                                    CapiOut const& response_msg) {
+  using namespace scheme::plain;
+  using namespace scheme::ot_complaint;
+  auto alice = CapiObject<Alice<AliceData>>::Get(c_alice);
+  if (!alice) return false;
+
+  try {
+    Request request;
+    CapiLoadJson(request_msg, request);
+
+    Response response;
+    if (!alice->OnRequest(request, response)) return false;
+
+    CapiSaveBin(response_msg, response);
+  } catch (std::exception&) {
+    return false;
+  }
+
+  return true;
+}
+
+bool PlainOtComplaintAliceOnReceipt(handle_t c_alice, CapiIn const& receipt_msg,
+                                    CapiOut const& secret_msg) {
+  using namespace scheme::plain;
+  using namespace scheme::ot_complaint;
+  auto alice = CapiObject<Alice<AliceData>>::Get(c_alice);
+  if (!alice) return false;
+
+  try {
+    Receipt receipt;
+    CapiLoadJson(receipt_msg, receipt);
+
+    Secret secret;
+    if (!alice->OnReceipt(receipt, secret)) return false;
+
+    CapiSaveJson(secret_msg, secret);
+  } catch (std::exception&) {
+    return false;
+  }
+
+  return true;
+}
+
+bool PlainOtComplaintBobGetNegoRequest(handle_t c_bob,
+                                       CapiOut const& request_msg) {
+  using namespace scheme::plain;
+  using namespace scheme::ot_complaint;
+  auto bob = CapiObject<Bob<BobData>>::Get(c_bob);
+  if (!bob) return false;
+
+  try {
+    NegoBRequest request;
+    bob->GetNegoReqeust(request);
+    CapiSaveBin(request_msg, request);
+  } catch (std::exception&) {
+    return false;
+  }
+
+  return true;
+}
+
+bool PlainOtComplaintBobOnNegoRequest(handle_t c_bob, CapiIn const& request_msg,
+                                      CapiOut const& response_msg) {
+  using namespace scheme::plain;
+  using namespace scheme::ot_complaint;
+  auto bob = CapiObject<Bob<BobData>>::Get(c_bob);
+  if (!bob) return false;
+
+  try {
+    NegoARequest request;
+    CapiLoadBin(request_msg, request);
+
+    NegoAResponse response;
+    if (!bob->OnNegoRequest(request, response)) return false;
+
+    CapiSaveBin(response_msg, response);
   } catch (std::exception&) {
     return false;
   }
 
-  return true;
+  return true;
+}
+
+bool PlainOtComplaintBobOnNegoResponse(handle_t c_bob,
+                                       CapiIn const& response_msg) {
+  using namespace scheme::plain;
+  using namespace scheme::ot_complaint;
+  auto bob = CapiObject<Bob<BobData>>::Get(c_bob);
+  if (!bob) return false;
+
+  try {
+    NegoBResponse response;
+    CapiLoadBin(response_msg, response);
+    return bob->OnNegoResponse(response);
+  } catch (std::exception&) {
+    return false;
+  }
+
+  return true;
+}
+
+bool PlainOtComplaintBobGetRequest(handle_t c_bob, CapiOut const& request_msg) {
+  using namespace scheme::plain;
+  using namespace scheme::ot_complaint;
+  auto bob = CapiObject<Bob<BobData>>::Get(c_bob);
+  if (!bob) return false;
+
+  try {
+    Request request;
+    bob->GetRequest(request);
+    CapiSaveJson(request_msg, request);
+  } catch (std::exception&) {
+    return false;
+  }
+
+  return true;
+}
+
+bool PlainOtComplaintBobOnResponse(handle_t c_bob, CapiIn const& response_msg,
+                                   CapiOut const& receipt_msg) {
+  using namespace scheme::plain;
+  using namespace scheme::ot_complaint;
+  auto bob = CapiObject<Bob<BobData>>::Get(c_bob);
+  if (!bob) return false;
+
+  try {
+    Response response;
+    CapiLoadBin(response_msg, response);
+
+    Receipt receipt;
+    if (!bob->OnResponse(std::move(response), receipt)) return false;
+
+    CapiSaveJson(receipt_msg, receipt);
+  } catch (std::exception&) {
+    return false;
+  }
+
+  return true;
+}
+
+bool PlainOtComplaintBobOnSecret(handle_t c_bob, CapiIn const& secret_msg) {
+  using namespace scheme::plain;
+  using namespace scheme::ot_complaint;
+  auto bob = CapiObject<Bob<BobData>>::Get(c_bob);
+  if (!bob) return false;
+
+  try {
+    Secret secret;
+    CapiLoadJson(secret_msg, secret);
+    return bob->OnSecret(secret);
+  } catch (std::exception&) {
+    return false;
+  }
+
+  return true;
+}
+
+bool PlainOtComplaintBobGenerateClaim(handle_t c_bob,
+                                      CapiOut const& claim_msg) {
+  using namespace scheme::plain;
+  using namespace scheme::ot_complaint;
+  auto bob = CapiObject<Bob<BobData>>::Get(c_bob);
+  if (!bob) return false;
+
+  try {
+    Claim claim;
+    if (!bob->GenerateClaim(claim)) return false;
+
+    CapiSaveJson(claim_msg, claim);
+  } catch (std::exception&) {
+    return false;
+  }
+
+  return true;
+}
+}  // namespace
+
+extern "C" {
+EXPORT handle_t E_PlainOtComplaintAliceNew(handle_t c_alice_data,
+                                           uint8_t const* c_self_id,
+                                           uint8_t const* c_peer_id) {
+  using namespace scheme::plain;
+  using namespace scheme::ot_complaint;
+  AliceDataPtr alice_data = CapiObject<AliceData>::Get(c_alice_data);
+  if (!alice_data) return nullptr;
+
+  h256_t self_id;
+  memcpy(self_id.data(), c_self_id, h256_t::size_value);
+  h256_t peer_id;
+  memcpy(peer_id.data(), c_peer_id, h256_t::size_value);
+
+  try {
+    auto p = new Alice<AliceData>(alice_data, self_id, peer_id);
+    CapiObject<Alice<AliceData>>::Add(p);
+    return p;
+  } catch (std::exception&) {
+    return nullptr;
+  }
+}
+
+EXPORT bool E_PlainOtComplaintAliceGetNegoRequest(handle_t c_alice,
+                                                  char const* request_file) {
+  return PlainOtComplaintAliceGetNegoRequest(c_alice, CapiOut(request_file));
+}
+
+EXPORT bool E_PlainOtComplaintAliceGetNegoRequestBuf(handle_t c_alice,
+                                                     buffer_t* request,
+                                                     alloc_t alloc, void* ctx) {
+  return PlainOtComplaintAliceGetNegoRequest(c_alice,
+                                             CapiOut(request, alloc, ctx));
+}
+
+EXPORT bool E_PlainOtComplaintAliceOnNegoRequest(handle_t c_alice,
+                                                 char const* request_file,
+                                                 char const* response_file) {
+  return PlainOtComplaintAliceOnNegoRequest(c_alice, CapiIn(request_file),
+                                            CapiOut(response_file));
+}
+
+EXPORT bool E_PlainOtComplaintAliceOnNegoRequestBuf(handle_t c_alice,
+                                                    buffer_t const* request,
+                                                    buffer_t* response,
+                                                    alloc_t alloc, void* ctx) {
+  return PlainOtComplaintAliceOnNegoRequest(c_alice, CapiIn(request),
+                                            CapiOut(response, alloc, ctx));
 }
 
 EXPORT bool E_PlainOtComplaintAliceOnNegoResponse(handle_t c_alice,
                                                   char const* response_file) {
-  using namespace scheme::plain;
-  using namespace scheme::ot_complaint;
-  auto alice = CapiObject<Alice<AliceData>>::Get(c_alice);
-  if (!alice) return false;
-
-  try {
-    NegoAResponse response;
-    yas::file_istream is(response_file);
-    yas::binary_iarchive<yas::file_istream, YasBinF()> ia(is);
-    ia.serialize(response);
-
-    if (!alice->OnNegoResponse(response)) return false;
-  } catch (std::exception&) {
-    return false;
-  }
+  return PlainOtComplaintAliceOnNegoResponse(c_alice, CapiIn(response_file));
+}
 
-  return true;
+EXPORT bool E_PlainOtComplaintAliceOnNegoResponseBuf(handle_t c_alice,
+                                                     buffer_t const* response) {
+  return PlainOtComplaintAliceOnNegoResponse(c_alice, CapiIn(response));
 }
 
 EXPORT bool E_PlainOtComplaintAliceOnRequest(handle_t c_alice,
                                              char const* request_file,
                                              char const* response_file) {
-  using namespace scheme::plain;
-  using namespace scheme::ot_complaint;
-  auto alice = CapiObject<Alice<AliceData>>::Get(c_alice);
-  if (!alice) return false;
-
-  try {
-    Request request;
-    yas::file_istream is(request_file);
-    yas::json_iarchive<yas::file_istream> ia(is);
-    ia.serialize(request);
+  return PlainOtComplaintAliceOnRequest(c_alice, CapiIn(request_file),
+                                        CapiOut(response_file));
+}
 
-    Response response;
-    if (!alice->OnRequest(request, response)) return false;
+EXPORT bool E_PlainOtComplaintAliceOnRequestBuf(handle_t c_alice,
+                                                buffer_t const* request,
+                                                buffer_t* response,
+                                                alloc_t alloc, void* ctx) {
+  return PlainOtComplaintAliceOnRequest(c_alice, CapiIn(request),
+                                        CapiOut(response, alloc, ctx));
+}
 
-    yas::file_ostream os(response_file);
-    yas::binary_oarchive<yas::file_ostream, YasBinF()> oa(os);
-    oa.serialize(response);
-  } catch (std::exception&) {
-    return false;
-  }
+EXPORT bool E_PlainOtComplaintAliceOnRequestAsync(handle_t c_alice,
+                                                  char const* request_file,
+                                                  char const* response_file,
+                                                  handle_t c_task) {
+  std::string request(request_file);
+  std::string response(response_file);
+  return CapiAsync(c_task, [=]() {
+    return PlainOtComplaintAliceOnRequest(c_alice, CapiIn(request.c_str()),
+                                          CapiOut(response.c_str()));
+  });
+}
 
-  return true;
+EXPORT bool E_PlainOtComplaintAliceOnRequestBufAsync(handle_t c_alice,
+                                                     buffer_t const* request,
+                                                     buffer_t* response,
+                                                     alloc_t alloc, void* ctx,
+                                                     handle_t c_task) {
+  return CapiAsync(c_task, [=]() {
+    return PlainOtComplaintAliceOnRequest(c_alice, CapiIn(request),
+                                          CapiOut(response, alloc, ctx));
+  });
 }
 
 EXPORT bool E_PlainOtComplaintAliceOnReceipt(handle_t c_alice,
                                              char const* receipt_file,
                                              char const* secret_file) {
-  using namespace scheme::plain;
-  using namespace scheme::ot_complaint;
-  auto alice = CapiObject<Alice<AliceData>>::Get(c_alice);
-  if (!alice) return false;
-
-  try {
-    Receipt receipt;
-    yas::file_istream is(receipt_file);
-    yas::json_iarchive<yas::file_istream> ia(is);
-    ia.serialize(receipt);
-
-    Secret secret;
-    if (!alice->OnReceipt(receipt, secret)) return false;
-
-    yas::file_ostream os(secret_file);
-    yas::json_oarchive<yas::file_ostream> oa(os);
-    oa.serialize(secret);
-  } catch (std::exception&) {
-    return false;
-  }
+  return PlainOtComplaintAliceOnReceipt(c_alice, CapiIn(receipt_file),
+                                        CapiOut(secret_file));
+}
 
-  return true;
+EXPORT bool E_PlainOtComplaintAliceOnReceiptBuf(handle_t c_alice,
+                                                buffer_t const* receipt,
+                                                buffer_t* secret, alloc_t alloc,
+                                                void* ctx) {
+  return PlainOtComplaintAliceOnReceipt(c_alice, CapiIn(receipt),
+                                        CapiOut(secret, alloc, ctx));
 }
 
 EXPORT bool E_PlainOtComplaintAliceSetEvil(handle_t c_alice) {
@@ -730,84 +1215,159 @@ EXPORT handle_t E_PlainOtComplaintBobNew(
 
 EXPORT bool E_PlainOtComplaintBobGetNegoRequest(handle_t c_bob,
                                                 char const* request_file) {
-  using namespace scheme::plain;
-  using namespace scheme::ot_complaint;
-  auto bob = CapiObject<Bob<BobData>>::Get(c_bob);
-  if (!bob) return false;
-
-  try {
-    NegoBRequest request;
-    bob->GetNegoReqeust(request);
-    yas::file_ostream os(request_file);
-    yas::binary_oarchive<yas::file_ostream, YasBinF()> oa(os);
-    oa.serialize(request);
-  } catch (std::exception&) {
-    return false;
-  }
+  return PlainOtComplaintBobGetNegoRequest(c_bob, CapiOut(request_file));
+}
 
-  return true;
+EXPORT bool E_PlainOtComplaintBobGetNegoRequestBuf(handle_t c_bob,
+                                                   buffer_t* request,
+                                                   alloc_t alloc, void* ctx) {
+  return PlainOtComplaintBobGetNegoRequest(c_bob, CapiOut(request, alloc, ctx));
 }
 
 EXPORT bool E_PlainOtComplaintBobOnNegoRequest(handle_t c_bob,
                                                char const* request_file,
                                                char const* response_file) {
+  return PlainOtComplaintBobOnNegoRequest(c_bob, CapiIn(request_file),
+                                          CapiOut(response_file));
+}
+
+EXPORT bool E_PlainOtComplaintBobOnNegoRequestBuf(handle_t c_bob,
+                                                  buffer_t const* request,
+                                                  buffer_t* response,
+                                                  alloc_t alloc, void* ctx) {
+  return PlainOtComplaintBobOnNegoRequest(c_bob, CapiIn(request),
+                                          CapiOut(response, alloc, ctx));
+}
+
+EXPORT bool E_PlainOtComplaintBobOnNegoResponse(handle_t c_bob,
+                                                char const* response_file) {
+  return PlainOtComplaintBobOnNegoResponse(c_bob, CapiIn(response_file));
+}
+
+EXPORT bool E_PlainOtComplaintBobOnNegoResponseBuf(handle_t c_bob,
+                                                   buffer_t const* response) {
+  return PlainOtComplaintBobOnNegoResponse(c_bob, CapiIn(response));
+}
+
+EXPORT bool E_PlainOtComplaintBobSetG1Uncompressed(handle_t c_bob,
+                                                   bool uncompressed) {
   using namespace scheme::plain;
   using namespace scheme::ot_complaint;
   auto bob = CapiObject<Bob<BobData>>::Get(c_bob);
   if (!bob) return false;
+  bob->SetG1Uncompressed(uncompressed);
+  return true;
+}
 
-  try {
-    NegoARequest request;
-    yas::file_istream is(request_file);
-    yas::binary_iarchive<yas::file_istream, YasBinF()> ia(is);
-    ia.serialize(request);
+EXPORT bool E_PlainOtComplaintBobGetRequest(handle_t c_bob,
+                                            char const* request_file) {
+  return PlainOtComplaintBobGetRequest(c_bob, CapiOut(request_file));
+}
 
-    NegoAResponse response;
-    if (!bob->OnNegoRequest(request, response)) return false;
+EXPORT bool E_PlainOtComplaintBobGetRequestBuf(handle_t c_bob,
+                                               buffer_t* request, alloc_t alloc,
+                                               void* ctx) {
+  return PlainOtComplaintBobGetRequest(c_bob, CapiOut(request, alloc, ctx));
+}
 
-    yas::file_ostream os(response_file);
-    yas::binary_oarchive<yas::file_ostream, YasBinF()> oa(os);
-    oa.serialize(response);
-  } catch (std::exception&) {
-    return false;
-  }
+EXPORT bool E_PlainOtComplaintBobOnResponse(handle_t c_bob,
+                                            char const* response_file,
+                                            char const* receipt_file) {
+  return PlainOtComplaintBobOnResponse(c_bob, CapiIn(response_file),
+                                       CapiOut(receipt_file));
+}
 
-  return true;
+EXPORT bool E_PlainOtComplaintBobOnResponseBuf(handle_t c_bob,
+                                               buffer_t const* response,
+                                               buffer_t* receipt, alloc_t alloc,
+                                               void* ctx) {
+  return PlainOtComplaintBobOnResponse(c_bob, CapiIn(response),
+                                       CapiOut(receipt, alloc, ctx));
 }
 
-EXPORT bool E_PlainOtComplaintBobOnNegoResponse(handle_t c_bob,
-                                                char const* response_file) {
+EXPORT bool E_PlainOtComplaintBobOnResponseAsync(handle_t c_bob,
+                                                 char const* response_file,
+                                                 char const* receipt_file,
+                                                 handle_t c_task) {
+  std::string response(response_file);
+  std::string receipt(receipt_file);
+  return CapiAsync(c_task, [=]() {
+    return PlainOtComplaintBobOnResponse(c_bob, CapiIn(response.c_str()),
+                                         CapiOut(receipt.c_str()));
+  });
+}
+
+EXPORT bool E_PlainOtComplaintBobOnResponseBufAsync(handle_t c_bob,
+                                                    buffer_t const* response,
+                                                    buffer_t* receipt,
+                                                    alloc_t alloc, void* ctx,
+                                                    handle_t c_task) {
+  return CapiAsync(c_task, [=]() {
+    return PlainOtComplaintBobOnResponse(c_bob, CapiIn(response),
+                                         CapiOut(receipt, alloc, ctx));
+  });
+}
+
+EXPORT bool E_PlainOtComplaintBobOnSecret(handle_t c_bob,
+                                          char const* secret_file) {
+  return PlainOtComplaintBobOnSecret(c_bob, CapiIn(secret_file));
+}
+
+EXPORT bool E_PlainOtComplaintBobOnSecretBuf(handle_t c_bob,
+                                             buffer_t const* secret) {
+  return PlainOtComplaintBobOnSecret(c_bob, CapiIn(secret));
+}
+
+EXPORT bool E_PlainOtComplaintBobGenerateClaim(handle_t c_bob,
+                                               char const* claim_file) {
+  return PlainOtComplaintBobGenerateClaim(c_bob, CapiOut(claim_file));
+}
+
+EXPORT bool E_PlainOtComplaintBobGenerateClaimBuf(handle_t c_bob,
+                                                  buffer_t* claim,
+                                                  alloc_t alloc, void* ctx) {
+  return PlainOtComplaintBobGenerateClaim(c_bob, CapiOut(claim, alloc, ctx));
+}
+
+EXPORT bool E_PlainOtComplaintBobSaveDecrypted(handle_t c_bob,
+                                               char const* file) {
   using namespace scheme::plain;
   using namespace scheme::ot_complaint;
   auto bob = CapiObject<Bob<BobData>>::Get(c_bob);
   if (!bob) return false;
 
   try {
-    NegoBResponse response;
-    yas::file_istream is(response_file);
-    yas::binary_iarchive<yas::file_istream, YasBinF()> ia(is);
-    ia.serialize(response);
-    return bob->OnNegoResponse(response);
+    return bob->SaveDecrypted(file);
   } catch (std::exception&) {
     return false;
   }
-
-  return true;
 }
 
-EXPORT bool E_PlainOtComplaintBobGetRequest(handle_t c_bob,
-                                            char const* request_file) {
+EXPORT bool E_PlainOtComplaintBobFree(handle_t c_bob) {
   using namespace scheme::plain;
   using namespace scheme::ot_complaint;
-  auto bob = CapiObject<Bob<BobData>>::Get(c_bob);
-  if (!bob) return false;
+  return CapiObject<Bob<BobData>>::Del(c_bob);
+}
+}  // extern "C" ot_complaint
+
+// atomic_swap_vc
+namespace {
+bool PlainAtomicSwapVcAliceOnRequest(handle_t c_alice,
+                                     CapiIn const& request_msg,
+                                     CapiOut const& response_msg) {
+  using namespace scheme::plain;
+  using namespace scheme::atomic_swap_vc;
+  auto alice = CapiObject<Alice<AliceData>>::Get(c_alice);
+  if (!alice) return false;
 
   try {
     Request request;
-    bob->GetRequest(request);
-    yas::file_ostream os(request_file);
-    yas::json_oarchive<yas::file_ostream> oa(os);
-    oa.serialize(request);
+    CapiLoadJson(request_msg, request);
+
+    Response response;
+    if (!alice->OnRequest(request, response)) return false;
+
+    CapiSaveBin(response_msg, response);
   } catch (std::exception&) {
     return false;
   }
@@ -815,26 +1375,22 @@ EXPORT bool E_PlainOtComplaintBobGetRequest(handle_t c_bob,
   return true;
 }
 
-EXPORT bool E_PlainOtComplaintBobOnResponse(handle_t c_bob,
-                                            char const* response_file,
-                                            char const* receipt_file) {
+bool PlainAtomicSwapVcAliceOnReceipt(handle_t c_alice,
+                                     CapiIn const& receipt_msg,
+                                     CapiOut const& secret_msg) {
   using namespace scheme::plain;
-  using namespace scheme::ot_complaint;
-  auto bob = CapiObject<Bob<BobData>>::Get(c_bob);
-  if (!bob) return false;
+  using namespace scheme::atomic_swap_vc;
+  auto alice = CapiObject<Alice<AliceData>>::Get(c_alice);
+  if (!alice) return false;
 
   try {
-    Response response;
-    yas::file_istream is(response_file);
-    yas::binary_iarchive<yas::file_istream, YasBinF()> ia(is);
-    ia.serialize(response);
-
     Receipt receipt;
-    if (!bob->OnResponse(std::move(response), receipt)) return false;
+    CapiLoadJson(receipt_msg, receipt);
+
+    Secret secret;
+    if (!alice->OnReceipt(receipt, secret)) return false;
 
-    yas::file_ostream os(receipt_file);
-    yas::json_oarchive<yas::file_ostream> oa(os);
-    oa.serialize(receipt);
+    CapiSaveJson(secret_msg, secret);
   } catch (std::exception&) {
     return false;
   }
@@ -842,19 +1398,17 @@ EXPORT bool E_PlainOtComplaintBobOnResponse(handle_t c_bob,
   return true;
 }
 
-EXPORT bool E_PlainOtComplaintBobOnSecret(handle_t c_bob,
-                                          char const* secret_file) {
+bool PlainAtomicSwapVcBobGetRequest(handle_t c_bob,
+                                    CapiOut const& request_msg) {
   using namespace scheme::plain;
-  using namespace scheme::ot_complaint;
+  using namespace scheme::atomic_swap_vc;
   auto bob = CapiObject<Bob<BobData>>::Get(c_bob);
   if (!bob) return false;
 
   try {
-    Secret secret;
-    yas::file_istream is(secret_file);
-    yas::json_iarchive<yas::file_istream> ia(is);
-    ia.serialize(secret);
-    return bob->OnSecret(secret);
+    Request request;
+    bob->GetRequest(request);
+    CapiSaveJson(request_msg, request);
   } catch (std::exception&) {
     return false;
   }
@@ -862,20 +1416,21 @@ EXPORT bool E_PlainOtComplaintBobOnSecret(handle_t c_bob,
   return true;
 }
 
-EXPORT bool E_PlainOtComplaintBobGenerateClaim(handle_t c_bob,
-                                               char const* claim_file) {
+bool PlainAtomicSwapVcBobOnResponse(handle_t c_bob, CapiIn const& response_msg,
+                                    CapiOut const& receipt_msg) {
   using namespace scheme::plain;
-  using namespace scheme::ot_complaint;
+  using namespace scheme::atomic_swap_vc;
   auto bob = CapiObject<Bob<BobData>>::Get(c_bob);
   if (!bob) return false;
 
   try {
-    Claim claim;
-    if (!bob->GenerateClaim(claim)) return false;
+    Response response;
+    CapiLoadBin(response_msg, response);
+
+    Receipt receipt;
+    if (!bob->OnResponse(std::move(response), receipt)) return false;
 
-    yas::file_ostream os(claim_file);
-    yas::json_oarchive<yas::file_ostream> oa(os);
-    oa.serialize(claim);
+    CapiSaveJson(receipt_msg, receipt);
   } catch (std::exception&) {
     return false;
   }
@@ -883,28 +1438,24 @@ EXPORT bool E_PlainOtComplaintBobGenerateClaim(handle_t c_bob,
   return true;
 }
 
-EXPORT bool E_PlainOtComplaintBobSaveDecrypted(handle_t c_bob,
-                                               char const* file) {
+bool PlainAtomicSwapVcBobOnSecret(handle_t c_bob, CapiIn const& secret_msg) {
   using namespace scheme::plain;
-  using namespace scheme::ot_complaint;
+  using namespace scheme::atomic_swap_vc;
   auto bob = CapiObject<Bob<BobData>>::Get(c_bob);
   if (!bob) return false;
 
   try {
-    return bob->SaveDecrypted(file);
+    Secret secret;
+    CapiLoadJson(secret_msg, secret);
+    return bob->OnSecret(secret);
   } catch (std::exception&) {
     return false;
   }
-}
 
-EXPORT bool E_PlainOtComplaintBobFree(handle_t c_bob) {
-  using namespace scheme::plain;
-  using namespace scheme::ot_complaint;
-  return CapiObject<Bob<BobData>>::Del(c_bob);
+  return true;
 }
-}  // extern "C" ot_complaint
+}  // namespace
 
-// atomic_swap_vc
 extern "C" {
 EXPORT handle_t E_PlainAtomicSwapVcAliceNew(handle_t c_alice_data,
                                             uint8_t const* c_self_id,
@@ -931,55 +1482,54 @@ EXPORT handle_t E_PlainAtomicSwapVcAliceNew(handle_t c_alice_data,
 EXPORT bool E_PlainAtomicSwapVcAliceOnRequest(handle_t c_alice,
                                               char const* request_file,
                                               char const* response_file) {
-  using namespace scheme::plain;
-  using namespace scheme::atomic_swap_vc;
-  auto alice = CapiObject<Alice<AliceData>>::Get(c_alice);
-  if (!alice) return false;
-
-  try {
-    Request request;
-    yas::file_istream is(request_file);
-    yas::json_iarchive<yas::file_istream> ia(is);
-    ia.serialize(request);
+  return PlainAtomicSwapVcAliceOnRequest(c_alice, CapiIn(request_file),
+                                         CapiOut(response_file));
+}
 
-    Response response;
-    if (!alice->OnRequest(request, response)) return false;
+EXPORT bool E_PlainAtomicSwapVcAliceOnRequestBuf(handle_t c_alice,
+                                                 buffer_t const* request,
+                                                 buffer_t* response,
+                                                 alloc_t alloc, void* ctx) {
+  return PlainAtomicSwapVcAliceOnRequest(c_alice, CapiIn(request),
+                                         CapiOut(response, alloc, ctx));
+}
 
-    yas::file_ostream os(response_file);
-    yas::binary_oarchive<yas::file_ostream, YasBinF()> oa(os);
-    oa.serialize(response);
-  } catch (std::exception&) {
-    return false;
-  }
+EXPORT bool E_PlainAtomicSwapVcAliceOnRequestAsync(handle_t c_alice,
+                                                   char const* request_file,
+                                                   char const* response_file,
+                                                   handle_t c_task) {
+  std::string request(request_file);
+  std::string response(response_file);
+  return CapiAsync(c_task, [=]() {
+    return PlainAtomicSwapVcAliceOnRequest(c_alice, CapiIn(request.c_str()),
+                                           CapiOut(response.c_str()));
+  });
+}
 
-  return true;
+EXPORT bool E_PlainAtomicSwapVcAliceOnRequestBufAsync(handle_t c_alice,
+                                                      buffer_t const* request,
+                                                      buffer_t* response,
+                                                      alloc_t alloc, void* ctx,
+                                                      handle_t c_task) {
+  return CapiAsync(c_task, [=]() {
+    return PlainAtomicSwapVcAliceOnRequest(c_alice, CapiIn(request),
+                                           CapiOut(response, alloc, ctx));
+  });
 }
 
 EXPORT bool E_PlainAtomicSwapVcAliceOnReceipt(handle_t c_alice,
                                               char const* receipt_file,
                                               char const* secret_file) {
-  using namespace scheme::plain;
-  using namespace scheme::atomic_swap_vc;
-  auto alice = CapiObject<Alice<AliceData>>::Get(c_alice);
-  if (!alice) return false;
-
-  try {
-    Receipt receipt;
-    yas::file_istream is(receipt_file);
-    yas::json_iarchive<yas::file_istream> ia(is);
-    ia.serialize(receipt);
-
-    Secret secret;
-    if (!alice->OnReceipt(receipt, secret)) return false;
-
-    yas::file_ostream os(secret_file);
-    yas::json_oarchive<yas::file_ostream> oa(os);
-    oa.serialize(secret);
-  } catch (std::exception&) {
-    return false;
-  }
+  return PlainAtomicSwapVcAliceOnReceipt(c_alice, CapiIn(receipt_file),
+                                         CapiOut(secret_file));
+}
 
-  return true;
+EXPORT bool E_PlainAtomicSwapVcAliceOnReceiptBuf(handle_t c_alice,
+                                                 buffer_t const* receipt,
+                                                 buffer_t* secret,
+                                                 alloc_t alloc, void* ctx) {
+  return PlainAtomicSwapVcAliceOnReceipt(c_alice, CapiIn(receipt),
+                                         CapiOut(secret, alloc, ctx));
 }
 
 EXPORT bool E_PlainAtomicSwapVcAliceSetEvil(handle_t c_alice) {
@@ -1027,71 +1577,73 @@ EXPORT handle_t E_PlainAtomicSwapVcBobNew(handle_t c_bob_data,
   }
 }
 
-EXPORT bool E_PlainAtomicSwapVcBobGetRequest(handle_t c_bob,
-                                             char const* request_file) {
+EXPORT bool E_PlainAtomicSwapVcBobSetG1Uncompressed(handle_t c_bob,
+                                                    bool uncompressed) {
   using namespace scheme::plain;
   using namespace scheme::atomic_swap_vc;
   auto bob = CapiObject<Bob<BobData>>::Get(c_bob);
   if (!bob) return false;
+  bob->SetG1Uncompressed(uncompressed);
+  return true;
+}
 
-  try {
-    Request request;
-    bob->GetRequest(request);
-    yas::file_ostream os(request_file);
-    yas::json_oarchive<yas::file_ostream> oa(os);
-    oa.serialize(request);
-  } catch (std::exception&) {
-    return false;
-  }
+EXPORT bool E_PlainAtomicSwapVcBobGetRequest(handle_t c_bob,
+                                             char const* request_file) {
+  return PlainAtomicSwapVcBobGetRequest(c_bob, CapiOut(request_file));
+}
 
-  return true;
+EXPORT bool E_PlainAtomicSwapVcBobGetRequestBuf(handle_t c_bob,
+                                                buffer_t* request,
+                                                alloc_t alloc, void* ctx) {
+  return PlainAtomicSwapVcBobGetRequest(c_bob, CapiOut(request, alloc, ctx));
 }
 
 EXPORT bool E_PlainAtomicSwapVcBobOnResponse(handle_t c_bob,
                                              char const* response_file,
                                              char const* receipt_file) {
-  using namespace scheme::plain;
-  using namespace scheme::atomic_swap_vc;
-  auto bob = CapiObject<Bob<BobData>>::Get(c_bob);
-  if (!bob) return false;
-
-  try {
-    Response response;
-    yas::file_istream is(response_file);
-    yas::binary_iarchive<yas::file_istream, YasBinF()> ia(is);
-    ia.serialize(response);
+  return PlainAtomicSwapVcBobOnResponse(c_bob, CapiIn(response_file),
+                                        CapiOut(receipt_file));
+}
 
-    Receipt receipt;
-    if (!bob->OnResponse(std::move(response), receipt)) return false;
+EXPORT bool E_PlainAtomicSwapVcBobOnResponseBuf(handle_t c_bob,
+                                                buffer_t const* response,
+                                                buffer_t* receipt,
+                                                alloc_t alloc, void* ctx) {
+  return PlainAtomicSwapVcBobOnResponse(c_bob, CapiIn(response),
+                                        CapiOut(receipt, alloc, ctx));
+}
 
-    yas::file_ostream os(receipt_file);
-    yas::json_oarchive<yas::file_ostream> oa(os);
-    oa.serialize(receipt);
-  } catch (std::exception&) {
-    return false;
-  }
+EXPORT bool E_PlainAtomicSwapVcBobOnResponseAsync(handle_t c_bob,
+                                                  char const* response_file,
+                                                  char const* receipt_file,
+                                                  handle_t c_task) {
+  std::string response(response_file);
+  std::string receipt(receipt_file);
+  return CapiAsync(c_task, [=]() {
+    return PlainAtomicSwapVcBobOnResponse(c_bob, CapiIn(response.c_str()),
+                                          CapiOut(receipt.c_str()));
+  });
+}
 
-  return true;
+EXPORT bool E_PlainAtomicSwapVcBobOnResponseBufAsync(handle_t c_bob,
+                                                     buffer_t const* response,
+                                                     buffer_t* receipt,
+                                                     alloc_t alloc, void* ctx,
+                                                     handle_t c_task) {
+  return CapiAsync(c_task, [=]() {
+    return PlainAtomicSwapVcBobOnResponse(c_bob, CapiIn(response),
+                                          CapiOut(receipt, alloc, ctx));
+  });
 }
 
 EXPORT bool E_PlainAtomicSwapVcBobOnSecret(handle_t c_bob,
                                            char const* secret_file) {
-  using namespace scheme::plain;
-  using namespace scheme::atomic_swap_vc;
-  auto bob = CapiObject<Bob<BobData>>::Get(c_bob);
-  if (!bob) return false;
-
-  try {
-    Secret secret;
-    yas::file_istream is(secret_file);
-    yas::json_iarchive<yas::file_istream> ia(is);
-    ia.serialize(secret);
-    return bob->OnSecret(secret);
-  } catch (std::exception&) {
-    return false;
-  }
+  return PlainAtomicSwapVcBobOnSecret(c_bob, CapiIn(secret_file));
+}
 
-  return true;
+EXPORT bool E_PlainAtomicSwapVcBobOnSecretBuf(handle_t c_bob,
+                                              buffer_t const* secret) {
+  return PlainAtomicSwapVcBobOnSecret(c_bob, CapiIn(secret));
 }
 
 EXPORT bool E_PlainAtomicSwapVcBobSaveDecrypted(handle_t c_bob,
@@ -22,6 +22,23 @@ extern "C"
     EXPORT handle_t E_PlainBobDataNew(char const *bulletin_file,
                                       char const *public_path);
 
+    // the sigmas of the demands with their range paths, so that bob need not
+    // download the whole sigma file. For ot_complaint ask for the phantoms to
+    // keep the demands secret.
+    EXPORT bool E_PlainAliceSigmaSlice(handle_t c_alice_data,
+                                       range_t const *c_demand,
+                                       uint64_t c_demand_count,
+                                       char const *slice_file);
+    EXPORT bool E_PlainAliceSigmaSliceBuf(handle_t c_alice_data,
+                                          range_t const *c_demand,
+                                          uint64_t c_demand_count,
+                                          buffer_t *slice, alloc_t alloc,
+                                          void *ctx);
+    EXPORT handle_t E_PlainBobDataNewFromSlice(char const *bulletin_file,
+                                               char const *slice_file);
+    EXPORT handle_t E_PlainBobDataNewFromSliceBuf(char const *bulletin_file,
+                                                  buffer_t const *slice);
+
     EXPORT bool E_PlainAliceDataFree(handle_t c_alice_data);
     EXPORT bool E_PlainBobDataFree(handle_t c_bob_data);
 
@@ -46,10 +63,31 @@ extern "C"
                                                char const *request_file,
                                                char const *response_file);
 
+    EXPORT bool E_PlainComplaintAliceOnRequestBuf(handle_t c_alice,
+                                                  buffer_t const *request,
+                                                  buffer_t *response,
+                                                  alloc_t alloc, void *ctx);
+
+    EXPORT bool E_PlainComplaintAliceOnRequestAsync(handle_t c_alice,
+                                                    char const *request_file,
+                                                    char const *response_file,
+                                                    handle_t c_task);
+
+    EXPORT bool E_PlainComplaintAliceOnRequestBufAsync(handle_t c_alice,
+                                                       buffer_t const *request,
+                                                       buffer_t *response,
+                                                       alloc_t alloc, void *ctx,
+                                                       handle_t c_task);
+
     EXPORT bool E_PlainComplaintAliceOnReceipt(handle_t c_alice,
                                                char const *receipt_file,
                                                char const *secret_file);
 
+    EXPORT bool E_PlainComplaintAliceOnReceiptBuf(handle_t c_alice,
+                                                  buffer_t const *receipt,
+                                                  buffer_t *secret,
+                                                  alloc_t alloc, void *ctx);
+
     EXPORT bool E_PlainComplaintAliceSetEvil(handle_t c_alice);
 
     EXPORT bool E_PlainComplaintAliceFree(handle_t c_alice);
@@ -60,19 +98,50 @@ extern "C"
                                            range_t const *c_demand,
                                            uint64_t c_demand_count);
 
+    // ask alice to send k uncompressed, call before GetRequest
+    EXPORT bool E_PlainComplaintBobSetG1Uncompressed(handle_t c_bob,
+                                                     bool uncompressed);
+
     EXPORT bool E_PlainComplaintBobGetRequest(handle_t c_bob,
                                               char const *request_file);
 
+    EXPORT bool E_PlainComplaintBobGetRequestBuf(handle_t c_bob,
+                                                 buffer_t *request,
+                                                 alloc_t alloc, void *ctx);
+
     EXPORT bool E_PlainComplaintBobOnResponse(handle_t c_bob,
                                               char const *response_file,
                                               char const *receipt_file);
 
+    EXPORT bool E_PlainComplaintBobOnResponseBuf(handle_t c_bob,
+                                                 buffer_t const *response,
+                                                 buffer_t *receipt,
+                                                 alloc_t alloc, void *ctx);
+
+    EXPORT bool E_PlainComplaintBobOnResponseAsync(handle_t c_bob,
+                                                   char const *response_file,
+                                                   char const *receipt_file,
+                                                   handle_t c_task);
+
+    EXPORT bool E_PlainComplaintBobOnResponseBufAsync(handle_t c_bob,
+                                                      buffer_t const *response,
+                                                      buffer_t *receipt,
+                                                      alloc_t alloc, void *ctx,
+                                                      handle_t c_task);
+
     EXPORT bool E_PlainComplaintBobOnSecret(handle_t c_bob,
                                             char const *secret_file);
 
+    EXPORT bool E_PlainComplaintBobOnSecretBuf(handle_t c_bob,
+                                               buffer_t const *secret);
+
     EXPORT bool E_PlainComplaintBobGenerateClaim(handle_t c_bob,
                                                  char const *claim_file);
 
+    EXPORT bool E_PlainComplaintBobGenerateClaimBuf(handle_t c_bob,
+                                                    buffer_t *claim,
+                                                    alloc_t alloc, void *ctx);
+
     EXPORT bool E_PlainComplaintBobSaveDecrypted(handle_t c_bob, char const *file);
 
     EXPORT bool E_PlainComplaintBobFree(handle_t c_bob);
@@ -94,10 +163,32 @@ extern "C"
                                                 char const *request_file,
                                                 char const *response_file);
 
+    EXPORT bool E_PlainAtomicSwapAliceOnRequestBuf(handle_t c_alice,
+                                                   buffer_t const *request,
+                                                   buffer_t *response,
+                                                   alloc_t alloc, void *ctx);
+
+    EXPORT bool E_PlainAtomicSwapAliceOnRequestAsync(handle_t c_alice,
+                                                     char const *request_file,
+                                                     char const *response_file,
+                                                     handle_t c_task);
+
+    EXPORT bool E_PlainAtomicSwapAliceOnRequestBufAsync(handle_t c_alice,
+                                                        buffer_t const *request,
+                                                        buffer_t *response,
+                                                        alloc_t alloc,
+                                                        void *ctx,
+                                                        handle_t c_task);
+
     EXPORT bool E_PlainAtomicSwapAliceOnReceipt(handle_t c_alice,
                                                 char const *receipt_file,
                                                 char const *secret_file);
 
+    EXPORT bool E_PlainAtomicSwapAliceOnReceiptBuf(handle_t c_alice,
+                                                   buffer_t const *receipt,
+                                                   buffer_t *secret,
+                                                   alloc_t alloc, void *ctx);
+
     EXPORT bool E_PlainAtomicSwapAliceSetEvil(handle_t c_alice);
 
     EXPORT bool E_PlainAtomicSwapAliceFree(handle_t c_alice);
@@ -108,16 +199,43 @@ extern "C"
                                             range_t const *c_demand,
                                             uint64_t c_demand_count);
 
+    // ask alice to send k uncompressed, call before GetRequest
+    EXPORT bool E_PlainAtomicSwapBobSetG1Uncompressed(handle_t c_bob,
+                                                      bool uncompressed);
+
     EXPORT bool E_PlainAtomicSwapBobGetRequest(handle_t c_bob,
                                                char const *request_file);
 
+    EXPORT bool E_PlainAtomicSwapBobGetRequestBuf(handle_t c_bob,
+                                                  buffer_t *request,
+                                                  alloc_t alloc, void *ctx);
+
     EXPORT bool E_PlainAtomicSwapBobOnResponse(handle_t c_bob,
                                                char const *response_file,
                                                char const *receipt_file);
 
+    EXPORT bool E_PlainAtomicSwapBobOnResponseBuf(handle_t c_bob,
+                                                  buffer_t const *response,
+                                                  buffer_t *receipt,
+                                                  alloc_t alloc, void *ctx);
+
+    EXPORT bool E_PlainAtomicSwapBobOnResponseAsync(handle_t c_bob,
+                                                    char const *response_file,
+                                                    char const *receipt_file,
+                                                    handle_t c_task);
+
+    EXPORT bool E_PlainAtomicSwapBobOnResponseBufAsync(handle_t c_bob,
+                                                       buffer_t const *response,
+                                                       buffer_t *receipt,
+                                                       alloc_t alloc, void *ctx,
+                                                       handle_t c_task);
+
     EXPORT bool E_PlainAtomicSwapBobOnSecret(handle_t c_bob,
                                              char const *secret_file);
 
+    EXPORT bool E_PlainAtomicSwapBobOnSecretBuf(handle_t c_bob,
+                                                buffer_t const *secret);
+
     EXPORT bool E_PlainAtomicSwapBobSaveDecrypted(handle_t c_bob, char const *file);
 
     EXPORT bool E_PlainAtomicSwapBobFree(handle_t c_bob);
@@ -138,31 +256,77 @@ extern "C"
     EXPORT bool E_PlainOtComplaintAliceGetNegoRequest(handle_t c_alice,
                                                       char const *request_file);
 
+    EXPORT bool E_PlainOtComplaintAliceGetNegoRequestBuf(handle_t c_alice,
+                                                         buffer_t *request,
+                                                         alloc_t alloc,
+                                                         void *ctx);
+
     EXPORT bool E_PlainOtComplaintAliceOnNegoRequest(handle_t c_alice,
                                                      char const *request_file,
                                                      char const *response_file);
 
+    EXPORT bool E_PlainOtComplaintAliceOnNegoRequestBuf(handle_t c_alice,
+                                                        buffer_t const *request,
+                                                        buffer_t *response,
+                                                        alloc_t alloc,
+                                                        void *ctx);
+
     EXPORT bool E_PlainOtComplaintAliceOnNegoResponse(handle_t c_alice,
                                                       char const *response_file);
 
+    EXPORT bool E_PlainOtComplaintAliceOnNegoResponseBuf(
+        handle_t c_alice, buffer_t const *response);
+
     EXPORT bool E_PlainOtComplaintBobGetNegoRequest(handle_t c_bob,
                                                     char const *request_file);
 
+    EXPORT bool E_PlainOtComplaintBobGetNegoRequestBuf(handle_t c_bob,
+                                                       buffer_t *request,
+                                                       alloc_t alloc,
+                                                       void *ctx);
+
     EXPORT bool E_PlainOtComplaintBobOnNegoRequest(handle_t c_bob,
                                                    char const *request_file,
                                                    char const *response_file);
 
+    EXPORT bool E_PlainOtComplaintBobOnNegoRequestBuf(handle_t c_bob,
+                                                      buffer_t const *request,
+                                                      buffer_t *response,
+                                                      alloc_t alloc, void *ctx);
+
     EXPORT bool E_PlainOtComplaintBobOnNegoResponse(handle_t c_bob,
                                                     char const *response_file);
 
+    EXPORT bool E_PlainOtComplaintBobOnNegoResponseBuf(
+        handle_t c_bob, buffer_t const *response);
+
     EXPORT bool E_PlainOtComplaintAliceOnRequest(handle_t c_alice,
                                                  char const *request_file,
                                                  char const *response_file);
 
+    EXPORT bool E_PlainOtComplaintAliceOnRequestBuf(handle_t c_alice,
+                                                    buffer_t const *request,
+                                                    buffer_t *response,
+                                                    alloc_t alloc, void *ctx);
+
+    EXPORT bool E_PlainOtComplaintAliceOnRequestAsync(handle_t c_alice,
+                                                      char const *request_file,
+                                                      char const *response_file,
+                                                      handle_t c_task);
+
+    EXPORT bool E_PlainOtComplaintAliceOnRequestBufAsync(
+        handle_t c_alice, buffer_t const *request, buffer_t *response,
+        alloc_t alloc, void *ctx, handle_t c_task);
+
     EXPORT bool E_PlainOtComplaintAliceOnReceipt(handle_t c_alice,
                                                  char const *receipt_file,
                                                  char const *secret_file);
 
+    EXPORT bool E_PlainOtComplaintAliceOnReceiptBuf(handle_t c_alice,
+                                                    buffer_t const *receipt,
+                                                    buffer_t *secret,
+                                                    alloc_t alloc, void *ctx);
+
     EXPORT bool E_PlainOtComplaintAliceSetEvil(handle_t c_alice);
 
     EXPORT bool E_PlainOtComplaintAliceFree(handle_t c_alice);
@@ -172,19 +336,48 @@ extern "C"
         range_t const *c_demand, uint64_t c_demand_count, range_t const *c_phantom,
         uint64_t c_phantom_count);
 
+    // ask alice to send k uncompressed, call before GetRequest
+    EXPORT bool E_PlainOtComplaintBobSetG1Uncompressed(handle_t c_bob,
+                                                       bool uncompressed);
+
     EXPORT bool E_PlainOtComplaintBobGetRequest(handle_t c_bob,
                                                 char const *request_file);
 
+    EXPORT bool E_PlainOtComplaintBobGetRequestBuf(handle_t c_bob,
+                                                   buffer_t *request,
+                                                   alloc_t alloc, void *ctx);
+
     EXPORT bool E_PlainOtComplaintBobOnResponse(handle_t c_bob,
                                                 char const *response_file,
                                                 char const *receipt_file);
 
+    EXPORT bool E_PlainOtComplaintBobOnResponseBuf(handle_t c_bob,
+                                                   buffer_t const *response,
+                                                   buffer_t *receipt,
+                                                   alloc_t alloc, void *ctx);
+
+    EXPORT bool E_PlainOtComplaintBobOnResponseAsync(handle_t c_bob,
+                                                     char const *response_file,
+                                                     char const *receipt_file,
+                                                     handle_t c_task);
+
+    EXPORT bool E_PlainOtComplaintBobOnResponseBufAsync(
+        handle_t c_bob, buffer_t const *response, buffer_t *receipt,
+        alloc_t alloc, void *ctx, handle_t c_task);
+
     EXPORT bool E_PlainOtComplaintBobOnSecret(handle_t c_bob,
                                               char const *secret_file);
 
+    EXPORT bool E_PlainOtComplaintBobOnSecretBuf(handle_t c_bob,
+                                                 buffer_t const *secret);
+
     EXPORT bool E_PlainOtComplaintBobGenerateClaim(handle_t c_bob,
                                                    char const *claim_file);
 
+    EXPORT bool E_PlainOtComplaintBobGenerateClaimBuf(handle_t c_bob,
+                                                      buffer_t *claim,
+                                                      alloc_t alloc, void *ctx);
+
     EXPORT bool E_PlainOtComplaintBobSaveDecrypted(handle_t c_bob,
                                                    char const *file);
 
@@ -206,10 +399,28 @@ extern "C"
                                                   char const *request_file,
                                                   char const *response_file);
 
+    EXPORT bool E_PlainAtomicSwapVcAliceOnRequestBuf(handle_t c_alice,
+                                                     buffer_t const *request,
+                                                     buffer_t *response,
+                                                     alloc_t alloc, void *ctx);
+
+    EXPORT bool E_PlainAtomicSwapVcAliceOnRequestAsync(
+        handle_t c_alice, char const *request_file, char const *response_file,
+        handle_t c_task);
+
+    EXPORT bool E_PlainAtomicSwapVcAliceOnRequestBufAsync(
+        handle_t c_alice, buffer_t const *request, buffer_t *response,
+        alloc_t alloc, void *ctx, handle_t c_task);
+
     EXPORT bool E_PlainAtomicSwapVcAliceOnReceipt(handle_t c_alice,
                                                   char const *receipt_file,
                                                   char const *secret_file);
 
+    EXPORT bool E_PlainAtomicSwapVcAliceOnReceiptBuf(handle_t c_alice,
+                                                     buffer_t const *receipt,
+                                                     buffer_t *secret,
+                                                     alloc_t alloc, void *ctx);
+
     EXPORT bool E_PlainAtomicSwapVcAliceSetEvil(handle_t c_alice);
 
     EXPORT bool E_PlainAtomicSwapVcAliceFree(handle_t c_alice);
@@ -220,16 +431,41 @@ extern "C"
                                               range_t const *c_demand,
                                               uint64_t c_demand_count);
 
+    // ask alice to send k uncompressed, call before GetRequest
+    EXPORT bool E_PlainAtomicSwapVcBobSetG1Uncompressed(handle_t c_bob,
+                                                        bool uncompressed);
+
     EXPORT bool E_PlainAtomicSwapVcBobGetRequest(handle_t c_bob,
                                                  char const *request_file);
 
+    EXPORT bool E_PlainAtomicSwapVcBobGetRequestBuf(handle_t c_bob,
+                                                    buffer_t *request,
+                                                    alloc_t alloc, void *ctx);
+
     EXPORT bool E_PlainAtomicSwapVcBobOnResponse(handle_t c_bob,
                                                  char const *response_file,
                                                  char const *receipt_file);
 
+    EXPORT bool E_PlainAtomicSwapVcBobOnResponseBuf(handle_t c_bob,
+                                                    buffer_t const *response,
+                                                    buffer_t *receipt,
+                                                    alloc_t alloc, void *ctx);
+
+    EXPORT bool E_PlainAtomicSwapVcBobOnResponseAsync(handle_t c_bob,
+                                                      char const *response_file,
+                                                      char const *receipt_file,
+                                                      handle_t c_task);
+
+    EXPORT bool E_PlainAtomicSwapVcBobOnResponseBufAsync(
+        handle_t c_bob, buffer_t const *response, buffer_t *receipt,
+        alloc_t alloc, void *ctx, handle_t c_task);
+
     EXPORT bool E_PlainAtomicSwapVcBobOnSecret(handle_t c_bob,
                                                char const *secret_file);
 
+    EXPORT bool E_PlainAtomicSwapVcBobOnSecretBuf(handle_t c_bob,
+                                                  buffer_t const *secret);
+
     EXPORT bool E_PlainAtomicSwapVcBobSaveDecrypted(handle_t c_bob,
                                                     char const *file);
 
@@ -33,6 +33,8 @@
 #include "ecc.h"
 #include "ecc_pub.h"
 
+#include "c_api_async.h"
+#include "c_api_io.h"
 #include "c_api_object.h"
 
 extern "C" {
@@ -110,32 +112,9 @@ EXPORT bool E_TableBobDataFree(handle_t c_bob_data) {
 }  // extern "C"
 
 // complaint
-extern "C" {
-EXPORT handle_t E_TableComplaintAliceNew(handle_t c_alice_data,
-                                         uint8_t const* c_self_id,
-                                         uint8_t const* c_peer_id) {
-  using namespace scheme::table;
-  using namespace scheme::complaint;
-  AliceDataPtr alice_data = CapiObject<AliceData>::Get(c_alice_data);
-  if (!alice_data) return nullptr;
-
-  h256_t self_id;
-  memcpy(self_id.data(), c_self_id, h256_t::size_value);
-  h256_t peer_id;
-  memcpy(peer_id.data(), c_peer_id, h256_t::size_value);
-
-  try {
-    auto p = new Alice<AliceData>(alice_data, self_id, peer_id);
-    CapiObject<Alice<AliceData>>::Add(p);
-    return p;
-  } catch (std::exception&) {
-    return nullptr;
-  }
-}
-
-EXPORT bool E_TableComplaintAliceOnRequest(handle_t c_alice,
-                                           char const* request_file,
-                                           char const* response_file) {
+namespace {
+bool TableComplaintAliceOnRequest(handle_t c_alice, CapiIn const& request_msg,
+                                  CapiOut const& response_msg) {
   using namespace scheme::table;
   using namespace scheme::complaint;
   auto alice = CapiObject<Alice<AliceData>>::Get(c_alice);
@@ -143,16 +122,12 @@ EXPORT bool E_TableComplaintAliceOnRequest(handle_t c_alice,
 
   try {
     Request request;
-    yas::file_istream is(request_file);
-    yas::json_iarchive<yas::file_istream> ia(is);
-    ia.serialize(request);
+    CapiLoadJson(request_msg, request);
 
     Response response;
     if (!alice->OnRequest(request, response)) return false;
 
-    yas::file_ostream os(response_file);
-    yas::binary_oarchive<yas::file_ostream, YasBinF()> oa(os);
-    oa.serialize(response);
+    CapiSaveBin(response_msg, response);
   } catch (std::exception&) {
     return false;
   }
@@ -160,9 +135,8 @@ EXPORT bool E_TableComplaintAliceOnRequest(handle_t c_alice,
   return true;
 }
 
-EXPORT bool E_TableComplaintAliceOnReceipt(handle_t c_alice,
-                                           char const* receipt_file,
-                                           char const* secret_file) {
+bool TableComplaintAliceOnReceipt(handle_t c_alice, CapiIn const& receipt_msg,
+                                  CapiOut const& secret_msg) {
   using namespace scheme::table;
   using namespace scheme::complaint;
   auto alice = CapiObject<Alice<AliceData>>::Get(c_alice);
@@ -170,16 +144,12 @@ EXPORT bool E_TableComplaintAliceOnReceipt(handle_t c_alice,
 
   try {
     Receipt receipt;
-    yas::file_istream is(receipt_file);
-    yas::json_iarchive<yas::file_istream> ia(is);
-    ia.serialize(receipt);
+    CapiLoadJson(receipt_msg, receipt);
 
     Secret secret;
     if (!alice->OnReceipt(receipt, secret)) return false;
 
-    yas::file_ostream os(secret_file);
-    yas::json_oarchive<yas::file_ostream> oa(os);
-    oa.serialize(secret);
+    CapiSaveJson(secret_msg, secret);
   } catch (std::exception&) {
     return false;
   }
@@ -187,53 +157,7 @@ EXPORT bool E_TableComplaintAliceOnReceipt(handle_t c_alice,
   return true;
 }
 
-EXPORT bool E_TableComplaintAliceSetEvil(handle_t c_alice) {
-  using namespace scheme::table;
-  using namespace scheme::complaint;
-  auto alice = CapiObject<Alice<AliceData>>::Get(c_alice);
-  if (!alice) return false;
-  alice->TestSetEvil();
-  return true;
-}
-
-EXPORT bool E_TableComplaintAliceFree(handle_t c_alice) {
-  using namespace scheme::table;
-  using namespace scheme::complaint;
-  return CapiObject<Alice<AliceData>>::Del(c_alice);
-}
-
-EXPORT handle_t E_TableComplaintBobNew(handle_t c_bob_data,
-                                       uint8_t const* c_self_id,
-                                       uint8_t const* c_peer_id,
-                                       range_t const* c_demand,
-                                       uint64_t c_demand_count) {
-  using namespace scheme::table;
-  using namespace scheme::complaint;
-  BobDataPtr bob_data = CapiObject<BobData>::Get(c_bob_data);
-  if (!bob_data) return nullptr;
-
-  h256_t self_id;
-  memcpy(self_id.data(), c_self_id, h256_t::size_value);
-  h256_t peer_id;
-  memcpy(peer_id.data(), c_peer_id, h256_t::size_value);
-
-  std::vector<Range> demands(c_demand_count);
-  for (uint64_t i = 0; i < c_demand_count; ++i) {
-    demands[i].start = c_demand[i].start;
-    demands[i].count = c_demand[i].count;
-  }
-
-  try {
-    auto p = new Bob<BobData>(bob_data, self_id, peer_id, std::move(demands));
-    CapiObject<Bob<BobData>>::Add(p);
-    return p;
-  } catch (std::exception&) {
-    return nullptr;
-  }
-}
-
-EXPORT bool E_TableComplaintBobGetRequest(handle_t c_bob,
-                                          char const* request_file) {
+bool TableComplaintBobGetRequest(handle_t c_bob, CapiOut const& request_msg) {
   using namespace scheme::table;
   using namespace scheme::complaint;
   auto bob = CapiObject<Bob<BobData>>::Get(c_bob);
@@ -242,9 +166,7 @@ EXPORT bool E_TableComplaintBobGetRequest(handle_t c_bob,
   try {
     Request request;
     bob->GetRequest(request);
-    yas::file_ostream os(request_file);
-    yas::json_oarchive<yas::file_ostream> oa(os);
-    oa.serialize(request);
+    CapiSaveJson(request_msg, request);
   } catch (std::exception&) {
     return false;
   }
@@ -252,9 +174,8 @@ EXPORT bool E_TableComplaintBobGetRequest(handle_t c_bob,
   return true;
 }
 
-EXPORT bool E_TableComplaintBobOnResponse(handle_t c_bob,
-                                          char const* response_file,
-                                          char const* receipt_file) {
+bool TableComplaintBobOnResponse(handle_t c_bob, CapiIn const& response_msg,
+                                 CapiOut const& receipt_msg) {
   using namespace scheme::table;
   using namespace scheme::complaint;
   auto bob = CapiObject<Bob<BobData>>::Get(c_bob);
@@ -262,16 +183,12 @@ EXPORT bool E_TableComplaintBobOnResponse(handle_t c_bob,
 
   try {
     Response response;
-    yas::file_istream is(response_file);
-    yas::binary_iarchive<yas::file_istream, YasBinF()> ia(is);
-    ia.serialize(response);
+    CapiLoadBin(response_msg, response);
 
     Receipt receipt;
     if (!bob->OnResponse(std::move(response), receipt)) return false;
 
-    yas::file_ostream os(receipt_file);
-    yas::json_oarchive<yas::file_ostream> oa(os);
-    oa.serialize(receipt);
+    CapiSaveJson(receipt_msg, receipt);
   } catch (std::exception&) {
     return false;
   }
@@ -279,8 +196,7 @@ EXPORT bool E_TableComplaintBobOnResponse(handle_t c_bob,
   return true;
 }
 
-EXPORT bool E_TableComplaintBobOnSecret(handle_t c_bob,
-                                        char const* secret_file) {
+bool TableComplaintBobOnSecret(handle_t c_bob, CapiIn const& secret_msg) {
   using namespace scheme::table;
   using namespace scheme::complaint;
   auto bob = CapiObject<Bob<BobData>>::Get(c_bob);
@@ -288,9 +204,7 @@ EXPORT bool E_TableComplaintBobOnSecret(handle_t c_bob,
 
   try {
     Secret secret;
-    yas::file_istream is(secret_file);
-    yas::json_iarchive<yas::file_istream> ia(is);
-    ia.serialize(secret);
+    CapiLoadJson(secret_msg, secret);
     return bob->OnSecret(secret);
   } catch (std::exception&) {
     return false;
@@ -299,8 +213,7 @@ EXPORT bool E_TableComplaintBobOnSecret(handle_t c_bob,
   return true;
 }
 
-EXPORT bool E_TableComplaintBobGenerateClaim(handle_t c_bob,
-                                             char const* claim_file) {
+bool TableComplaintBobGenerateClaim(handle_t c_bob, CapiOut const& claim_msg) {
   using namespace scheme::table;
   using namespace scheme::complaint;
   auto bob = CapiObject<Bob<BobData>>::Get(c_bob);
@@ -310,43 +223,21 @@ EXPORT bool E_TableComplaintBobGenerateClaim(handle_t c_bob,
     Claim claim;
     if (!bob->GenerateClaim(claim)) return false;
 
-    yas::file_ostream os(claim_file);
-    yas::json_oarchive<yas::file_ostream> oa(os);
-    oa.serialize(claim);
+    CapiSaveJson(claim_msg, claim);
   } catch (std::exception&) {
     return false;
   }
 
   return true;
 }
+}  // namespace
 
-EXPORT bool E_TableComplaintBobSaveDecrypted(handle_t c_bob, char const* file) {
-  using namespace scheme::table;
-  using namespace scheme::complaint;
-  auto bob = CapiObject<Bob<BobData>>::Get(c_bob);
-  if (!bob) return false;
-
-  try {
-    return bob->SaveDecrypted(file);
-  } catch (std::exception&) {
-    return false;
-  }
-}
-
-EXPORT bool E_TableComplaintBobFree(handle_t c_bob) {
-  using namespace scheme::table;
-  using namespace scheme::complaint;
-  return CapiObject<Bob<BobData>>::Del(c_bob);
-}
-}  // extern "C" complaint
-
-// atomic_swap
 extern "C" {
-EXPORT handle_t E_TableAtomicSwapAliceNew(handle_t c_alice_data,
-                                          uint8_t const* c_self_id,
-                                          uint8_t const* c_peer_id) {
+EXPORT handle_t E_TableComplaintAliceNew(handle_t c_alice_data,
+                                         uint8_t const* c_self_id,
+                                         uint8_t const* c_peer_id) {
   using namespace scheme::table;
-  using namespace scheme::atomic_swap;
+  using namespace scheme::complaint;
   AliceDataPtr alice_data = CapiObject<AliceData>::Get(c_alice_data);
   if (!alice_data) return nullptr;
 
@@ -364,82 +255,81 @@ EXPORT handle_t E_TableAtomicSwapAliceNew(handle_t c_alice_data,
   }
 }
 
-EXPORT bool E_TableAtomicSwapAliceOnRequest(handle_t c_alice,
-                                            char const* request_file,
-                                            char const* response_file) {
-  using namespace scheme::table;
-  using namespace scheme::atomic_swap;
-  auto alice = CapiObject<Alice<AliceData>>::Get(c_alice);
-  if (!alice) return false;
-
-  try {
-    Request request;
-    yas::file_istream is(request_file);
-    yas::json_iarchive<yas::file_istream> ia(is);
-    ia.serialize(request);
-
-    Response response;
-    if (!alice->OnRequest(request, response)) return false;
-
-    yas::file_ostream os(response_file);
-    yas::binary_oarchive<yas::file_ostream, YasBinF()> oa(os);
-    oa.serialize(response);
-  } catch (std::exception&) {
-    return false;
-  }
-
-  return true;
+EXPORT bool E_TableComplaintAliceOnRequest(handle_t c_alice,
+                                           char const* request_file,
+                                           char const* response_file) {
+  return TableComplaintAliceOnRequest(c_alice, CapiIn(request_file),
+                                      CapiOut(response_file));
 }
 
-EXPORT bool E_TableAtomicSwapAliceOnReceipt(handle_t c_alice,
-                                            char const* receipt_file,
-                                            char const* secret_file) {
-  using namespace scheme::table;
-  using namespace scheme::atomic_swap;
-  auto alice = CapiObject<Alice<AliceData>>::Get(c_alice);
-  if (!alice) return false;
+EXPORT bool E_TableComplaintAliceOnRequestBuf(handle_t c_alice,
+                                              buffer_t const* request,
+                                              buffer_t* response, alloc_t alloc,
+                                              void* ctx) {
+  return TableComplaintAliceOnRequest(c_alice, CapiIn(request),
+                                      CapiOut(response, alloc, ctx));
+}
 
-  try {
-    Receipt receipt;
-    yas::file_istream is(receipt_file);
-    yas::json_iarchive<yas::file_istream> ia(is);
-    ia.serialize(receipt);
+EXPORT bool E_TableComplaintAliceOnRequestAsync(handle_t c_alice,
+                                                char const* request_file,
+                                                char const* response_file,
+                                                handle_t c_task) {
+  std::string request(request_file);
+  std::string response(response_file);
+  return CapiAsync(c_task, [=]() {
+    return TableComplaintAliceOnRequest(c_alice, CapiIn(request.c_str()),
+                                        CapiOut(response.c_str()));
+  });
+}
 
-    Secret secret;
-    if (!alice->OnReceipt(receipt, secret)) return false;
+EXPORT bool E_TableComplaintAliceOnRequestBufAsync(handle_t c_alice,
+                                                   buffer_t const* request,
+                                                   buffer_t* response,
+                                                   alloc_t alloc, void* ctx,
+                                                   handle_t c_task) {
+  return CapiAsync(c_task, [=]() {
+    return TableComplaintAliceOnRequest(c_alice, CapiIn(request),
+                                        CapiOut(response, alloc, ctx));
+  });
+}
 
-    yas::file_ostream os(secret_file);
-    yas::json_oarchive<yas::file_ostream> oa(os);
-    oa.serialize(secret);
-  } catch (std::exception&) {
-    return false;
-  }
+EXPORT bool E_TableComplaintAliceOnReceipt(handle_t c_alice,
+                                           char const* receipt_file,
+                                           char const* secret_file) {
+  return TableComplaintAliceOnReceipt(c_alice, CapiIn(receipt_file),
+                                      CapiOut(secret_file));
+}
 
-  return true;
+EXPORT bool E_TableComplaintAliceOnReceiptBuf(handle_t c_alice,
+                                              buffer_t const* receipt,
+                                              buffer_t* secret, alloc_t alloc,
+                                              void* ctx) {
+  return TableComplaintAliceOnReceipt(c_alice, CapiIn(receipt),
+                                      CapiOut(secret, alloc, ctx));
 }
 
-EXPORT bool E_TableAtomicSwapAliceSetEvil(handle_t c_alice) {
+EXPORT bool E_TableComplaintAliceSetEvil(handle_t c_alice) {
   using namespace scheme::table;
-  using namespace scheme::atomic_swap;
+  using namespace scheme::complaint;
   auto alice = CapiObject<Alice<AliceData>>::Get(c_alice);
   if (!alice) return false;
   alice->TestSetEvil();
   return true;
 }
 
-EXPORT bool E_TableAtomicSwapAliceFree(handle_t c_alice) {
+EXPORT bool E_TableComplaintAliceFree(handle_t c_alice) {
   using namespace scheme::table;
-  using namespace scheme::atomic_swap;
+  using namespace scheme::complaint;
   return CapiObject<Alice<AliceData>>::Del(c_alice);
 }
 
-EXPORT handle_t E_TableAtomicSwapBobNew(handle_t c_bob_data,
-                                        uint8_t const* c_self_id,
-                                        uint8_t const* c_peer_id,
-                                        range_t const* c_demand,
-                                        uint64_t c_demand_count) {
+EXPORT handle_t E_TableComplaintBobNew(handle_t c_bob_data,
+                                       uint8_t const* c_self_id,
+                                       uint8_t const* c_peer_id,
+                                       range_t const* c_demand,
+                                       uint64_t c_demand_count) {
   using namespace scheme::table;
-  using namespace scheme::atomic_swap;
+  using namespace scheme::complaint;
   BobDataPtr bob_data = CapiObject<BobData>::Get(c_bob_data);
   if (!bob_data) return nullptr;
 
@@ -463,46 +353,121 @@ EXPORT handle_t E_TableAtomicSwapBobNew(handle_t c_bob_data,
   }
 }
 
-EXPORT bool E_TableAtomicSwapBobGetRequest(handle_t c_bob,
-                                           char const* request_file) {
+EXPORT bool E_TableComplaintBobSetG1Uncompressed(handle_t c_bob,
+                                                 bool uncompressed) {
   using namespace scheme::table;
-  using namespace scheme::atomic_swap;
+  using namespace scheme::complaint;
+  auto bob = CapiObject<Bob<BobData>>::Get(c_bob);
+  if (!bob) return false;
+  bob->SetG1Uncompressed(uncompressed);
+  return true;
+}
+
+EXPORT bool E_TableComplaintBobGetRequest(handle_t c_bob,
+                                          char const* request_file) {
+  return TableComplaintBobGetRequest(c_bob, CapiOut(request_file));
+}
+
+EXPORT bool E_TableComplaintBobGetRequestBuf(handle_t c_bob, buffer_t* request,
+                                             alloc_t alloc, void* ctx) {
+  return TableComplaintBobGetRequest(c_bob, CapiOut(request, alloc, ctx));
+}
+
+EXPORT bool E_TableComplaintBobOnResponse(handle_t c_bob,
+                                          char const* response_file,
+                                          char const* receipt_file) {
+  return TableComplaintBobOnResponse(c_bob, CapiIn(response_file),
+                                     CapiOut(receipt_file));
+}
+
+EXPORT bool E_TableComplaintBobOnResponseBuf(handle_t c_bob,
+                                             buffer_t const* response,
+                                             buffer_t* receipt, alloc_t alloc,
+                                             void* ctx) {
+  return TableComplaintBobOnResponse(c_bob, CapiIn(response),
+                                     CapiOut(receipt, alloc, ctx));
+}
+
+EXPORT bool E_TableComplaintBobOnResponseAsync(handle_t c_bob,
+                                               char const* response_file,
+                                               char const* receipt_file,
+                                               handle_t c_task) {
+  std::string response(response_file);
+  std::string receipt(receipt_file);
+  return CapiAsync(c_task, [=]() {
+    return TableComplaintBobOnResponse(c_bob, CapiIn(response.c_str()),
+                                       CapiOut(receipt.c_str()));
+  });
+}
+
+EXPORT bool E_TableComplaintBobOnResponseBufAsync(handle_t c_bob,
+                                                  buffer_t const* response,
+                                                  buffer_t* receipt,
+                                                  alloc_t alloc, void* ctx,
+                                                  handle_t c_task) {
+  return CapiAsync(c_task, [=]() {
+    return TableComplaintBobOnResponse(c_bob, CapiIn(response),
+                                       CapiOut(receipt, alloc, ctx));
+  });
+}
+
+EXPORT bool E_TableComplaintBobOnSecret(handle_t c_bob,
+                                        char const* secret_file) {
+  return TableComplaintBobOnSecret(c_bob, CapiIn(secret_file));
+}
+
+EXPORT bool E_TableComplaintBobOnSecretBuf(handle_t c_bob,
+                                           buffer_t const* secret) {
+  return TableComplaintBobOnSecret(c_bob, CapiIn(secret));
+}
+
+EXPORT bool E_TableComplaintBobGenerateClaim(handle_t c_bob,
+                                             char const* claim_file) {
+  return TableComplaintBobGenerateClaim(c_bob, CapiOut(claim_file));
+}
+
+EXPORT bool E_TableComplaintBobGenerateClaimBuf(handle_t c_bob, buffer_t* claim,
+                                                alloc_t alloc, void* ctx) {
+  return TableComplaintBobGenerateClaim(c_bob, CapiOut(claim, alloc, ctx));
+}
+
+EXPORT bool E_TableComplaintBobSaveDecrypted(handle_t c_bob, char const* file) {
+  using namespace scheme::table;
+  using namespace scheme::complaint;
   auto bob = CapiObject<Bob<BobData>>::Get(c_bob);
   if (!bob) return false;
 
   try {
-    Request request;
-    bob->GetRequest(request);
-    yas::file_ostream os(request_file);
-    yas::json_oarchive<yas::file_ostream> oa(os);
-    oa.serialize(request);
+    return bob->SaveDecrypted(file);
   } catch (std::exception&) {
     return false;
   }
+}
 
-  return true;
+EXPORT bool E_TableComplaintBobFree(handle_t c_bob) {
+  using namespace scheme::table;
+  using namespace scheme::complaint;
+  return CapiObject<Bob<BobData>>::Del(c_bob);
 }
+}  // extern "C" complaint
 
-EXPORT bool E_TableAtomicSwapBobOnResponse(handle_t c_bob,
-                                           char const* response_file,
-                                           char const* receipt_file) {
+// atomic_swap
+namespace {
+bool TableAtomicSwapAliceOnRequest(handle_t c_alice, CapiIn const& request_msg,
+                                   CapiOut const& response_msg) {
   using namespace scheme::table;
   using namespace scheme::atomic_swap;
-  auto bob = CapiObject<Bob<BobData>>::Get(c_bob);
-  if (!bob) return false;
+  auto alice = CapiObject<Alice<AliceData>>::Get(c_alice);
+  if (!alice) return false;
 
   try {
-    Response response;
-    yas::file_istream is(response_file);
-    yas::binary_iarchive<yas::file_istream, YasBinF()> ia(is);
-    ia.serialize(response);
+    Request request;
+    CapiLoadJson(request_msg, request);
 
-    Receipt receipt;
-    if (!bob->OnResponse(std::move(response), receipt)) return false;
+    Response response;
+    if (!alice->OnRequest(request, response)) return false;
 
-    yas::file_ostream os(receipt_file);
-    yas::json_oarchive<yas::file_ostream> oa(os);
-    oa.serialize(receipt);
+    CapiSaveBin(response_msg, response);
   } catch (std::exception&) {
     return false;
   }
@@ -510,19 +475,21 @@ EXPORT bool E_TableAtomicSwapBobOnResponse(handle_t c_bob,
   return true;
 }
 
-EXPORT bool E_TableAtomicSwapBobOnSecret(handle_t c_bob,
-                                         char const* secret_file) {
+bool TableAtomicSwapAliceOnReceipt(handle_t c_alice, CapiIn const& receipt_msg,
+                                   CapiOut const& secret_msg) {
   using namespace scheme::table;
   using namespace scheme::atomic_swap;
-  auto bob = CapiObject<Bob<BobData>>::Get(c_bob);
-  if (!bob) return false;
+  auto alice = CapiObject<Alice<AliceData>>::Get(c_alice);
+  if (!alice) return false;
 
   try {
+    Receipt receipt;
+    CapiLoadJson(receipt_msg, receipt);
+
     Secret secret;
-    yas::file_istream is(secret_file);
-    yas::json_iarchive<yas::file_istream> ia(is);
-    ia.serialize(secret);
-    return bob->OnSecret(secret);
+    if (!alice->OnReceipt(receipt, secret)) return false;
+
+    CapiSaveJson(secret_msg, secret);
   } catch (std::exception&) {
     return false;
   }
@@ -530,34 +497,69 @@ EXPORT bool E_TableAtomicSwapBobOnSecret(handle_t c_bob,
   return true;
 }
 
-EXPORT bool E_TableAtomicSwapBobSaveDecrypted(handle_t c_bob,
-                                              char const* file) {
+bool TableAtomicSwapBobGetRequest(handle_t c_bob, CapiOut const& request_msg) {
   using namespace scheme::table;
   using namespace scheme::atomic_swap;
   auto bob = CapiObject<Bob<BobData>>::Get(c_bob);
   if (!bob) return false;
 
   try {
-    return bob->SaveDecrypted(file);
-  } catch (std::exception&) {
+    Request request;
+    bob->GetRequest(request);
+    CapiSaveJson(request_msg, request);
+  } catch (std::exception&) {
     return false;
   }
+
+  return true;
 }
 
-EXPORT bool E_TableAtomicSwapBobFree(handle_t c_bob) {
+bool TableAtomicSwapBobOnResponse(handle_t c_bob, CapiIn const& response_msg,
+                                  CapiOut const& receipt_msg) {
   using namespace scheme::table;
   using namespace scheme::atomic_swap;
-  return CapiObject<Bob<BobData>>::Del(c_bob);
+  auto bob = CapiObject<Bob<BobData>>::Get(c_bob);
+  if (!bob) return false;
+
+  try {
+    Response response;
+    CapiLoadBin(response_msg, response);
+
+    Receipt receipt;
+    if (!bob->OnResponse(std::move(response), receipt)) return false;
+
+    CapiSaveJson(receipt_msg, receipt);
+  } catch (std::exception&) {
+    return false;
+  }
+
+  return true;
 }
-}  // extern "C" atomic_swap
 
-// ot_complaint
+bool TableAtomicSwapBobOnSecret(handle_t c_bob, CapiIn const& secret_msg) {
+  using namespace scheme::table;
+  using namespace scheme::atomic_swap;
+  auto bob = CapiObject<Bob<BobData>>::Get(c_bob);
+  if (!bob) return false;
+
+  try {
+    Secret secret;
+    CapiLoadJson(secret_msg, secret);
+    return bob->OnSecret(secret);
+  } catch (std::exception&) {
+    return false;
+  }
+
+  return true;
+}
+}  // namespace
+
 extern "C" {
-EXPORT handle_t E_TableOtComplaintAliceNew(handle_t c_alice_data,
-                                           uint8_t const* c_self_id,
-                                           uint8_t const* c_peer_id) {
+EXPORT handle_t E_TableAtomicSwapAliceNew(handle_t c_alice_data,
+                                          uint8_t const* c_self_id,
+                                          uint8_t const* c_peer_id) {
   using namespace scheme::table;
-  using namespace scheme::ot_complaint;
+  using namespace scheme::atomic_swap;
   AliceDataPtr alice_data = CapiObject<AliceData>::Get(c_alice_data);
   if (!alice_data) return nullptr;
 
@@ -575,8 +577,197 @@ EXPORT handle_t E_TableOtComplaintAliceNew(handle_t c_alice_data,
   }
 }
 
-EXPORT bool E_TableOtComplaintAliceGetNegoRequest(handle_t c_alice,
-                                                  char const* request_file) {
+EXPORT bool E_TableAtomicSwapAliceOnRequest(handle_t c_alice,
+                                            char const* request_file,
+                                            char const* response_file) {
+  return TableAtomicSwapAliceOnRequest(c_alice, CapiIn(request_file),
+                                       CapiOut(response_file));
+}
+
+EXPORT bool E_TableAtomicSwapAliceOnRequestBuf(handle_t c_alice,
+                                               buffer_t const* request,
+                                               buffer_t* response,
+                                               alloc_t alloc, void* ctx) {
+  return TableAtomicSwapAliceOnRequest(c_alice, CapiIn(request),
+                                       CapiOut(response, alloc, ctx));
+}
+
+EXPORT bool E_TableAtomicSwapAliceOnRequestAsync(handle_t c_alice,
+                                                 char const* request_file,
+                                                 char const* response_file,
+                                                 handle_t c_task) {
+  std::string request(request_file);
+  std::string response(response_file);
+  return CapiAsync(c_task, [=]() {
+    return TableAtomicSwapAliceOnRequest(c_alice, CapiIn(request.c_str()),
+                                         CapiOut(response.c_str()));
+  });
+}
+
+EXPORT bool E_TableAtomicSwapAliceOnRequestBufAsync(handle_t c_alice,
+                                                    buffer_t const* request,
+                                                    buffer_t* response,
+                                                    alloc_t alloc, void* ctx,
+                                                    handle_t c_task) {
+  return CapiAsync(c_task, [=]() {
+    return TableAtomicSwapAliceOnRequest(c_alice, CapiIn(request),
+                                         CapiOut(response, alloc, ctx));
+  });
+}
+
+EXPORT bool E_TableAtomicSwapAliceOnReceipt(handle_t c_alice,
+                                            char const* receipt_file,
+                                            char const* secret_file) {
+  return TableAtomicSwapAliceOnReceipt(c_alice, CapiIn(receipt_file),
+                                       CapiOut(secret_file));
+}
+
+EXPORT bool E_TableAtomicSwapAliceOnReceiptBuf(handle_t c_alice,
+                                               buffer_t const* receipt,
+                                               buffer_t* secret, alloc_t alloc,
+                                               void* ctx) {
+  return TableAtomicSwapAliceOnReceipt(c_alice, CapiIn(receipt),
+                                       CapiOut(secret, alloc, ctx));
+}
+
+EXPORT bool E_TableAtomicSwapAliceSetEvil(handle_t c_alice) {
+  using namespace scheme::table;
+  using namespace scheme::atomic_swap;
+  auto alice = CapiObject<Alice<AliceData>>::Get(c_alice);
+  if (!alice) return false;
+  alice->TestSetEvil();
+  return true;
+}
+
+EXPORT bool E_TableAtomicSwapAliceFree(handle_t c_alice) {
+  using namespace scheme::table;
+  using namespace scheme::atomic_swap;
+  return CapiObject<Alice<AliceData>>::Del(c_alice);
+}
+
+EXPORT handle_t E_TableAtomicSwapBobNew(handle_t c_bob_data,
+                                        uint8_t const* c_self_id,
+                                        uint8_t const* c_peer_id,
+                                        range_t const* c_demand,
+                                        uint64_t c_demand_count) {
+  using namespace scheme::table;
+  using namespace scheme::atomic_swap;
+  BobDataPtr bob_data = CapiObject<BobData>::Get(c_bob_data);
+  if (!bob_data) return nullptr;
+
+  h256_t self_id;
+  memcpy(self_id.data(), c_self_id, h256_t::size_value);
+  h256_t peer_id;
+  memcpy(peer_id.data(), c_peer_id, h256_t::size_value);
+
+  std::vector<Range> demands(c_demand_count);
+  for (uint64_t i = 0; i < c_demand_count; ++i) {
+    demands[i].start = c_demand[i].start;
+    demands[i].count = c_demand[i].count;
+  }
+
+  try {
+    auto p = new Bob<BobData>(bob_data, self_id, peer_id, std::move(demands));
+    CapiObject<Bob<BobData>>::Add(p);
+    return p;
+  } catch (std::exception&) {
+    return nullptr;
+  }
+}
+
+EXPORT bool E_TableAtomicSwapBobSetG1Uncompressed(handle_t c_bob,
+                                                  bool uncompressed) {
+  using namespace scheme::table;
+  using namespace scheme::atomic_swap;
+  auto bob = CapiObject<Bob<BobData>>::Get(c_bob);
+  if (!bob) return false;
+  bob->SetG1Uncompressed(uncompressed);
+  return true;
+}
+
+EXPORT bool E_TableAtomicSwapBobGetRequest(handle_t c_bob,
+                                           char const* request_file) {
+  return TableAtomicSwapBobGetRequest(c_bob, CapiOut(request_file));
+}
+
+EXPORT bool E_TableAtomicSwapBobGetRequestBuf(handle_t c_bob, buffer_t* request,
+                                              alloc_t alloc, void* ctx) {
+  return TableAtomicSwapBobGetRequest(c_bob, CapiOut(request, alloc, ctx));
+}
+
+EXPORT bool E_TableAtomicSwapBobOnResponse(handle_t c_bob,
+                                           char const* response_file,
+                                           char const* receipt_file) {
+  return TableAtomicSwapBobOnResponse(c_bob, CapiIn(response_file),
+                                      CapiOut(receipt_file));
+}
+
+EXPORT bool E_TableAtomicSwapBobOnResponseBuf(handle_t c_bob,
+                                              buffer_t const* response,
+                                              buffer_t* receipt, alloc_t alloc,
+                                              void* ctx) {
+  return TableAtomicSwapBobOnResponse(c_bob, CapiIn(response),
+                                      CapiOut(receipt, alloc, ctx));
+}
+
+EXPORT bool E_TableAtomicSwapBobOnResponseAsync(handle_t c_bob,
+                                                char const* response_file,
+                                                char const* receipt_file,
+                                                handle_t c_task) {
+  std::string response(response_file);
+  std::string receipt(receipt_file);
+  return CapiAsync(c_task, [=]() {
+    return TableAtomicSwapBobOnResponse(c_bob, CapiIn(response.c_str()),
+                                        CapiOut(receipt.c_str()));
+  });
+}
+
+EXPORT bool E_TableAtomicSwapBobOnResponseBufAsync(handle_t c_bob,
+                                                   buffer_t const* response,
+                                                   buffer_t* receipt,
+                                                   alloc_t alloc, void* ctx,
+                                                   handle_t c_task) {
+  return CapiAsync(c_task, [=]() {
+    return TableAtomicSwapBobOnResponse(c_bob, CapiIn(response),
+                                        CapiOut(receipt, alloc, ctx));
+  });
+}
+
+EXPORT bool E_TableAtomicSwapBobOnSecret(handle_t c_bob,
+                                         char const* secret_file) {
+  return TableAtomicSwapBobOnSecret(c_bob, CapiIn(secret_file));
+}
+
+EXPORT bool E_TableAtomicSwapBobOnSecretBuf(handle_t c_bob,
+                                            buffer_t const* secret) {
+  return TableAtomicSwapBobOnSecret(c_bob, CapiIn(secret));
+}
+
+EXPORT bool E_TableAtomicSwapBobSaveDecrypted(handle_t c_bob,
+                                              char const* file) {
+  using namespace scheme::table;
+  using namespace scheme::atomic_swap;
+  auto bob = CapiObject<Bob<BobData>>::Get(c_bob);
+  if (!bob) return false;
+
+  try {
+    return bob->SaveDecrypted(file);
+  } catch (std::exception&) {
+    return false;
+  }
+}
+
+EXPORT bool E_TableAtomicSwapBobFree(handle_t c_bob) {
+  using namespace scheme::table;
+  using namespace scheme::atomic_swap;
+  return CapiObject<Bob<BobData>>::Del(c_bob);
+}
+}  // extern "C" atomic_swap
+
+// ot_complaint
+namespace {
+bool TableOtComplaintAliceGetNegoRequest(handle_t c_alice,
+                                         CapiOut const& request_msg) {
   using namespace scheme::table;
   using namespace scheme::ot_complaint;
   auto alice = CapiObject<Alice<AliceData>>::Get(c_alice);
@@ -585,9 +776,7 @@ EXPORT bool E_TableOtComplaintAliceGetNegoRequest(handle_t c_alice,
   try {
     NegoARequest request;
     alice->GetNegoReqeust(request);
-    yas::file_ostream os(request_file);
-    yas::binary_oarchive<yas::file_ostream, YasBinF()> oa(os);
-    oa.serialize(request);
+    CapiSaveBin(request_msg, request);
   } catch (std::exception&) {
     return false;
   }
@@ -595,9 +784,9 @@ EXPORT bool E_TableOtComplaintAliceGetNegoRequest(handle_t c_alice,
   return true;
 }
 
-EXPORT bool E_TableOtComplaintAliceOnNegoRequest(handle_t c_alice,
-                                                 char const* request_file,
-                                                 char const* response_file) {
+bool TableOtComplaintAliceOnNegoRequest(handle_t c_alice,
+                                        CapiIn const& request_msg,
+                                        CapiOut const& response_msg) {
   using namespace scheme::table;
   using namespace scheme::ot_complaint;
   auto alice = CapiObject<Alice<AliceData>>::Get(c_alice);
@@ -605,16 +794,12 @@ EXPORT bool E_TableOtComplaintAliceOnNegoRequest(handle_t c_alice,
 
   try {
     NegoBRequest request;
-    yas::file_istream is(request_file);
-    yas::binary_iarchive<yas::file_istream, YasBinF()> ia(is);
-    ia.serialize(request);
+    CapiLoadBin(request_msg, request);
 
     NegoBResponse response;
     if (!alice->OnNegoRequest(request, response)) return false;
 
-    yas::file_ostream os(response_file);
-    yas::binary_oarchive<yas::file_ostream, YasBinF()> oa(os);
-    oa.serialize(response);
+    CapiSaveBin(response_msg, response);
   } catch (std::exception&) {
     return false;
   }
@@ -622,8 +807,8 @@ EXPORT bool E_TableOtComplaintAliceOnNegoRequest(handle_t c_alice,
   return true;
 }
 
-EXPORT bool E_TableOtComplaintAliceOnNegoResponse(handle_t c_alice,
-                                                  char const* response_file) {
+bool TableOtComplaintAliceOnNegoResponse(handle_t c_alice,
+                                         CapiIn const& response_msg) {
   using namespace scheme::table;
   using namespace scheme::ot_complaint;
   auto alice = CapiObject<Alice<AliceData>>::Get(c_alice);
@@ -631,9 +816,7 @@ EXPORT bool E_TableOtComplaintAliceOnNegoResponse(handle_t c_alice,
 
   try {
     NegoAResponse response;
-    yas::file_istream is(response_file);
-    yas::binary_iarchive<yas::file_istream, YasBinF()> ia(is);
-    ia.serialize(response);
+    CapiLoadBin(response_msg, response);
 
     if (!alice->OnNegoResponse(response)) return false;
   } catch (std::exception&) {
@@ -643,9 +826,8 @@ EXPORT bool E_TableOtComplaintAliceOnNegoResponse(handle_t c_alice,
   return true;
 }
 
-EXPORT bool E_TableOtComplaintAliceOnRequest(handle_t c_alice,
-                                             char const* request_file,
-                                             char const* response_file) {
+bool TableOtComplaintAliceOnRequest(handle_t c_alice, CapiIn const& request_msg,
+                                    CapiOut const& response_msg) {
   using namespace scheme::table;
   using namespace scheme::ot_complaint;
   auto alice = CapiObject<Alice<AliceData>>::Get(c_alice);
@@ -653,16 +835,12 @@ EXPORT bool E_TableOtComplaintAliceOnRequest(handle_t c_alice,
 
   try {
     Request request;
-    yas::file_istream is(request_file);
-    yas::json_iarchive<yas::file_istream> ia(is);
-    ia.serialize(request);
+    CapiLoadJson(request_msg, request);
 
     Response response;
     if (!alice->OnRequest(request, response)) return false;
 
-    yas::file_ostream os(response_file);
-    yas::binary_oarchive<yas::file_ostream, YasBinF()> oa(os);
-    oa.serialize(response);
+    CapiSaveBin(response_msg, response);
   } catch (std::exception&) {
     return false;
   }
@@ -670,9 +848,8 @@ EXPORT bool E_TableOtComplaintAliceOnRequest(handle_t c_alice,
   return true;
 }
 
-EXPORT bool E_TableOtComplaintAliceOnReceipt(handle_t c_alice,
-                                             char const* receipt_file,
-                                             char const* secret_file) {
+bool TableOtComplaintAliceOnReceipt(handle_t c_alice, CapiIn const& receipt_msg,
+                                    CapiOut const& secret_msg) {
   using namespace scheme::table;
   using namespace scheme::ot_complaint;
   auto alice = CapiObject<Alice<AliceData>>::Get(c_alice);
@@ -680,16 +857,12 @@ EXPORT bool E_TableOtComplaintAliceOnReceipt(handle_t c_alice,
 
   try {
     Receipt receipt;
-    yas::file_istream is(receipt_file);
-    yas::json_iarchive<yas::file_istream> ia(is);
-    ia.serialize(receipt);
+    CapiLoadJson(receipt_msg, receipt);
 
     Secret secret;
     if (!alice->OnReceipt(receipt, secret)) return false;
 
-    yas::file_ostream os(secret_file);
-    yas::json_oarchive<yas::file_ostream> oa(os);
-    oa.serialize(secret);
+    CapiSaveJson(secret_msg, secret);
   } catch (std::exception&) {
     return false;
   }
@@ -697,59 +870,8 @@ EXPORT bool E_TableOtComplaintAliceOnReceipt(handle_t c_alice,
   return true;
 }
 
-EXPORT bool E_TableOtComplaintAliceSetEvil(handle_t c_alice) {
-  using namespace scheme::table;
-  using namespace scheme::ot_complaint;
-  auto alice = CapiObject<Alice<AliceData>>::Get(c_alice);
-  if (!alice) return false;
-  alice->TestSetEvil();
-  return true;
-}
-
-EXPORT bool E_TableOtComplaintAliceFree(handle_t c_alice) {
-  using namespace scheme::table;
-  using namespace scheme::ot_complaint;
-  return CapiObject<Alice<AliceData>>::Del(c_alice);
-}
-
-EXPORT handle_t E_TableOtComplaintBobNew(
-    handle_t c_bob_data, uint8_t const* c_self_id, uint8_t const* c_peer_id,
-    range_t const* c_demand, uint64_t c_demand_count, range_t const* c_phantom,
-    uint64_t c_phantom_count) {
-  using namespace scheme::table;
-  using namespace scheme::ot_complaint;
-  BobDataPtr bob_data = CapiObject<BobData>::Get(c_bob_data);
-  if (!bob_data) return nullptr;
-
-  h256_t self_id;
-  memcpy(self_id.data(), c_self_id, h256_t::size_value);
-  h256_t peer_id;
-  memcpy(peer_id.data(), c_peer_id, h256_t::size_value);
-
-  std::vector<Range> demands(c_demand_count);
-  for (uint64_t i = 0; i < c_demand_count; ++i) {
-    demands[i].start = c_demand[i].start;
-    demands[i].count = c_demand[i].count;
-  }
-
-  std::vector<Range> phantoms(c_phantom_count);
-  for (uint64_t i = 0; i < c_phantom_count; ++i) {
-    phantoms[i].start = c_phantom[i].start;
-    phantoms[i].count = c_phantom[i].count;
-  }
-
-  try {
-    auto p = new Bob<BobData>(bob_data, self_id, peer_id, std::move(demands),
-                              std::move(phantoms));
-    CapiObject<Bob<BobData>>::Add(p);
-    return p;
-  } catch (std::exception&) {
-    return nullptr;
-  }
-}
-
-EXPORT bool E_TableOtComplaintBobGetNegoRequest(handle_t c_bob,
-                                                char const* request_file) {
+bool TableOtComplaintBobGetNegoRequest(handle_t c_bob,
+                                       CapiOut const& request_msg) {
   using namespace scheme::table;
   using namespace scheme::ot_complaint;
   auto bob = CapiObject<Bob<BobData>>::Get(c_bob);
@@ -758,9 +880,7 @@ EXPORT bool E_TableOtComplaintBobGetNegoRequest(handle_t c_bob,
   try {
     NegoBRequest request;
     bob->GetNegoReqeust(request);
-    yas::file_ostream os(request_file);
-    yas::binary_oarchive<yas::file_ostream, YasBinF()> oa(os);
-    oa.serialize(request);
+    CapiSaveBin(request_msg, request);
   } catch (std::exception&) {
     return false;
   }
@@ -768,9 +888,8 @@ EXPORT bool E_TableOtComplaintBobGetNegoRequest(handle_t c_bob,
   return true;
 }
 
-EXPORT bool E_TableOtComplaintBobOnNegoRequest(handle_t c_bob,
-                                               char const* request_file,
-                                               char const* response_file) {
+bool TableOtComplaintBobOnNegoRequest(handle_t c_bob, CapiIn const& request_msg,
+                                      CapiOut const& response_msg) {
   using namespace scheme::table;
   using namespace scheme::ot_complaint;
   auto bob = CapiObject<Bob<BobData>>::Get(c_bob);
@@ -778,16 +897,12 @@ EXPORT bool E_TableOtComplaintBobOnNegoRequest(handle_t c_bob,
 
   try {
     NegoARequest request;
-    yas::file_istream is(request_file);
-    yas::binary_iarchive<yas::file_istream, YasBinF()> ia(is);
-    ia.serialize(request);
+    CapiLoadBin(request_msg, request);
 
     NegoAResponse response;
     if (!bob->OnNegoRequest(request, response)) return false;
 
-    yas::file_ostream os(response_file);
-    yas::binary_oarchive<yas::file_ostream, YasBinF()> oa(os);
-    oa.serialize(response);
+    CapiSaveBin(response_msg, response);
   } catch (std::exception&) {
     return false;
   }
@@ -795,8 +910,8 @@ EXPORT bool E_TableOtComplaintBobOnNegoRequest(handle_t c_bob,
   return true;
 }
 
-EXPORT bool E_TableOtComplaintBobOnNegoResponse(handle_t c_bob,
-                                                char const* response_file) {
+bool TableOtComplaintBobOnNegoResponse(handle_t c_bob,
+                                       CapiIn const& response_msg) {
   using namespace scheme::table;
   using namespace scheme::ot_complaint;
   auto bob = CapiObject<Bob<BobData>>::Get(c_bob);
@@ -804,9 +919,7 @@ EXPORT bool E_TableOtComplaintBobOnNegoResponse(handle_t c_bob,
 
   try {
     NegoBResponse response;
-    yas::file_istream is(response_file);
-    yas::binary_iarchive<yas::file_istream, YasBinF()> ia(is);
-    ia.serialize(response);
+    CapiLoadBin(response_msg, response);
     return bob->OnNegoResponse(response);
   } catch (std::exception&) {
     return false;
@@ -815,8 +928,7 @@ EXPORT bool E_TableOtComplaintBobOnNegoResponse(handle_t c_bob,
   return true;
 }
 
-EXPORT bool E_TableOtComplaintBobGetRequest(handle_t c_bob,
-                                            char const* request_file) {
+bool TableOtComplaintBobGetRequest(handle_t c_bob, CapiOut const& request_msg) {
   using namespace scheme::table;
   using namespace scheme::ot_complaint;
   auto bob = CapiObject<Bob<BobData>>::Get(c_bob);
@@ -825,9 +937,7 @@ EXPORT bool E_TableOtComplaintBobGetRequest(handle_t c_bob,
   try {
     Request request;
     bob->GetRequest(request);
-    yas::file_ostream os(request_file);
-    yas::json_oarchive<yas::file_ostream> oa(os);
-    oa.serialize(request);
+    CapiSaveJson(request_msg, request);
   } catch (std::exception&) {
     return false;
   }
@@ -835,9 +945,8 @@ EXPORT bool E_TableOtComplaintBobGetRequest(handle_t c_bob,
   return true;
 }
 
-EXPORT bool E_TableOtComplaintBobOnResponse(handle_t c_bob,
-                                            char const* response_file,
-                                            char const* receipt_file) {
+bool TableOtComplaintBobOnResponse(handle_t c_bob, CapiIn const& response_msg,
+                                   CapiOut const& receipt_msg) {
   using namespace scheme::table;
   using namespace scheme::ot_complaint;
   auto bob = CapiObject<Bob<BobData>>::Get(c_bob);
@@ -845,16 +954,12 @@ EXPORT bool E_TableOtComplaintBobOnResponse(handle_t c_bob,
 
   try {
     Response response;
-    yas::file_istream is(response_file);
-    yas::binary_iarchive<yas::file_istream, YasBinF()> ia(is);
-    ia.serialize(response);
+    CapiLoadBin(response_msg, response);
 
     Receipt receipt;
     if (!bob->OnResponse(std::move(response), receipt)) return false;
 
-    yas::file_ostream os(receipt_file);
-    yas::json_oarchive<yas::file_ostream> oa(os);
-    oa.serialize(receipt);
+    CapiSaveJson(receipt_msg, receipt);
   } catch (std::exception&) {
     return false;
   }
@@ -862,8 +967,7 @@ EXPORT bool E_TableOtComplaintBobOnResponse(handle_t c_bob,
   return true;
 }
 
-EXPORT bool E_TableOtComplaintBobOnSecret(handle_t c_bob,
-                                          char const* secret_file) {
+bool TableOtComplaintBobOnSecret(handle_t c_bob, CapiIn const& secret_msg) {
   using namespace scheme::table;
   using namespace scheme::ot_complaint;
   auto bob = CapiObject<Bob<BobData>>::Get(c_bob);
@@ -871,9 +975,7 @@ EXPORT bool E_TableOtComplaintBobOnSecret(handle_t c_bob,
 
   try {
     Secret secret;
-    yas::file_istream is(secret_file);
-    yas::json_iarchive<yas::file_istream> ia(is);
-    ia.serialize(secret);
+    CapiLoadJson(secret_msg, secret);
     return bob->OnSecret(secret);
   } catch (std::exception&) {
     return false;
@@ -882,8 +984,8 @@ EXPORT bool E_TableOtComplaintBobOnSecret(handle_t c_bob,
   return true;
 }
 
-EXPORT bool E_TableOtComplaintBobGenerateClaim(handle_t c_bob,
-                                               char const* claim_file) {
+bool TableOtComplaintBobGenerateClaim(handle_t c_bob,
+                                      CapiOut const& claim_msg) {
   using namespace scheme::table;
   using namespace scheme::ot_complaint;
   auto bob = CapiObject<Bob<BobData>>::Get(c_bob);
@@ -893,63 +995,320 @@ EXPORT bool E_TableOtComplaintBobGenerateClaim(handle_t c_bob,
     Claim claim;
     if (!bob->GenerateClaim(claim)) return false;
 
-    yas::file_ostream os(claim_file);
-    yas::json_oarchive<yas::file_ostream> oa(os);
-    oa.serialize(claim);
+    CapiSaveJson(claim_msg, claim);
   } catch (std::exception&) {
     return false;
   }
 
   return true;
 }
+}  // namespace
 
-EXPORT bool E_TableOtComplaintBobSaveDecrypted(handle_t c_bob,
-                                               char const* file) {
+extern "C" {
+EXPORT handle_t E_TableOtComplaintAliceNew(handle_t c_alice_data,
+                                           uint8_t const* c_self_id,
+                                           uint8_t const* c_peer_id) {
   using namespace scheme::table;
   using namespace scheme::ot_complaint;
-  auto bob = CapiObject<Bob<BobData>>::Get(c_bob);
-  if (!bob) return false;
+  AliceDataPtr alice_data = CapiObject<AliceData>::Get(c_alice_data);
+  if (!alice_data) return nullptr;
+
+  h256_t self_id;
+  memcpy(self_id.data(), c_self_id, h256_t::size_value);
+  h256_t peer_id;
+  memcpy(peer_id.data(), c_peer_id, h256_t::size_value);
 
   try {
-    return bob->SaveDecrypted(file);
+    auto p = new Alice<AliceData>(alice_data, self_id, peer_id);
+    CapiObject<Alice<AliceData>>::Add(p);
+    return p;
   } catch (std::exception&) {
-    return false;
+    return nullptr;
   }
 }
 
-EXPORT bool E_TableOtComplaintBobFree(handle_t c_bob) {
+EXPORT bool E_TableOtComplaintAliceGetNegoRequest(handle_t c_alice,
+                                                  char const* request_file) {
+  return TableOtComplaintAliceGetNegoRequest(c_alice, CapiOut(request_file));
+}
+
+EXPORT bool E_TableOtComplaintAliceGetNegoRequestBuf(handle_t c_alice,
+                                                     buffer_t* request,
+                                                     alloc_t alloc, void* ctx) {
+  return TableOtComplaintAliceGetNegoRequest(c_alice,
+                                             CapiOut(request, alloc, ctx));
+}
+
+EXPORT bool E_TableOtComplaintAliceOnNegoRequest(handle_t c_alice,
+                                                 char const* request_file,
+                                                 char const* response_file) {
+  return TableOtComplaintAliceOnNegoRequest(c_alice, CapiIn(request_file),
+                                            CapiOut(response_file));
+}
+
+EXPORT bool E_TableOtComplaintAliceOnNegoRequestBuf(handle_t c_alice,
+                                                    buffer_t const* request,
+                                                    buffer_t* response,
+                                                    alloc_t alloc, void* ctx) {
+  return TableOtComplaintAliceOnNegoRequest(c_alice, CapiIn(request),
+                                            CapiOut(response, alloc, ctx));
+}
+
+EXPORT bool E_TableOtComplaintAliceOnNegoResponse(handle_t c_alice,
+                                                  char const* response_file) {
+  return TableOtComplaintAliceOnNegoResponse(c_alice, CapiIn(response_file));
+}
+
+EXPORT bool E_TableOtComplaintAliceOnNegoResponseBuf(handle_t c_alice,
+                                                     buffer_t const* response) {
+  return TableOtComplaintAliceOnNegoResponse(c_alice, CapiIn(response));
+}
+
+EXPORT bool E_TableOtComplaintAliceOnRequest(handle_t c_alice,
+                                             char const* request_file,
+                                             char const* response_file) {
+  return TableOtComplaintAliceOnRequest(c_alice, CapiIn(request_file),
+                                        CapiOut(response_file));
+}
+
+EXPORT bool E_TableOtComplaintAliceOnRequestBuf(handle_t c_alice,
+                                                buffer_t const* request,
+                                                buffer_t* response,
+                                                alloc_t alloc, void* ctx) {
+  return TableOtComplaintAliceOnRequest(c_alice, CapiIn(request),
+                                        CapiOut(response, alloc, ctx));
+}
+
+EXPORT bool E_TableOtComplaintAliceOnRequestAsync(handle_t c_alice,
+                                                  char const* request_file,
+                                                  char const* response_file,
+                                                  handle_t c_task) {
+  std::string request(request_file);
+  std::string response(response_file);
+  return CapiAsync(c_task, [=]() {
+    return TableOtComplaintAliceOnRequest(c_alice, CapiIn(request.c_str()),
+                                          CapiOut(response.c_str()));
+  });
+}
+
+EXPORT bool E_TableOtComplaintAliceOnRequestBufAsync(handle_t c_alice,
+                                                     buffer_t const* request,
+                                                     buffer_t* response,
+                                                     alloc_t alloc, void* ctx,
+                                                     handle_t c_task) {
+  return CapiAsync(c_task, [=]() {
+    return TableOtComplaintAliceOnRequest(c_alice, CapiIn(request),
+                                          CapiOut(response, alloc, ctx));
+  });
+}
+
+EXPORT bool E_TableOtComplaintAliceOnReceipt(handle_t c_alice,
+                                             char const* receipt_file,
+                                             char const* secret_file) {
+  return TableOtComplaintAliceOnReceipt(c_alice, CapiIn(receipt_file),
+                                        CapiOut(secret_file));
+}
+
+EXPORT bool E_TableOtComplaintAliceOnReceiptBuf(handle_t c_alice,
+                                                buffer_t const* receipt,
+                                                buffer_t* secret, alloc_t alloc,
+                                                void* ctx) {
+  return TableOtComplaintAliceOnReceipt(c_alice, CapiIn(receipt),
+                                        CapiOut(secret, alloc, ctx));
+}
+
+EXPORT bool E_TableOtComplaintAliceSetEvil(handle_t c_alice) {
   using namespace scheme::table;
   using namespace scheme::ot_complaint;
-  return CapiObject<Bob<BobData>>::Del(c_bob);
+  auto alice = CapiObject<Alice<AliceData>>::Get(c_alice);
+  if (!alice) return false;
+  alice->TestSetEvil();
+  return true;
 }
-}  // extern "C" ot_complaint
 
-// ot_vrfq
-extern "C" {
-EXPORT handle_t E_TableOtVrfqAliceNew(handle_t c_alice_data,
-                                      uint8_t const* c_self_id,
-                                      uint8_t const* c_peer_id) {
+EXPORT bool E_TableOtComplaintAliceFree(handle_t c_alice) {
   using namespace scheme::table;
-  using namespace scheme::table::ot_vrfq;
-  AliceDataPtr alice_data = CapiObject<AliceData>::Get(c_alice_data);
-  if (!alice_data) return nullptr;
+  using namespace scheme::ot_complaint;
+  return CapiObject<Alice<AliceData>>::Del(c_alice);
+}
+
+EXPORT handle_t E_TableOtComplaintBobNew(
+    handle_t c_bob_data, uint8_t const* c_self_id, uint8_t const* c_peer_id,
+    range_t const* c_demand, uint64_t c_demand_count, range_t const* c_phantom,
+    uint64_t c_phantom_count) {
+  using namespace scheme::table;
+  using namespace scheme::ot_complaint;
+  BobDataPtr bob_data = CapiObject<BobData>::Get(c_bob_data);
+  if (!bob_data) return nullptr;
 
   h256_t self_id;
   memcpy(self_id.data(), c_self_id, h256_t::size_value);
   h256_t peer_id;
   memcpy(peer_id.data(), c_peer_id, h256_t::size_value);
 
+  std::vector<Range> demands(c_demand_count);
+  for (uint64_t i = 0; i < c_demand_count; ++i) {
+    demands[i].start = c_demand[i].start;
+    demands[i].count = c_demand[i].count;
+  }
+
+  std::vector<Range> phantoms(c_phantom_count);
+  for (uint64_t i = 0; i < c_phantom_count; ++i) {
+    phantoms[i].start = c_phantom[i].start;
+    phantoms[i].count = c_phantom[i].count;
+  }
+
   try {
-    auto p = new Alice(alice_data, self_id, peer_id);
-    CapiObject<Alice>::Add(p);
+    auto p = new Bob<BobData>(bob_data, self_id, peer_id, std::move(demands),
+                              std::move(phantoms));
+    CapiObject<Bob<BobData>>::Add(p);
     return p;
   } catch (std::exception&) {
     return nullptr;
   }
 }
 
-EXPORT bool E_TableOtVrfqAliceGetNegoRequest(handle_t c_alice,
-                                             char const* request_file) {
+EXPORT bool E_TableOtComplaintBobGetNegoRequest(handle_t c_bob,
+                                                char const* request_file) {
+  return TableOtComplaintBobGetNegoRequest(c_bob, CapiOut(request_file));
+}
+
+EXPORT bool E_TableOtComplaintBobGetNegoRequestBuf(handle_t c_bob,
+                                                   buffer_t* request,
+                                                   alloc_t alloc, void* ctx) {
+  return TableOtComplaintBobGetNegoRequest(c_bob, CapiOut(request, alloc, ctx));
+}
+
+EXPORT bool E_TableOtComplaintBobOnNegoRequest(handle_t c_bob,
+                                               char const* request_file,
+                                               char const* response_file) {
+  return TableOtComplaintBobOnNegoRequest(c_bob, CapiIn(request_file),
+                                          CapiOut(response_file));
+}
+
+EXPORT bool E_TableOtComplaintBobOnNegoRequestBuf(handle_t c_bob,
+                                                  buffer_t const* request,
+                                                  buffer_t* response,
+                                                  alloc_t alloc, void* ctx) {
+  return TableOtComplaintBobOnNegoRequest(c_bob, CapiIn(request),
+                                          CapiOut(response, alloc, ctx));
+}
+
+EXPORT bool E_TableOtComplaintBobOnNegoResponse(handle_t c_bob,
+                                                char const* response_file) {
+  return TableOtComplaintBobOnNegoResponse(c_bob, CapiIn(response_file));
+}
+
+EXPORT bool E_TableOtComplaintBobOnNegoResponseBuf(handle_t c_bob,
+                                                   buffer_t const* response) {
+  return TableOtComplaintBobOnNegoResponse(c_bob, CapiIn(response));
+}
+
+EXPORT bool E_TableOtComplaintBobSetG1Uncompressed(handle_t c_bob,
+                                                   bool uncompressed) {
+  using namespace scheme::table;
+  using namespace scheme::ot_complaint;
+  auto bob = CapiObject<Bob<BobData>>::Get(c_bob);
+  if (!bob) return false;
+  bob->SetG1Uncompressed(uncompressed);
+  return true;
+}
+
+EXPORT bool E_TableOtComplaintBobGetRequest(handle_t c_bob,
+                                            char const* request_file) {
+  return TableOtComplaintBobGetRequest(c_bob, CapiOut(request_file));
+}
+
+EXPORT bool E_TableOtComplaintBobGetRequestBuf(handle_t c_bob,
+                                               buffer_t* request, alloc_t alloc,
+                                               void* ctx) {
+  return TableOtComplaintBobGetRequest(c_bob, CapiOut(request, alloc, ctx));
+}
+
+EXPORT bool E_TableOtComplaintBobOnResponse(handle_t c_bob,
+                                            char const* response_file,
+                                            char const* receipt_file) {
+  return TableOtComplaintBobOnResponse(c_bob, CapiIn(response_file),
+                                       CapiOut(receipt_file));
+}
+
+EXPORT bool E_TableOtComplaintBobOnResponseBuf(handle_t c_bob,
+                                               buffer_t const* response,
+                                               buffer_t* receipt, alloc_t alloc,
+                                               void* ctx) {
+  return TableOtComplaintBobOnResponse(c_bob, CapiIn(response),
+                                       CapiOut(receipt, alloc, ctx));
+}
+
+EXPORT bool E_TableOtComplaintBobOnResponseAsync(handle_t c_bob,
+                                                 char const* response_file,
+                                                 char const* receipt_file,
+                                                 handle_t c_task) {
+  std::string response(response_file);
+  std::string receipt(receipt_file);
+  return CapiAsync(c_task, [=]() {
+    return TableOtComplaintBobOnResponse(c_bob, CapiIn(response.c_str()),
+                                         CapiOut(receipt.c_str()));
+  });
+}
+
+EXPORT bool E_TableOtComplaintBobOnResponseBufAsync(handle_t c_bob,
+                                                    buffer_t const* response,
+                                                    buffer_t* receipt,
+                                                    alloc_t alloc, void* ctx,
+                                                    handle_t c_task) {
+  return CapiAsync(c_task, [=]() {
+    return TableOtComplaintBobOnResponse(c_bob, CapiIn(response),
+                                         CapiOut(receipt, alloc, ctx));
+  });
+}
+
+EXPORT bool E_TableOtComplaintBobOnSecret(handle_t c_bob,
+                                          char const* secret_file) {
+  return TableOtComplaintBobOnSecret(c_bob, CapiIn(secret_file));
+}
+
+EXPORT bool E_TableOtComplaintBobOnSecretBuf(handle_t c_bob,
+                                             buffer_t const* secret) {
+  return TableOtComplaintBobOnSecret(c_bob, CapiIn(secret));
+}
+
+EXPORT bool E_TableOtComplaintBobGenerateClaim(handle_t c_bob,
+                                               char const* claim_file) {
+  return TableOtComplaintBobGenerateClaim(c_bob, CapiOut(claim_file));
+}
+
+EXPORT bool E_TableOtComplaintBobGenerateClaimBuf(handle_t c_bob,
+                                                  buffer_t* claim,
+                                                  alloc_t alloc, void* ctx) {
+  return TableOtComplaintBobGenerateClaim(c_bob, CapiOut(claim, alloc, ctx));
+}
+
+EXPORT bool E_TableOtComplaintBobSaveDecrypted(handle_t c_bob,
+                                               char const* file) {
+  using namespace scheme::table;
+  using namespace scheme::ot_complaint;
+  auto bob = CapiObject<Bob<BobData>>::Get(c_bob);
+  if (!bob) return false;
+
+  try {
+    return bob->SaveDecrypted(file);
+  } catch (std::exception&) {
+    return false;
+  }
+}
+
+EXPORT bool E_TableOtComplaintBobFree(handle_t c_bob) {
+  using namespace scheme::table;
+  using namespace scheme::ot_complaint;
+  return CapiObject<Bob<BobData>>::Del(c_bob);
+}
+}  // extern "C" ot_complaint
+
+// ot_vrfq
+namespace {
+bool TableOtVrfqAliceGetNegoRequest(handle_t c_alice,
+                                    CapiOut const& request_msg) {
   using namespace scheme::table;
   using namespace scheme::table::ot_vrfq;
   AlicePtr alice = CapiObject<Alice>::Get(c_alice);
@@ -958,9 +1317,7 @@ EXPORT bool E_TableOtVrfqAliceGetNegoRequest(handle_t c_alice,
   try {
     NegoARequest request;
     alice->GetNegoReqeust(request);
-    yas::file_ostream os(request_file);
-    yas::binary_oarchive<yas::file_ostream, YasBinF()> oa(os);
-    oa.serialize(request);
+    CapiSaveBin(request_msg, request);
   } catch (std::exception&) {
     return false;
   }
@@ -968,9 +1325,8 @@ EXPORT bool E_TableOtVrfqAliceGetNegoRequest(handle_t c_alice,
   return true;
 }
 
-EXPORT bool E_TableOtVrfqAliceOnNegoRequest(handle_t c_alice,
-                                            char const* request_file,
-                                            char const* response_file) {
+bool TableOtVrfqAliceOnNegoRequest(handle_t c_alice, CapiIn const& request_msg,
+                                   CapiOut const& response_msg) {
   using namespace scheme::table;
   using namespace scheme::table::ot_vrfq;
   AlicePtr alice = CapiObject<Alice>::Get(c_alice);
@@ -978,16 +1334,12 @@ EXPORT bool E_TableOtVrfqAliceOnNegoRequest(handle_t c_alice,
 
   try {
     NegoBRequest request;
-    yas::file_istream is(request_file);
-    yas::binary_iarchive<yas::file_istream, YasBinF()> ia(is);
-    ia.serialize(request);
+    CapiLoadBin(request_msg, request);
 
     NegoBResponse response;
     if (!alice->OnNegoRequest(request, response)) return false;
 
-    yas::file_ostream os(response_file);
-    yas::binary_oarchive<yas::file_ostream, YasBinF()> oa(os);
-    oa.serialize(response);
+    CapiSaveBin(response_msg, response);
   } catch (std::exception&) {
     return false;
   }
@@ -995,8 +1347,8 @@ EXPORT bool E_TableOtVrfqAliceOnNegoRequest(handle_t c_alice,
   return true;
 }
 
-EXPORT bool E_TableOtVrfqAliceOnNegoResponse(handle_t c_alice,
-                                             char const* response_file) {
+bool TableOtVrfqAliceOnNegoResponse(handle_t c_alice,
+                                    CapiIn const& response_msg) {
   using namespace scheme::table;
   using namespace scheme::table::ot_vrfq;
   AlicePtr alice = CapiObject<Alice>::Get(c_alice);
@@ -1004,9 +1356,7 @@ EXPORT bool E_TableOtVrfqAliceOnNegoResponse(handle_t c_alice,
 
   try {
     NegoAResponse response;
-    yas::file_istream is(response_file);
-    yas::binary_iarchive<yas::file_istream, YasBinF()> ia(is);
-    ia.serialize(response);
+    CapiLoadBin(response_msg, response);
 
     if (!alice->OnNegoResponse(response)) return false;
   } catch (std::exception&) {
@@ -1016,9 +1366,8 @@ EXPORT bool E_TableOtVrfqAliceOnNegoResponse(handle_t c_alice,
   return true;
 }
 
-EXPORT bool E_TableOtVrfqAliceOnRequest(handle_t c_alice,
-                                        char const* request_file,
-                                        char const* response_file) {
+bool TableOtVrfqAliceOnRequest(handle_t c_alice, CapiIn const& request_msg,
+                               CapiOut const& response_msg) {
   using namespace scheme::table;
   using namespace scheme::table::ot_vrfq;
   AlicePtr alice = CapiObject<Alice>::Get(c_alice);
@@ -1026,16 +1375,12 @@ EXPORT bool E_TableOtVrfqAliceOnRequest(handle_t c_alice,
 
   try {
     Request request;
-    yas::file_istream is(request_file);
-    yas::json_iarchive<yas::file_istream> ia(is);
-    ia.serialize(request);
+    CapiLoadJson(request_msg, request);
 
     Response response;
     if (!alice->OnRequest(request, response)) return false;
 
-    yas::file_ostream os(response_file);
-    yas::binary_oarchive<yas::file_ostream, YasBinF()> oa(os);
-    oa.serialize(response);
+    CapiSaveBin(response_msg, response);
   } catch (std::exception&) {
     return false;
   }
@@ -1043,9 +1388,8 @@ EXPORT bool E_TableOtVrfqAliceOnRequest(handle_t c_alice,
   return true;
 }
 
-EXPORT bool E_TableOtVrfqAliceOnReceipt(handle_t c_alice,
-                                        char const* receipt_file,
-                                        char const* secret_file) {
+bool TableOtVrfqAliceOnReceipt(handle_t c_alice, CapiIn const& receipt_msg,
+                               CapiOut const& secret_msg) {
   using namespace scheme::table;
   using namespace scheme::table::ot_vrfq;
   AlicePtr alice = CapiObject<Alice>::Get(c_alice);
@@ -1053,16 +1397,68 @@ EXPORT bool E_TableOtVrfqAliceOnReceipt(handle_t c_alice,
 
   try {
     Receipt receipt;
-    yas::file_istream is(receipt_file);
-    yas::json_iarchive<yas::file_istream> ia(is);
-    ia.serialize(receipt);
+    CapiLoadJson(receipt_msg, receipt);
 
     Secret secret;
     if (!alice->OnReceipt(receipt, secret)) return false;
 
-    yas::file_ostream os(secret_file);
-    yas::json_oarchive<yas::file_ostream> oa(os);
-    oa.serialize(secret);
+    CapiSaveJson(secret_msg, secret);
+  } catch (std::exception&) {
+    return false;
+  }
+
+  return true;
+}
+
+bool TableOtVrfqBobGetNegoRequest(handle_t c_bob, CapiOut const& request_msg) {
+  using namespace scheme::table;
+  using namespace scheme::table::ot_vrfq;
+  BobPtr bob = CapiObject<Bob>::Get(c_bob);
+  if (!bob) return false;
+
+  try {
+    NegoBRequest request;
+    bob->GetNegoReqeust(request);
+    CapiSaveBin(request_msg, request);
+  } catch (std::exception&) {
+    return false;
+  }
+
+  return true;
+}
+
+bool TableOtVrfqBobOnNegoRequest(handle_t c_bob, CapiIn const& request_msg,
+                                 CapiOut const& response_msg) {
+  using namespace scheme::table;
+  using namespace scheme::table::ot_vrfq;
+  BobPtr bob = CapiObject<Bob>::Get(c_bob);
+  if (!bob) return false;
+
+  try {
+    NegoARequest request;
+    CapiLoadBin(request_msg, request);
+
+    NegoAResponse response;
+    if (!bob->OnNegoRequest(request, response)) return false;
+
+    CapiSaveBin(response_msg, response);
+  } catch (std::exception&) {
+    return false;
+  }
+
+  return true;
+}
+
+bool TableOtVrfqBobOnNegoResponse(handle_t c_bob, CapiIn const& response_msg) {
+  using namespace scheme::table;
+  using namespace scheme::table::ot_vrfq;
+  BobPtr bob = CapiObject<Bob>::Get(c_bob);
+  if (!bob) return false;
+
+  try {
+    NegoBResponse response;
+    CapiLoadBin(response_msg, response);
+    return bob->OnNegoResponse(response);
   } catch (std::exception&) {
     return false;
   }
@@ -1070,6 +1466,184 @@ EXPORT bool E_TableOtVrfqAliceOnReceipt(handle_t c_alice,
   return true;
 }
 
+bool TableOtVrfqBobGetRequest(handle_t c_bob, CapiOut const& request_msg) {
+  using namespace scheme::table;
+  using namespace scheme::table::ot_vrfq;
+  BobPtr bob = CapiObject<Bob>::Get(c_bob);
+  if (!bob) return false;
+
+  try {
+    Request request;
+    bob->GetRequest(request);
+    CapiSaveJson(request_msg, request);
+  } catch (std::exception&) {
+    return false;
+  }
+
+  return true;
+}
+
+bool TableOtVrfqBobOnResponse(handle_t c_bob, CapiIn const& response_msg,
+                              CapiOut const& receipt_msg) {
+  using namespace scheme::table;
+  using namespace scheme::table::ot_vrfq;
+  BobPtr bob = CapiObject<Bob>::Get(c_bob);
+  if (!bob) return false;
+
+  try {
+    Response response;
+    CapiLoadBin(response_msg, response);
+
+    Receipt receipt;
+    if (!bob->OnResponse(response, receipt)) return false;
+
+    CapiSaveJson(receipt_msg, receipt);
+  } catch (std::exception&) {
+    return false;
+  }
+
+  return true;
+}
+
+bool TableOtVrfqBobOnSecret(handle_t c_bob, CapiIn const& secret_msg,
+                            CapiOut const& positions_msg) {
+  using namespace scheme::table;
+  using namespace scheme::table::ot_vrfq;
+  BobPtr bob = CapiObject<Bob>::Get(c_bob);
+  if (!bob) return false;
+
+  try {
+    Secret secret;
+    CapiLoadJson(secret_msg, secret);
+
+    std::vector<std::vector<uint64_t>> positions;
+    if (!bob->OnSecret(secret, positions)) {
+      assert(false);
+      return false;
+    }
+
+    CapiSaveJson(positions_msg, positions);
+    return true;
+  } catch (std::exception&) {
+    return false;
+  }
+
+  return true;
+}
+}  // namespace
+
+extern "C" {
+EXPORT handle_t E_TableOtVrfqAliceNew(handle_t c_alice_data,
+                                      uint8_t const* c_self_id,
+                                      uint8_t const* c_peer_id) {
+  using namespace scheme::table;
+  using namespace scheme::table::ot_vrfq;
+  AliceDataPtr alice_data = CapiObject<AliceData>::Get(c_alice_data);
+  if (!alice_data) return nullptr;
+
+  h256_t self_id;
+  memcpy(self_id.data(), c_self_id, h256_t::size_value);
+  h256_t peer_id;
+  memcpy(peer_id.data(), c_peer_id, h256_t::size_value);
+
+  try {
+    auto p = new Alice(alice_data, self_id, peer_id);
+    CapiObject<Alice>::Add(p);
+    return p;
+  } catch (std::exception&) {
+    return nullptr;
+  }
+}
+
+EXPORT bool E_TableOtVrfqAliceGetNegoRequest(handle_t c_alice,
+                                             char const* request_file) {
+  return TableOtVrfqAliceGetNegoRequest(c_alice, CapiOut(request_file));
+}
+
+EXPORT bool E_TableOtVrfqAliceGetNegoRequestBuf(handle_t c_alice,
+                                                buffer_t* request,
+                                                alloc_t alloc, void* ctx) {
+  return TableOtVrfqAliceGetNegoRequest(c_alice, CapiOut(request, alloc, ctx));
+}
+
+EXPORT bool E_TableOtVrfqAliceOnNegoRequest(handle_t c_alice,
+                                            char const* request_file,
+                                            char const* response_file) {
+  return TableOtVrfqAliceOnNegoRequest(c_alice, CapiIn(request_file),
+                                       CapiOut(response_file));
+}
+
+EXPORT bool E_TableOtVrfqAliceOnNegoRequestBuf(handle_t c_alice,
+                                               buffer_t const* request,
+                                               buffer_t* response,
+                                               alloc_t alloc, void* ctx) {
+  return TableOtVrfqAliceOnNegoRequest(c_alice, CapiIn(request),
+                                       CapiOut(response, alloc, ctx));
+}
+
+EXPORT bool E_TableOtVrfqAliceOnNegoResponse(handle_t c_alice,
+                                             char const* response_file) {
+  return TableOtVrfqAliceOnNegoResponse(c_alice, CapiIn(response_file));
+}
+
+EXPORT bool E_TableOtVrfqAliceOnNegoResponseBuf(handle_t c_alice,
+                                                buffer_t const* response) {
+  return TableOtVrfqAliceOnNegoResponse(c_alice, CapiIn(response));
+}
+
+EXPORT bool E_TableOtVrfqAliceOnRequest(handle_t c_alice,
+                                        char const* request_file,
+                                        char const* response_file) {
+  return TableOtVrfqAliceOnRequest(c_alice, CapiIn(request_file),
+                                   CapiOut(response_file));
+}
+
+EXPORT bool E_TableOtVrfqAliceOnRequestBuf(handle_t c_alice,
+                                           buffer_t const* request,
+                                           buffer_t* response, alloc_t alloc,
+                                           void* ctx) {
+  return TableOtVrfqAliceOnRequest(c_alice, CapiIn(request),
+                                   CapiOut(response, alloc, ctx));
+}
+
+EXPORT bool E_TableOtVrfqAliceOnRequestAsync(handle_t c_alice,
+                                             char const* request_file,
+                                             char const* response_file,
+                                             handle_t c_task) {
+  std::string request(request_file);
+  std::string response(response_file);
+  return CapiAsync(c_task, [=]() {
+    return TableOtVrfqAliceOnRequest(c_alice, CapiIn(request.c_str()),
+                                     CapiOut(response.c_str()));
+  });
+}
+
+EXPORT bool E_TableOtVrfqAliceOnRequestBufAsync(handle_t c_alice,
+                                                buffer_t const* request,
+                                                buffer_t* response,
+                                                alloc_t alloc, void* ctx,
+                                                handle_t c_task) {
+  return CapiAsync(c_task, [=]() {
+    return TableOtVrfqAliceOnRequest(c_alice, CapiIn(request),
+                                     CapiOut(response, alloc, ctx));
+  });
+}
+
+EXPORT bool E_TableOtVrfqAliceOnReceipt(handle_t c_alice,
+                                        char const* receipt_file,
+                                        char const* secret_file) {
+  return TableOtVrfqAliceOnReceipt(c_alice, CapiIn(receipt_file),
+                                   CapiOut(secret_file));
+}
+
+EXPORT bool E_TableOtVrfqAliceOnReceiptBuf(handle_t c_alice,
+                                           buffer_t const* receipt,
+                                           buffer_t* secret, alloc_t alloc,
+                                           void* ctx) {
+  return TableOtVrfqAliceOnReceipt(c_alice, CapiIn(receipt),
+                                   CapiOut(secret, alloc, ctx));
+}
+
 EXPORT bool E_TableOtVrfqAliceFree(handle_t c_alice) {
   using namespace scheme::table::ot_vrfq;
   return CapiObject<Alice>::Del(c_alice);
@@ -1112,44 +1686,122 @@ E_TableOtVrfqBobNew(handle_t c_bob_data, uint8_t const* c_self_id,
 
 EXPORT bool E_TableOtVrfqBobGetNegoRequest(handle_t c_bob,
                                            char const* request_file) {
-  using namespace scheme::table;
-  using namespace scheme::table::ot_vrfq;
-  BobPtr bob = CapiObject<Bob>::Get(c_bob);
-  if (!bob) return false;
+  return TableOtVrfqBobGetNegoRequest(c_bob, CapiOut(request_file));
+}
 
-  try {
-    NegoBRequest request;
-    bob->GetNegoReqeust(request);
-    yas::file_ostream os(request_file);
-    yas::binary_oarchive<yas::file_ostream, YasBinF()> oa(os);
-    oa.serialize(request);
-  } catch (std::exception&) {
-    return false;
-  }
+EXPORT bool E_TableOtVrfqBobGetNegoRequestBuf(handle_t c_bob, buffer_t* request,
+                                              alloc_t alloc, void* ctx) {
+  return TableOtVrfqBobGetNegoRequest(c_bob, CapiOut(request, alloc, ctx));
+}
 
-  return true;
+EXPORT bool E_TableOtVrfqBobOnNegoRequest(handle_t c_bob,
+                                          char const* request_file,
+                                          char const* response_file) {
+  return TableOtVrfqBobOnNegoRequest(c_bob, CapiIn(request_file),
+                                     CapiOut(response_file));
 }
 
-EXPORT bool E_TableOtVrfqBobOnNegoRequest(handle_t c_bob,
-                                          char const* request_file,
-                                          char const* response_file) {
+EXPORT bool E_TableOtVrfqBobOnNegoRequestBuf(handle_t c_bob,
+                                             buffer_t const* request,
+                                             buffer_t* response, alloc_t alloc,
+                                             void* ctx) {
+  return TableOtVrfqBobOnNegoRequest(c_bob, CapiIn(request),
+                                     CapiOut(response, alloc, ctx));
+}
+
+EXPORT bool E_TableOtVrfqBobOnNegoResponse(handle_t c_bob,
+                                           char const* response_file) {
+  return TableOtVrfqBobOnNegoResponse(c_bob, CapiIn(response_file));
+}
+
+EXPORT bool E_TableOtVrfqBobOnNegoResponseBuf(handle_t c_bob,
+                                              buffer_t const* response) {
+  return TableOtVrfqBobOnNegoResponse(c_bob, CapiIn(response));
+}
+
+EXPORT bool E_TableOtVrfqBobGetRequest(handle_t c_bob,
+                                       char const* request_file) {
+  return TableOtVrfqBobGetRequest(c_bob, CapiOut(request_file));
+}
+
+EXPORT bool E_TableOtVrfqBobGetRequestBuf(handle_t c_bob, buffer_t* request,
+                                          alloc_t alloc, void* ctx) {
+  return TableOtVrfqBobGetRequest(c_bob, CapiOut(request, alloc, ctx));
+}
+
+EXPORT bool E_TableOtVrfqBobOnResponse(handle_t c_bob,
+                                       char const* response_file,
+                                       char const* receipt_file) {
+  return TableOtVrfqBobOnResponse(c_bob, CapiIn(response_file),
+                                  CapiOut(receipt_file));
+}
+
+EXPORT bool E_TableOtVrfqBobOnResponseBuf(handle_t c_bob,
+                                          buffer_t const* response,
+                                          buffer_t* receipt, alloc_t alloc,
+                                          void* ctx) {
+  return TableOtVrfqBobOnResponse(c_bob, CapiIn(response),
+                                  CapiOut(receipt, alloc, ctx));
+}
+
+EXPORT bool E_TableOtVrfqBobOnResponseAsync(handle_t c_bob,
+                                            char const* response_file,
+                                            char const* receipt_file,
+                                            handle_t c_task) {
+  std::string response(response_file);
+  std::string receipt(receipt_file);
+  return CapiAsync(c_task, [=]() {
+    return TableOtVrfqBobOnResponse(c_bob, CapiIn(response.c_str()),
+                                    CapiOut(receipt.c_str()));
+  });
+}
+
+EXPORT bool E_TableOtVrfqBobOnResponseBufAsync(handle_t c_bob,
+                                               buffer_t const* response,
+                                               buffer_t* receipt, alloc_t alloc,
+                                               void* ctx, handle_t c_task) {
+  return CapiAsync(c_task, [=]() {
+    return TableOtVrfqBobOnResponse(c_bob, CapiIn(response),
+                                    CapiOut(receipt, alloc, ctx));
+  });
+}
+
+EXPORT bool E_TableOtVrfqBobOnSecret(handle_t c_bob, char const* secret_file,
+                                     char const* positions_file) {
+  return TableOtVrfqBobOnSecret(c_bob, CapiIn(secret_file),
+                                CapiOut(positions_file));
+}
+
+EXPORT bool E_TableOtVrfqBobOnSecretBuf(handle_t c_bob, buffer_t const* secret,
+                                        buffer_t* positions, alloc_t alloc,
+                                        void* ctx) {
+  return TableOtVrfqBobOnSecret(c_bob, CapiIn(secret),
+                                CapiOut(positions, alloc, ctx));
+}
+
+EXPORT bool E_TableOtVrfqBobFree(handle_t c_bob) {
+  using namespace scheme::table::ot_vrfq;
+  return CapiObject<Bob>::Del(c_bob);
+}
+}  // extern "C" ot_vrfq
+
+// vrfq
+namespace {
+bool TableVrfqAliceOnRequest(handle_t c_alice, CapiIn const& request_msg,
+                             CapiOut const& response_msg) {
   using namespace scheme::table;
-  using namespace scheme::table::ot_vrfq;
-  BobPtr bob = CapiObject<Bob>::Get(c_bob);
-  if (!bob) return false;
+  using namespace scheme::table::vrfq;
+  AlicePtr alice = CapiObject<Alice>::Get(c_alice);
+  if (!alice) return false;
 
   try {
-    NegoARequest request;
-    yas::file_istream is(request_file);
-    yas::binary_iarchive<yas::file_istream, YasBinF()> ia(is);
-    ia.serialize(request);
+    Request request;
+    CapiLoadJson(request_msg, request);
 
-    NegoAResponse response;
-    if (!bob->OnNegoRequest(request, response)) return false;
+    Response response;
+    if (!alice->OnRequest(request, response)) return false;
 
-    yas::file_ostream os(response_file);
-    yas::binary_oarchive<yas::file_ostream, YasBinF()> oa(os);
-    oa.serialize(response);
+    CapiSaveBin(response_msg, response);
   } catch (std::exception&) {
     return false;
   }
@@ -1157,19 +1809,21 @@ EXPORT bool E_TableOtVrfqBobOnNegoRequest(handle_t c_bob,
   return true;
 }
 
-EXPORT bool E_TableOtVrfqBobOnNegoResponse(handle_t c_bob,
-                                           char const* response_file) {
+bool TableVrfqAliceOnReceipt(handle_t c_alice, CapiIn const& receipt_msg,
+                             CapiOut const& secret_msg) {
   using namespace scheme::table;
-  using namespace scheme::table::ot_vrfq;
-  BobPtr bob = CapiObject<Bob>::Get(c_bob);
-  if (!bob) return false;
+  using namespace scheme::table::vrfq;
+  AlicePtr alice = CapiObject<Alice>::Get(c_alice);
+  if (!alice) return false;
 
   try {
-    NegoBResponse response;
-    yas::file_istream is(response_file);
-    yas::binary_iarchive<yas::file_istream, YasBinF()> ia(is);
-    ia.serialize(response);
-    return bob->OnNegoResponse(response);
+    Receipt receipt;
+    CapiLoadJson(receipt_msg, receipt);
+
+    Secret secret;
+    if (!alice->OnReceipt(receipt, secret)) return false;
+
+    CapiSaveJson(secret_msg, secret);
   } catch (std::exception&) {
     return false;
   }
@@ -1177,19 +1831,16 @@ EXPORT bool E_TableOtVrfqBobOnNegoResponse(handle_t c_bob,
   return true;
 }
 
-EXPORT bool E_TableOtVrfqBobGetRequest(handle_t c_bob,
-                                       char const* request_file) {
+bool TableVrfqBobGetRequest(handle_t c_bob, CapiOut const& request_msg) {
   using namespace scheme::table;
-  using namespace scheme::table::ot_vrfq;
+  using namespace scheme::table::vrfq;
   BobPtr bob = CapiObject<Bob>::Get(c_bob);
   if (!bob) return false;
 
   try {
     Request request;
     bob->GetRequest(request);
-    yas::file_ostream os(request_file);
-    yas::json_oarchive<yas::file_ostream> oa(os);
-    oa.serialize(request);
+    CapiSaveJson(request_msg, request);
   } catch (std::exception&) {
     return false;
   }
@@ -1197,26 +1848,21 @@ EXPORT bool E_TableOtVrfqBobGetRequest(handle_t c_bob,
   return true;
 }
 
-EXPORT bool E_TableOtVrfqBobOnResponse(handle_t c_bob,
-                                       char const* response_file,
-                                       char const* receipt_file) {
+bool TableVrfqBobOnResponse(handle_t c_bob, CapiIn const& response_msg,
+                            CapiOut const& receipt_msg) {
   using namespace scheme::table;
-  using namespace scheme::table::ot_vrfq;
+  using namespace scheme::table::vrfq;
   BobPtr bob = CapiObject<Bob>::Get(c_bob);
   if (!bob) return false;
 
   try {
     Response response;
-    yas::file_istream is(response_file);
-    yas::binary_iarchive<yas::file_istream, YasBinF()> ia(is);
-    ia.serialize(response);
+    CapiLoadBin(response_msg, response);
 
     Receipt receipt;
     if (!bob->OnResponse(response, receipt)) return false;
 
-    yas::file_ostream os(receipt_file);
-    yas::json_oarchive<yas::file_ostream> oa(os);
-    oa.serialize(receipt);
+    CapiSaveJson(receipt_msg, receipt);
   } catch (std::exception&) {
     return false;
   }
@@ -1224,18 +1870,16 @@ EXPORT bool E_TableOtVrfqBobOnResponse(handle_t c_bob,
   return true;
 }
 
-EXPORT bool E_TableOtVrfqBobOnSecret(handle_t c_bob, char const* secret_file,
-                                     char const* positions_file) {
+bool TableVrfqBobOnSecret(handle_t c_bob, CapiIn const& secret_msg,
+                          CapiOut const& positions_msg) {
   using namespace scheme::table;
-  using namespace scheme::table::ot_vrfq;
+  using namespace scheme::table::vrfq;
   BobPtr bob = CapiObject<Bob>::Get(c_bob);
   if (!bob) return false;
 
   try {
     Secret secret;
-    yas::file_istream is(secret_file);
-    yas::json_iarchive<yas::file_istream> ia(is);
-    ia.serialize(secret);
+    CapiLoadJson(secret_msg, secret);
 
     std::vector<std::vector<uint64_t>> positions;
     if (!bob->OnSecret(secret, positions)) {
@@ -1243,9 +1887,7 @@ EXPORT bool E_TableOtVrfqBobOnSecret(handle_t c_bob, char const* secret_file,
       return false;
     }
 
-    yas::file_ostream os(positions_file);
-    yas::json_oarchive<yas::file_ostream> oa(os);
-    oa.serialize(positions);
+    CapiSaveJson(positions_msg, positions);
     return true;
   } catch (std::exception&) {
     return false;
@@ -1253,14 +1895,8 @@ EXPORT bool E_TableOtVrfqBobOnSecret(handle_t c_bob, char const* secret_file,
 
   return true;
 }
+}  // namespace
 
-EXPORT bool E_TableOtVrfqBobFree(handle_t c_bob) {
-  using namespace scheme::table::ot_vrfq;
-  return CapiObject<Bob>::Del(c_bob);
-}
-}  // extern "C" ot_vrfq
-
-// vrfq
 extern "C" {
 EXPORT handle_t E_TableVrfqAliceNew(handle_t c_alice_data,
                                     uint8_t const* c_self_id,
@@ -1287,55 +1923,53 @@ EXPORT handle_t E_TableVrfqAliceNew(handle_t c_alice_data,
 EXPORT bool E_TableVrfqAliceOnRequest(handle_t c_alice,
                                       char const* request_file,
                                       char const* response_file) {
-  using namespace scheme::table;
-  using namespace scheme::table::vrfq;
-  AlicePtr alice = CapiObject<Alice>::Get(c_alice);
-  if (!alice) return false;
-
-  try {
-    Request request;
-    yas::file_istream is(request_file);
-    yas::json_iarchive<yas::file_istream> ia(is);
-    ia.serialize(request);
+  return TableVrfqAliceOnRequest(c_alice, CapiIn(request_file),
+                                 CapiOut(response_file));
+}
 
-    Response response;
-    if (!alice->OnRequest(request, response)) return false;
+EXPORT bool E_TableVrfqAliceOnRequestBuf(handle_t c_alice,
+                                         buffer_t const* request,
+                                         buffer_t* response, alloc_t alloc,
+                                         void* ctx) {
+  return TableVrfqAliceOnRequest(c_alice, CapiIn(request),
+                                 CapiOut(response, alloc, ctx));
+}
 
-    yas::file_ostream os(response_file);
-    yas::binary_oarchive<yas::file_ostream, YasBinF()> oa(os);
-    oa.serialize(response);
-  } catch (std::exception&) {
-    return false;
-  }
+EXPORT bool E_TableVrfqAliceOnRequestAsync(handle_t c_alice,
+                                           char const* request_file,
+                                           char const* response_file,
+                                           handle_t c_task) {
+  std::string request(request_file);
+  std::string response(response_file);
+  return CapiAsync(c_task, [=]() {
+    return TableVrfqAliceOnRequest(c_alice, CapiIn(request.c_str()),
+                                   CapiOut(response.c_str()));
+  });
+}
 
-  return true;
+EXPORT bool E_TableVrfqAliceOnRequestBufAsync(handle_t c_alice,
+                                              buffer_t const* request,
+                                              buffer_t* response, alloc_t alloc,
+                                              void* ctx, handle_t c_task) {
+  return CapiAsync(c_task, [=]() {
+    return TableVrfqAliceOnRequest(c_alice, CapiIn(request),
+                                   CapiOut(response, alloc, ctx));
+  });
 }
 
 EXPORT bool E_TableVrfqAliceOnReceipt(handle_t c_alice,
                                       char const* receipt_file,
                                       char const* secret_file) {
-  using namespace scheme::table;
-  using namespace scheme::table::vrfq;
-  AlicePtr alice = CapiObject<Alice>::Get(c_alice);
-  if (!alice) return false;
-
-  try {
-    Receipt receipt;
-    yas::file_istream is(receipt_file);
-    yas::json_iarchive<yas::file_istream> ia(is);
-    ia.serialize(receipt);
-
-    Secret secret;
-    if (!alice->OnReceipt(receipt, secret)) return false;
-
-    yas::file_ostream os(secret_file);
-    yas::json_oarchive<yas::file_ostream> oa(os);
-    oa.serialize(secret);
-  } catch (std::exception&) {
-    return false;
-  }
+  return TableVrfqAliceOnReceipt(c_alice, CapiIn(receipt_file),
+                                 CapiOut(secret_file));
+}
 
-  return true;
+EXPORT bool E_TableVrfqAliceOnReceiptBuf(handle_t c_alice,
+                                         buffer_t const* receipt,
+                                         buffer_t* secret, alloc_t alloc,
+                                         void* ctx) {
+  return TableVrfqAliceOnReceipt(c_alice, CapiIn(receipt),
+                                 CapiOut(secret, alloc, ctx));
 }
 
 EXPORT bool E_TableVrfqAliceFree(handle_t c_alice) {
@@ -1373,17 +2007,128 @@ EXPORT handle_t E_TableVrfqBobNew(handle_t c_bob_data, uint8_t const* c_self_id,
 }
 
 EXPORT bool E_TableVrfqBobGetRequest(handle_t c_bob, char const* request_file) {
-  using namespace scheme::table;
+  return TableVrfqBobGetRequest(c_bob, CapiOut(request_file));
+}
+
+EXPORT bool E_TableVrfqBobGetRequestBuf(handle_t c_bob, buffer_t* request,
+                                        alloc_t alloc, void* ctx) {
+  return TableVrfqBobGetRequest(c_bob, CapiOut(request, alloc, ctx));
+}
+
+EXPORT bool E_TableVrfqBobOnResponse(handle_t c_bob, char const* response_file,
+                                     char const* receipt_file) {
+  return TableVrfqBobOnResponse(c_bob, CapiIn(response_file),
+                                CapiOut(receipt_file));
+}
+
+EXPORT bool E_TableVrfqBobOnResponseBuf(handle_t c_bob,
+                                        buffer_t const* response,
+                                        buffer_t* receipt, alloc_t alloc,
+                                        void* ctx) {
+  return TableVrfqBobOnResponse(c_bob, CapiIn(response),
+                                CapiOut(receipt, alloc, ctx));
+}
+
+EXPORT bool E_TableVrfqBobOnResponseAsync(handle_t c_bob,
+                                          char const* response_file,
+                                          char const* receipt_file,
+                                          handle_t c_task) {
+  std::string response(response_file);
+  std::string receipt(receipt_file);
+  return CapiAsync(c_task, [=]() {
+    return TableVrfqBobOnResponse(c_bob, CapiIn(response.c_str()),
+                                  CapiOut(receipt.c_str()));
+  });
+}
+
+EXPORT bool E_TableVrfqBobOnResponseBufAsync(handle_t c_bob,
+                                             buffer_t const* response,
+                                             buffer_t* receipt, alloc_t alloc,
+                                             void* ctx, handle_t c_task) {
+  return CapiAsync(c_task, [=]() {
+    return TableVrfqBobOnResponse(c_bob, CapiIn(response),
+                                  CapiOut(receipt, alloc, ctx));
+  });
+}
+
+EXPORT bool E_TableVrfqBobOnSecret(handle_t c_bob, char const* secret_file,
+                                   char const* positions_file) {
+  return TableVrfqBobOnSecret(c_bob, CapiIn(secret_file),
+                              CapiOut(positions_file));
+}
+
+EXPORT bool E_TableVrfqBobOnSecretBuf(handle_t c_bob, buffer_t const* secret,
+                                      buffer_t* positions, alloc_t alloc,
+                                      void* ctx) {
+  return TableVrfqBobOnSecret(c_bob, CapiIn(secret),
+                              CapiOut(positions, alloc, ctx));
+}
+
+EXPORT bool E_TableVrfqBobFree(handle_t c_bob) {
   using namespace scheme::table::vrfq;
-  BobPtr bob = CapiObject<Bob>::Get(c_bob);
+  return CapiObject<Bob>::Del(c_bob);
+}
+}  // extern "C" vrfq
+
+// atomic_swap_vc
+namespace {
+bool TableAtomicSwapVcAliceOnRequest(handle_t c_alice,
+                                     CapiIn const& request_msg,
+                                     CapiOut const& response_msg) {
+  using namespace scheme::table;
+  using namespace scheme::atomic_swap_vc;
+  auto alice = CapiObject<Alice<AliceData>>::Get(c_alice);
+  if (!alice) return false;
+
+  try {
+    Request request;
+    CapiLoadJson(request_msg, request);
+
+    Response response;
+    if (!alice->OnRequest(request, response)) return false;
+
+    CapiSaveBin(response_msg, response);
+  } catch (std::exception&) {
+    return false;
+  }
+
+  return true;
+}
+
+bool TableAtomicSwapVcAliceOnReceipt(handle_t c_alice,
+                                     CapiIn const& receipt_msg,
+                                     CapiOut const& secret_msg) {
+  using namespace scheme::table;
+  using namespace scheme::atomic_swap_vc;
+  auto alice = CapiObject<Alice<AliceData>>::Get(c_alice);
+  if (!alice) return false;
+
+  try {
+    Receipt receipt;
+    CapiLoadJson(receipt_msg, receipt);
+
+    Secret secret;
+    if (!alice->OnReceipt(receipt, secret)) return false;
+
+    CapiSaveJson(secret_msg, secret);
+  } catch (std::exception&) {
+    return false;
+  }
+
+  return true;
+}
+
+bool TableAtomicSwapVcBobGetRequest(handle_t c_bob,
+                                    CapiOut const& request_msg) {
+  using namespace scheme::table;
+  using namespace scheme::atomic_swap_vc;
+  auto bob = CapiObject<Bob<BobData>>::Get(c_bob);
   if (!bob) return false;
 
   try {
     Request request;
     bob->GetRequest(request);
-    yas::file_ostream os(request_file);
-    yas::json_oarchive<yas::file_ostream> oa(os);
-    oa.serialize(request);
+    CapiSaveJson(request_msg, request);
   } catch (std::exception&) {
     return false;
   }
@@ -1391,25 +2136,21 @@ EXPORT bool E_TableVrfqBobGetRequest(handle_t c_bob, char const* request_file) {
   return true;
 }
 
-EXPORT bool E_TableVrfqBobOnResponse(handle_t c_bob, char const* response_file,
-                                     char const* receipt_file) {
+bool TableAtomicSwapVcBobOnResponse(handle_t c_bob, CapiIn const& response_msg,
+                                    CapiOut const& receipt_msg) {
   using namespace scheme::table;
-  using namespace scheme::table::vrfq;
-  BobPtr bob = CapiObject<Bob>::Get(c_bob);
+  using namespace scheme::atomic_swap_vc;
+  auto bob = CapiObject<Bob<BobData>>::Get(c_bob);
   if (!bob) return false;
 
   try {
     Response response;
-    yas::file_istream is(response_file);
-    yas::binary_iarchive<yas::file_istream, YasBinF()> ia(is);
-    ia.serialize(response);
+    CapiLoadBin(response_msg, response);
 
     Receipt receipt;
-    if (!bob->OnResponse(response, receipt)) return false;
+    if (!bob->OnResponse(std::move(response), receipt)) return false;
 
-    yas::file_ostream os(receipt_file);
-    yas::json_oarchive<yas::file_ostream> oa(os);
-    oa.serialize(receipt);
+    CapiSaveJson(receipt_msg, receipt);
   } catch (std::exception&) {
     return false;
   }
@@ -1417,43 +2158,24 @@ EXPORT bool E_TableVrfqBobOnResponse(handle_t c_bob, char const* response_file,
   return true;
 }
 
-EXPORT bool E_TableVrfqBobOnSecret(handle_t c_bob, char const* secret_file,
-                                   char const* positions_file) {
+bool TableAtomicSwapVcBobOnSecret(handle_t c_bob, CapiIn const& secret_msg) {
   using namespace scheme::table;
-  using namespace scheme::table::vrfq;
-  BobPtr bob = CapiObject<Bob>::Get(c_bob);
+  using namespace scheme::atomic_swap_vc;
+  auto bob = CapiObject<Bob<BobData>>::Get(c_bob);
   if (!bob) return false;
 
   try {
     Secret secret;
-    yas::file_istream is(secret_file);
-    yas::json_iarchive<yas::file_istream> ia(is);
-    ia.serialize(secret);
-
-    std::vector<std::vector<uint64_t>> positions;
-    if (!bob->OnSecret(secret, positions)) {
-      assert(false);
-      return false;
-    }
-
-    yas::file_ostream os(positions_file);
-    yas::json_oarchive<yas::file_ostream> oa(os);
-    oa.serialize(positions);
-    return true;
+    CapiLoadJson(secret_msg, secret);
+    return bob->OnSecret(secret);
   } catch (std::exception&) {
     return false;
   }
 
   return true;
 }
+}  // namespace
 
-EXPORT bool E_TableVrfqBobFree(handle_t c_bob) {
-  using namespace scheme::table::vrfq;
-  return CapiObject<Bob>::Del(c_bob);
-}
-}  // extern "C" vrfq
-
-// atomic_swap_vc
 extern "C" {
 EXPORT handle_t E_TableAtomicSwapVcAliceNew(handle_t c_alice_data,
                                             uint8_t const* c_self_id,
@@ -1480,55 +2202,54 @@ EXPORT handle_t E_TableAtomicSwapVcAliceNew(handle_t c_alice_data,
 EXPORT bool E_TableAtomicSwapVcAliceOnRequest(handle_t c_alice,
                                               char const* request_file,
                                               char const* response_file) {
-  using namespace scheme::table;
-  using namespace scheme::atomic_swap_vc;
-  auto alice = CapiObject<Alice<AliceData>>::Get(c_alice);
-  if (!alice) return false;
-
-  try {
-    Request request;
-    yas::file_istream is(request_file);
-    yas::json_iarchive<yas::file_istream> ia(is);
-    ia.serialize(request);
+  return TableAtomicSwapVcAliceOnRequest(c_alice, CapiIn(request_file),
+                                         CapiOut(response_file));
+}
 
-    Response response;
-    if (!alice->OnRequest(request, response)) return false;
+EXPORT bool E_TableAtomicSwapVcAliceOnRequestBuf(handle_t c_alice,
+                                                 buffer_t const* request,
+                                                 buffer_t* response,
+                                                 alloc_t alloc, void* ctx) {
+  return TableAtomicSwapVcAliceOnRequest(c_alice, CapiIn(request),
+                                         CapiOut(response, alloc, ctx));
+}
 
-    yas::file_ostream os(response_file);
-    yas::binary_oarchive<yas::file_ostream, YasBinF()> oa(os);
-    oa.serialize(response);
-  } catch (std::exception&) {
-    return false;
-  }
+EXPORT bool E_TableAtomicSwapVcAliceOnRequestAsync(handle_t c_alice,
+                                                   char const* request_file,
+                                                   char const* response_file,
+                                                   handle_t c_task) {
+  std::string request(request_file);
+  std::string response(response_file);
+  return CapiAsync(c_task, [=]() {
+    return TableAtomicSwapVcAliceOnRequest(c_alice, CapiIn(request.c_str()),
+                                           CapiOut(response.c_str()));
+  });
+}
 
-  return true;
+EXPORT bool E_TableAtomicSwapVcAliceOnRequestBufAsync(handle_t c_alice,
+                                                      buffer_t const* request,
+                                                      buffer_t* response,
+                                                      alloc_t alloc, void* ctx,
+                                                      handle_t c_task) {
+  return CapiAsync(c_task, [=]() {
+    return TableAtomicSwapVcAliceOnRequest(c_alice, CapiIn(request),
+                                           CapiOut(response, alloc, ctx));
+  });
 }
 
 EXPORT bool E_TableAtomicSwapVcAliceOnReceipt(handle_t c_alice,
                                               char const* receipt_file,
                                               char const* secret_file) {
-  using namespace scheme::table;
-  using namespace scheme::atomic_swap_vc;
-  auto alice = CapiObject<Alice<AliceData>>::Get(c_alice);
-  if (!alice) return false;
-
-  try {
-    Receipt receipt;
-    yas::file_istream is(receipt_file);
-    yas::json_iarchive<yas::file_istream> ia(is);
-    ia.serialize(receipt);
-
-    Secret secret;
-    if (!alice->OnReceipt(receipt, secret)) return false;
-
-    yas::file_ostream os(secret_file);
-    yas::json_oarchive<yas::file_ostream> oa(os);
-    oa.serialize(secret);
-  } catch (std::exception&) {
-    return false;
-  }
+  return TableAtomicSwapVcAliceOnReceipt(c_alice, CapiIn(receipt_file),
+                                         CapiOut(secret_file));
+}
 
-  return true;
+EXPORT bool E_TableAtomicSwapVcAliceOnReceiptBuf(handle_t c_alice,
+                                                 buffer_t const* receipt,
+                                                 buffer_t* secret,
+                                                 alloc_t alloc, void* ctx) {
+  return TableAtomicSwapVcAliceOnReceipt(c_alice, CapiIn(receipt),
+                                         CapiOut(secret, alloc, ctx));
 }
 
 EXPORT bool E_TableAtomicSwapVcAliceSetEvil(handle_t c_alice) {
@@ -1576,71 +2297,73 @@ EXPORT handle_t E_TableAtomicSwapVcBobNew(handle_t c_bob_data,
   }
 }
 
-EXPORT bool E_TableAtomicSwapVcBobGetRequest(handle_t c_bob,
-                                             char const* request_file) {
+EXPORT bool E_TableAtomicSwapVcBobSetG1Uncompressed(handle_t c_bob,
+                                                    bool uncompressed) {
   using namespace scheme::table;
   using namespace scheme::atomic_swap_vc;
   auto bob = CapiObject<Bob<BobData>>::Get(c_bob);
   if (!bob) return false;
+  bob->SetG1Uncompressed(uncompressed);
+  return true;
+}
 
-  try {
-    Request request;
-    bob->GetRequest(request);
-    yas::file_ostream os(request_file);
-    yas::json_oarchive<yas::file_ostream> oa(os);
-    oa.serialize(request);
-  } catch (std::exception&) {
-    return false;
-  }
+EXPORT bool E_TableAtomicSwapVcBobGetRequest(handle_t c_bob,
+                                             char const* request_file) {
+  return TableAtomicSwapVcBobGetRequest(c_bob, CapiOut(request_file));
+}
 
-  return true;
+EXPORT bool E_TableAtomicSwapVcBobGetRequestBuf(handle_t c_bob,
+                                                buffer_t* request,
+                                                alloc_t alloc, void* ctx) {
+  return TableAtomicSwapVcBobGetRequest(c_bob, CapiOut(request, alloc, ctx));
 }
 
 EXPORT bool E_TableAtomicSwapVcBobOnResponse(handle_t c_bob,
                                              char const* response_file,
                                              char const* receipt_file) {
-  using namespace scheme::table;
-  using namespace scheme::atomic_swap_vc;
-  auto bob = CapiObject<Bob<BobData>>::Get(c_bob);
-  if (!bob) return false;
-
-  try {
-    Response response;
-    yas::file_istream is(response_file);
-    yas::binary_iarchive<yas::file_istream, YasBinF()> ia(is);
-    ia.serialize(response);
+  return TableAtomicSwapVcBobOnResponse(c_bob, CapiIn(response_file),
+                                        CapiOut(receipt_file));
+}
 
-    Receipt receipt;
-    if (!bob->OnResponse(std::move(response), receipt)) return false;
+EXPORT bool E_TableAtomicSwapVcBobOnResponseBuf(handle_t c_bob,
+                                                buffer_t const* response,
+                                                buffer_t* receipt,
+                                                alloc_t alloc, void* ctx) {
+  return TableAtomicSwapVcBobOnResponse(c_bob, CapiIn(response),
+                                        CapiOut(receipt, alloc, ctx));
+}
 
-    yas::file_ostream os(receipt_file);
-    yas::json_oarchive<yas::file_ostream> oa(os);
-    oa.serialize(receipt);
-  } catch (std::exception&) {
-    return false;
-  }
+EXPORT bool E_TableAtomicSwapVcBobOnResponseAsync(handle_t c_bob,
+                                                  char const* response_file,
+                                                  char const* receipt_file,
+                                                  handle_t c_task) {
+  std::string response(response_file);
+  std::string receipt(receipt_file);
+  return CapiAsync(c_task, [=]() {
+    return TableAtomicSwapVcBobOnResponse(c_bob, CapiIn(response.c_str()),
+                                          CapiOut(receipt.c_str()));
+  });
+}
 
-  return true;
+EXPORT bool E_TableAtomicSwapVcBobOnResponseBufAsync(handle_t c_bob,
+                                                     buffer_t const* response,
+                                                     buffer_t* receipt,
+                                                     alloc_t alloc, void* ctx,
+                                                     handle_t c_task) {
+  return CapiAsync(c_task, [=]() {
+    return TableAtomicSwapVcBobOnResponse(c_bob, CapiIn(response),
+                                          CapiOut(receipt, alloc, ctx));
+  });
 }
 
 EXPORT bool E_TableAtomicSwapVcBobOnSecret(handle_t c_bob,
                                            char const* secret_file) {
-  using namespace scheme::table;
-  using namespace scheme::atomic_swap_vc;
-  auto bob = CapiObject<Bob<BobData>>::Get(c_bob);
-  if (!bob) return false;
-
-  try {
-    Secret secret;
-    yas::file_istream is(secret_file);
-    yas::json_iarchive<yas::file_istream> ia(is);
-    ia.serialize(secret);
-    return bob->OnSecret(secret);
-  } catch (std::exception&) {
-    return false;
-  }
+  return TableAtomicSwapVcBobOnSecret(c_bob, CapiIn(secret_file));
+}
 
-  return true;
+EXPORT bool E_TableAtomicSwapVcBobOnSecretBuf(handle_t c_bob,
+                                              buffer_t const* secret) {
+  return TableAtomicSwapVcBobOnSecret(c_bob, CapiIn(secret));
 }
 
 EXPORT bool E_TableAtomicSwapVcBobSaveDecrypted(handle_t c_bob,
@@ -43,10 +43,31 @@ extern "C"
                                                char const *request_file,
                                                char const *response_file);
 
+    EXPORT bool E_TableComplaintAliceOnRequestBuf(handle_t c_alice,
+                                                  buffer_t const *request,
+                                                  buffer_t *response,
+                                                  alloc_t alloc, void *ctx);
+
+    EXPORT bool E_TableComplaintAliceOnRequestAsync(handle_t c_alice,
+                                                    char const *request_file,
+                                                    char const *response_file,
+                                                    handle_t c_task);
+
+    EXPORT bool E_TableComplaintAliceOnRequestBufAsync(handle_t c_alice,
+                                                       buffer_t const *request,
+                                                       buffer_t *response,
+                                                       alloc_t alloc, void *ctx,
+                                                       handle_t c_task);
+
     EXPORT bool E_TableComplaintAliceOnReceipt(handle_t c_alice,
                                                char const *receipt_file,
                                                char const *secret_file);
 
+    EXPORT bool E_TableComplaintAliceOnReceiptBuf(handle_t c_alice,
+                                                  buffer_t const *receipt,
+                                                  buffer_t *secret,
+                                                  alloc_t alloc, void *ctx);
+
     EXPORT bool E_TableComplaintAliceSetEvil(handle_t c_alice);
 
     EXPORT bool E_TableComplaintAliceFree(handle_t c_alice);
@@ -57,19 +78,50 @@ extern "C"
                                            range_t const *c_demand,
                                            uint64_t c_demand_count);
 
+    // ask alice to send k uncompressed, call before GetRequest
+    EXPORT bool E_TableComplaintBobSetG1Uncompressed(handle_t c_bob,
+                                                     bool uncompressed);
+
     EXPORT bool E_TableComplaintBobGetRequest(handle_t c_bob,
                                               char const *request_file);
 
+    EXPORT bool E_TableComplaintBobGetRequestBuf(handle_t c_bob,
+                                                 buffer_t *request,
+                                                 alloc_t alloc, void *ctx);
+
     EXPORT bool E_TableComplaintBobOnResponse(handle_t c_bob,
                                               char const *response_file,
                                               char const *receipt_file);
 
+    EXPORT bool E_TableComplaintBobOnResponseBuf(handle_t c_bob,
+                                                 buffer_t const *response,
+                                                 buffer_t *receipt,
+                                                 alloc_t alloc, void *ctx);
+
+    EXPORT bool E_TableComplaintBobOnResponseAsync(handle_t c_bob,
+                                                   char const *response_file,
+                                                   char const *receipt_file,
+                                                   handle_t c_task);
+
+    EXPORT bool E_TableComplaintBobOnResponseBufAsync(handle_t c_bob,
+                                                      buffer_t const *response,
+                                                      buffer_t *receipt,
+                                                      alloc_t alloc, void *ctx,
+                                                      handle_t c_task);
+
     EXPORT bool E_TableComplaintBobOnSecret(handle_t c_bob,
                                             char const *secret_file);
 
+    EXPORT bool E_TableComplaintBobOnSecretBuf(handle_t c_bob,
+                                               buffer_t const *secret);
+
     EXPORT bool E_TableComplaintBobGenerateClaim(handle_t c_bob,
                                                  char const *claim_file);
 
+    EXPORT bool E_TableComplaintBobGenerateClaimBuf(handle_t c_bob,
+                                                    buffer_t *claim,
+                                                    alloc_t alloc, void *ctx);
+
     EXPORT bool E_TableComplaintBobSaveDecrypted(handle_t c_bob, char const *file);
 
     EXPORT bool E_TableComplaintBobFree(handle_t c_bob);
@@ -90,10 +142,32 @@ extern "C"
                                                 char const *request_file,
                                                 char const *response_file);
 
+    EXPORT bool E_TableAtomicSwapAliceOnRequestBuf(handle_t c_alice,
+                                                   buffer_t const *request,
+                                                   buffer_t *response,
+                                                   alloc_t alloc, void *ctx);
+
+    EXPORT bool E_TableAtomicSwapAliceOnRequestAsync(handle_t c_alice,
+                                                     char const *request_file,
+                                                     char const *response_file,
+                                                     handle_t c_task);
+
+    EXPORT bool E_TableAtomicSwapAliceOnRequestBufAsync(handle_t c_alice,
+                                                        buffer_t const *request,
+                                                        buffer_t *response,
+                                                        alloc_t alloc,
+                                                        void *ctx,
+                                                        handle_t c_task);
+
     EXPORT bool E_TableAtomicSwapAliceOnReceipt(handle_t c_alice,
                                                 char const *receipt_file,
                                                 char const *secret_file);
 
+    EXPORT bool E_TableAtomicSwapAliceOnReceiptBuf(handle_t c_alice,
+                                                   buffer_t const *receipt,
+                                                   buffer_t *secret,
+                                                   alloc_t alloc, void *ctx);
+
     EXPORT bool E_TableAtomicSwapAliceSetEvil(handle_t c_alice);
 
     EXPORT bool E_TableAtomicSwapAliceFree(handle_t c_alice);
@@ -104,16 +178,43 @@ extern "C"
                                             range_t const *c_demand,
                                             uint64_t c_demand_count);
 
+    // ask alice to send k uncompressed, call before GetRequest
+    EXPORT bool E_TableAtomicSwapBobSetG1Uncompressed(handle_t c_bob,
+                                                      bool uncompressed);
+
     EXPORT bool E_TableAtomicSwapBobGetRequest(handle_t c_bob,
                                                char const *request_file);
 
+    EXPORT bool E_TableAtomicSwapBobGetRequestBuf(handle_t c_bob,
+                                                  buffer_t *request,
+                                                  alloc_t alloc, void *ctx);
+
     EXPORT bool E_TableAtomicSwapBobOnResponse(handle_t c_bob,
                                                char const *response_file,
                                                char const *receipt_file);
 
+    EXPORT bool E_TableAtomicSwapBobOnResponseBuf(handle_t c_bob,
+                                                  buffer_t const *response,
+                                                  buffer_t *receipt,
+                                                  alloc_t alloc, void *ctx);
+
+    EXPORT bool E_TableAtomicSwapBobOnResponseAsync(handle_t c_bob,
+                                                    char const *response_file,
+                                                    char const *receipt_file,
+                                                    handle_t c_task);
+
+    EXPORT bool E_TableAtomicSwapBobOnResponseBufAsync(handle_t c_bob,
+                                                       buffer_t const *response,
+                                                       buffer_t *receipt,
+                                                       alloc_t alloc, void *ctx,
+                                                       handle_t c_task);
+
     EXPORT bool E_TableAtomicSwapBobOnSecret(handle_t c_bob,
                                              char const *secret_file);
 
+    EXPORT bool E_TableAtomicSwapBobOnSecretBuf(handle_t c_bob,
+                                                buffer_t const *secret);
+
     EXPORT bool E_TableAtomicSwapBobSaveDecrypted(handle_t c_bob, char const *file);
 
     EXPORT bool E_TableAtomicSwapBobFree(handle_t c_bob);
@@ -134,31 +235,77 @@ extern "C"
     EXPORT bool E_TableOtComplaintAliceGetNegoRequest(handle_t c_alice,
                                                       char const *request_file);
 
+    EXPORT bool E_TableOtComplaintAliceGetNegoRequestBuf(handle_t c_alice,
+                                                         buffer_t *request,
+                                                         alloc_t alloc,
+                                                         void *ctx);
+
     EXPORT bool E_TableOtComplaintAliceOnNegoRequest(handle_t c_alice,
                                                      char const *request_file,
                                                      char const *response_file);
 
+    EXPORT bool E_TableOtComplaintAliceOnNegoRequestBuf(handle_t c_alice,
+                                                        buffer_t const *request,
+                                                        buffer_t *response,
+                                                        alloc_t alloc,
+                                                        void *ctx);
+
     EXPORT bool E_TableOtComplaintAliceOnNegoResponse(handle_t c_alice,
                                                       char const *response_file);
 
+    EXPORT bool E_TableOtComplaintAliceOnNegoResponseBuf(
+        handle_t c_alice, buffer_t const *response);
+
     EXPORT bool E_TableOtComplaintBobGetNegoRequest(handle_t c_bob,
                                                     char const *request_file);
 
+    EXPORT bool E_TableOtComplaintBobGetNegoRequestBuf(handle_t c_bob,
+                                                       buffer_t *request,
+                                                       alloc_t alloc,
+                                                       void *ctx);
+
     EXPORT bool E_TableOtComplaintBobOnNegoRequest(handle_t c_bob,
                                                    char const *request_file,
                                                    char const *response_file);
 
+    EXPORT bool E_TableOtComplaintBobOnNegoRequestBuf(handle_t c_bob,
+                                                      buffer_t const *request,
+                                                      buffer_t *response,
+                                                      alloc_t alloc, void *ctx);
+
     EXPORT bool E_TableOtComplaintBobOnNegoResponse(handle_t c_bob,
                                                     char const *response_file);
 
+    EXPORT bool E_TableOtComplaintBobOnNegoResponseBuf(
+        handle_t c_bob, buffer_t const *response);
+
     EXPORT bool E_TableOtComplaintAliceOnRequest(handle_t c_alice,
                                                  char const *request_file,
                                                  char const *response_file);
 
+    EXPORT bool E_TableOtComplaintAliceOnRequestBuf(handle_t c_alice,
+                                                    buffer_t const *request,
+                                                    buffer_t *response,
+                                                    alloc_t alloc, void *ctx);
+
+    EXPORT bool E_TableOtComplaintAliceOnRequestAsync(handle_t c_alice,
+                                                      char const *request_file,
+                                                      char const *response_file,
+                                                      handle_t c_task);
+
+    EXPORT bool E_TableOtComplaintAliceOnRequestBufAsync(
+        handle_t c_alice, buffer_t const *request, buffer_t *response,
+        alloc_t alloc, void *ctx, handle_t c_task);
+
     EXPORT bool E_TableOtComplaintAliceOnReceipt(handle_t c_alice,
                                                  char const *receipt_file,
                                                  char const *secret_file);
 
+    EXPORT bool E_TableOtComplaintAliceOnReceiptBuf(handle_t c_alice,
+                                                    buffer_t const *receipt,
+                                                    buffer_t *secret,
+                                                    alloc_t alloc, void *ctx);
+
     EXPORT bool E_TableOtComplaintAliceSetEvil(handle_t c_alice);
 
     EXPORT bool E_TableOtComplaintAliceFree(handle_t c_alice);
@@ -168,19 +315,48 @@ extern "C"
         range_t const *c_demand, uint64_t c_demand_count, range_t const *c_phantom,
         uint64_t c_phantom_count);
 
+    // ask alice to send k uncompressed, call before GetRequest
+    EXPORT bool E_TableOtComplaintBobSetG1Uncompressed(handle_t c_bob,
+                                                       bool uncompressed);
+
     EXPORT bool E_TableOtComplaintBobGetRequest(handle_t c_bob,
                                                 char const *request_file);
 
+    EXPORT bool E_TableOtComplaintBobGetRequestBuf(handle_t c_bob,
+                                                   buffer_t *request,
+                                                   alloc_t alloc, void *ctx);
+
     EXPORT bool E_TableOtComplaintBobOnResponse(handle_t c_bob,
                                                 char const *response_file,
                                                 char const *receipt_file);
 
+    EXPORT bool E_TableOtComplaintBobOnResponseBuf(handle_t c_bob,
+                                                   buffer_t const *response,
+                                                   buffer_t *receipt,
+                                                   alloc_t alloc, void *ctx);
+
+    EXPORT bool E_TableOtComplaintBobOnResponseAsync(handle_t c_bob,
+                                                     char const *response_file,
+                                                     char const *receipt_file,
+                                                     handle_t c_task);
+
+    EXPORT bool E_TableOtComplaintBobOnResponseBufAsync(
+        handle_t c_bob, buffer_t const *response, buffer_t *receipt,
+        alloc_t alloc, void *ctx, handle_t c_task);
+
     EXPORT bool E_TableOtComplaintBobOnSecret(handle_t c_bob,
                                               char const *secret_file);
 
+    EXPORT bool E_TableOtComplaintBobOnSecretBuf(handle_t c_bob,
+                                                 buffer_t const *secret);
+
     EXPORT bool E_TableOtComplaintBobGenerateClaim(handle_t c_bob,
                                                    char const *claim_file);
 
+    EXPORT bool E_TableOtComplaintBobGenerateClaimBuf(handle_t c_bob,
+                                                      buffer_t *claim,
+                                                      alloc_t alloc, void *ctx);
+
     EXPORT bool E_TableOtComplaintBobSaveDecrypted(handle_t c_bob,
                                                    char const *file);
 
@@ -202,21 +378,54 @@ extern "C"
     EXPORT bool E_TableOtVrfqAliceGetNegoRequest(handle_t c_alice,
                                                  char const *request_file);
 
+    EXPORT bool E_TableOtVrfqAliceGetNegoRequestBuf(handle_t c_alice,
+                                                    buffer_t *request,
+                                                    alloc_t alloc, void *ctx);
+
     EXPORT bool E_TableOtVrfqAliceOnNegoRequest(handle_t c_alice,
                                                 char const *request_file,
                                                 char const *response_file);
 
+    EXPORT bool E_TableOtVrfqAliceOnNegoRequestBuf(handle_t c_alice,
+                                                   buffer_t const *request,
+                                                   buffer_t *response,
+                                                   alloc_t alloc, void *ctx);
+
     EXPORT bool E_TableOtVrfqAliceOnNegoResponse(handle_t c_alice,
                                                  char const *response_file);
 
+    EXPORT bool E_TableOtVrfqAliceOnNegoResponseBuf(handle_t c_alice,
+                                                    buffer_t const *response);
+
     EXPORT bool E_TableOtVrfqAliceOnRequest(handle_t c_alice,
                                             char const *request_file,
                                             char const *response_file);
 
+    EXPORT bool E_TableOtVrfqAliceOnRequestBuf(handle_t c_alice,
+                                               buffer_t const *request,
+                                               buffer_t *response,
+                                               alloc_t alloc, void *ctx);
+
+    EXPORT bool E_TableOtVrfqAliceOnRequestAsync(handle_t c_alice,
+                                                 char const *request_file,
+                                                 char const *response_file,
+                                                 handle_t c_task);
+
+    EXPORT bool E_TableOtVrfqAliceOnRequestBufAsync(handle_t c_alice,
+                                                    buffer_t const *request,
+                                                    buffer_t *response,
+                                                    alloc_t alloc, void *ctx,
+                                                    handle_t c_task);
+
     EXPORT bool E_TableOtVrfqAliceOnReceipt(handle_t c_alice,
                                             char const *receipt_file,
                                             char const *secret_file);
 
+    EXPORT bool E_TableOtVrfqAliceOnReceiptBuf(handle_t c_alice,
+                                               buffer_t const *receipt,
+                                               buffer_t *secret, alloc_t alloc,
+                                               void *ctx);
+
     EXPORT bool E_TableOtVrfqAliceFree(handle_t c_alice);
 
     EXPORT handle_t
@@ -228,23 +437,59 @@ extern "C"
     EXPORT bool E_TableOtVrfqBobGetNegoRequest(handle_t c_bob,
                                                char const *request_file);
 
+    EXPORT bool E_TableOtVrfqBobGetNegoRequestBuf(handle_t c_bob,
+                                                  buffer_t *request,
+                                                  alloc_t alloc, void *ctx);
+
     EXPORT bool E_TableOtVrfqBobOnNegoRequest(handle_t c_bob,
                                               char const *request_file,
                                               char const *response_file);
 
+    EXPORT bool E_TableOtVrfqBobOnNegoRequestBuf(handle_t c_bob,
+                                                 buffer_t const *request,
+                                                 buffer_t *response,
+                                                 alloc_t alloc, void *ctx);
+
     EXPORT bool E_TableOtVrfqBobOnNegoResponse(handle_t c_bob,
                                                char const *response_file);
 
+    EXPORT bool E_TableOtVrfqBobOnNegoResponseBuf(handle_t c_bob,
+                                                  buffer_t const *response);
+
     EXPORT bool E_TableOtVrfqBobGetRequest(handle_t c_bob,
                                            char const *request_file);
 
+    EXPORT bool E_TableOtVrfqBobGetRequestBuf(handle_t c_bob, buffer_t *request,
+                                              alloc_t alloc, void *ctx);
+
     EXPORT bool E_TableOtVrfqBobOnResponse(handle_t c_bob,
                                            char const *response_file,
                                            char const *receipt_file);
 
+    EXPORT bool E_TableOtVrfqBobOnResponseBuf(handle_t c_bob,
+                                              buffer_t const *response,
+                                              buffer_t *receipt, alloc_t alloc,
+                                              void *ctx);
+
+    EXPORT bool E_TableOtVrfqBobOnResponseAsync(handle_t c_bob,
+                                                char const *response_file,
+                                                char const *receipt_file,
+                                                handle_t c_task);
+
+    EXPORT bool E_TableOtVrfqBobOnResponseBufAsync(handle_t c_bob,
+                                                   buffer_t const *response,
+                                                   buffer_t *receipt,
+                                                   alloc_t alloc, void *ctx,
+                                                   handle_t c_task);
+
     EXPORT bool E_TableOtVrfqBobOnSecret(handle_t c_bob, char const *secret_file,
                                          char const *positions_file);
 
+    EXPORT bool E_TableOtVrfqBobOnSecretBuf(handle_t c_bob,
+                                            buffer_t const *secret,
+                                            buffer_t *positions, alloc_t alloc,
+                                            void *ctx);
+
     EXPORT bool E_TableOtVrfqBobFree(handle_t c_bob);
 #ifdef __cplusplus
 } // extern "C" ot_vrfq
@@ -264,10 +509,31 @@ extern "C"
                                           char const *request_file,
                                           char const *response_file);
 
+    EXPORT bool E_TableVrfqAliceOnRequestBuf(handle_t c_alice,
+                                             buffer_t const *request,
+                                             buffer_t *response, alloc_t alloc,
+                                             void *ctx);
+
+    EXPORT bool E_TableVrfqAliceOnRequestAsync(handle_t c_alice,
+                                               char const *request_file,
+                                               char const *response_file,
+                                               handle_t c_task);
+
+    EXPORT bool E_TableVrfqAliceOnRequestBufAsync(handle_t c_alice,
+                                                  buffer_t const *request,
+                                                  buffer_t *response,
+                                                  alloc_t alloc, void *ctx,
+                                                  handle_t c_task);
+
     EXPORT bool E_TableVrfqAliceOnReceipt(handle_t c_alice,
                                           char const *receipt_file,
                                           char const *secret_file);
 
+    EXPORT bool E_TableVrfqAliceOnReceiptBuf(handle_t c_alice,
+                                             buffer_t const *receipt,
+                                             buffer_t *secret, alloc_t alloc,
+                                             void *ctx);
+
     EXPORT bool E_TableVrfqAliceFree(handle_t c_alice);
 
     EXPORT handle_t E_TableVrfqBobNew(handle_t c_bob_data, uint8_t const *c_self_id,
@@ -278,12 +544,36 @@ extern "C"
 
     EXPORT bool E_TableVrfqBobGetRequest(handle_t c_bob, char const *request_file);
 
+    EXPORT bool E_TableVrfqBobGetRequestBuf(handle_t c_bob, buffer_t *request,
+                                            alloc_t alloc, void *ctx);
+
     EXPORT bool E_TableVrfqBobOnResponse(handle_t c_bob, char const *response_file,
                                          char const *receipt_file);
 
+    EXPORT bool E_TableVrfqBobOnResponseBuf(handle_t c_bob,
+                                            buffer_t const *response,
+                                            buffer_t *receipt, alloc_t alloc,
+                                            void *ctx);
+
+    EXPORT bool E_TableVrfqBobOnResponseAsync(handle_t c_bob,
+                                              char const *response_file,
+                                              char const *receipt_file,
+                                              handle_t c_task);
+
+    EXPORT bool E_TableVrfqBobOnResponseBufAsync(handle_t c_bob,
+                                                 buffer_t const *response,
+                                                 buffer_t *receipt,
+                                                 alloc_t alloc, void *ctx,
+                                                 handle_t c_task);
+
     EXPORT bool E_TableVrfqBobOnSecret(handle_t c_bob, char const *secret_file,
                                        char const *positions_file);
 
+    EXPORT bool E_TableVrfqBobOnSecretBuf(handle_t c_bob,
+                                          buffer_t const *secret,
+                                          buffer_t *positions, alloc_t alloc,
+                                          void *ctx);
+
     EXPORT bool E_TableVrfqBobFree(handle_t c_bob);
 
 #ifdef __cplusplus
@@ -303,10 +593,28 @@ extern "C"
                                                   char const *request_file,
                                                   char const *response_file);
 
+    EXPORT bool E_TableAtomicSwapVcAliceOnRequestBuf(handle_t c_alice,
+                                                     buffer_t const *request,
+                                                     buffer_t *response,
+                                                     alloc_t alloc, void *ctx);
+
+    EXPORT bool E_TableAtomicSwapVcAliceOnRequestAsync(
+        handle_t c_alice, char const *request_file, char const *response_file,
+        handle_t c_task);
+
+    EXPORT bool E_TableAtomicSwapVcAliceOnRequestBufAsync(
+        handle_t c_alice, buffer_t const *request, buffer_t *response,
+        alloc_t alloc, void *ctx, handle_t c_task);
+
     EXPORT bool E_TableAtomicSwapVcAliceOnReceipt(handle_t c_alice,
                                                   char const *receipt_file,
                                                   char const *secret_file);
 
+    EXPORT bool E_TableAtomicSwapVcAliceOnReceiptBuf(handle_t c_alice,
+                                                     buffer_t const *receipt,
+                                                     buffer_t *secret,
+                                                     alloc_t alloc, void *ctx);
+
     EXPORT bool E_TableAtomicSwapVcAliceSetEvil(handle_t c_alice);
 
     EXPORT bool E_TableAtomicSwapVcAliceFree(handle_t c_alice);
@@ -317,16 +625,41 @@ extern "C"
                                               range_t const *c_demand,
                                               uint64_t c_demand_count);
 
+    // ask alice to send k uncompressed, call before GetRequest
+    EXPORT bool E_TableAtomicSwapVcBobSetG1Uncompressed(handle_t c_bob,
+                                                        bool uncompressed);
+
     EXPORT bool E_TableAtomicSwapVcBobGetRequest(handle_t c_bob,
                                                  char const *request_file);
 
+    EXPORT bool E_TableAtomicSwapVcBobGetRequestBuf(handle_t c_bob,
+                                                    buffer_t *request,
+                                                    alloc_t alloc, void *ctx);
+
     EXPORT bool E_TableAtomicSwapVcBobOnResponse(handle_t c_bob,
                                                  char const *response_file,
                                                  char const *receipt_file);
 
+    EXPORT bool E_TableAtomicSwapVcBobOnResponseBuf(handle_t c_bob,
+                                                    buffer_t const *response,
+                                                    buffer_t *receipt,
+                                                    alloc_t alloc, void *ctx);
+
+    EXPORT bool E_TableAtomicSwapVcBobOnResponseAsync(handle_t c_bob,
+                                                      char const *response_file,
+                                                      char const *receipt_file,
+                                                      handle_t c_task);
+
+    EXPORT bool E_TableAtomicSwapVcBobOnResponseBufAsync(
+        handle_t c_bob, buffer_t const *response, buffer_t *receipt,
+        alloc_t alloc, void *ctx, handle_t c_task);
+
     EXPORT bool E_TableAtomicSwapVcBobOnSecret(handle_t c_bob,
                                                char const *secret_file);
 
+    EXPORT bool E_TableAtomicSwapVcBobOnSecretBuf(handle_t c_bob,
+                                                  buffer_t const *secret);
+
     EXPORT bool E_TableAtomicSwapVcBobSaveDecrypted(handle_t c_bob,
                                                     char const *file);
 
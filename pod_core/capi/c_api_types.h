@@ -28,6 +28,14 @@ extern "C"
   typedef struct buffer_t buffer_t;
 #endif
 
+  // returns len bytes owned by the caller, nullptr on failure
+  typedef uint8_t *(*alloc_t)(void *ctx, uint64_t len);
+
+  // fraction is in [0, 1]
+  typedef void (*progress_t)(void *ctx, char const *stage, double fraction);
+
+  typedef void (*done_t)(void *ctx, bool ret);
+
   struct plain_bulletin_t
   {
     uint64_t size;
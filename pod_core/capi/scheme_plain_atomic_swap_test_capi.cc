@@ -84,7 +84,7 @@ namespace scheme::plain::atomic_swap::capi {
 
 bool Test(std::string const& output_path, WrapperAliceData const& a,
           WrapperBobData const& b, std::vector<Range> const& demands,
-          bool evil) {
+          bool evil, bool g1_uncompressed) {
   Tick _tick_(__FUNCTION__);
 
   WrapperAlice alice(a.h(), kDummyAliceId.data(), kDummyBobId.data());
@@ -96,6 +96,7 @@ bool Test(std::string const& output_path, WrapperAliceData const& a,
   WrapperBob bob(b.h(), kDummyBobId.data(), kDummyAliceId.data(),
                  c_demand.data(), c_demand.size());
   if (evil) E_PlainAtomicSwapAliceSetEvil(alice.h());
+  if (g1_uncompressed) E_PlainAtomicSwapBobSetG1Uncompressed(bob.h());
 
   std::string request_file = output_path + "/request";
   std::string response_file = output_path + "/response";
@@ -147,13 +148,15 @@ bool Test(std::string const& output_path, WrapperAliceData const& a,
 }
 
 bool Test(std::string const& publish_path, std::string const& output_path,
-          std::vector<Range> const& demands, bool test_evil) {
+          std::vector<Range> const& demands, bool test_evil,
+          bool g1_uncompressed) {
   try {
     WrapperAliceData alice_data(publish_path.c_str());
     std::string bulletin_file = publish_path + "/bulletin";
     std::string public_path = publish_path + "/public";
     WrapperBobData bob_data(bulletin_file.c_str(), public_path.c_str());
-    return Test(output_path, alice_data, bob_data, demands, test_evil);
+    return Test(output_path, alice_data, bob_data, demands, test_evil,
+                g1_uncompressed);
   } catch (std::exception& e) {
     std::cerr << __FUNCTION__ << "\t" << e.what() << "\n";
     return false;
@@ -6,5 +6,5 @@
 namespace scheme::plain::ot_complaint::capi {
 bool Test(std::string const& publish_path, std::string const& output_path,
           std::vector<Range> const& demands, std::vector<Range> const& phantoms,
-          bool test_evil);
+          bool test_evil, bool g1_uncompressed);
 }  // namespace scheme::plain::ot_complaint::capi
\ No newline at end of file
@@ -5,5 +5,6 @@
 
 namespace scheme::table::atomic_swap_vc::capi {
 bool Test(std::string const& publish_path, std::string const& output_path,
-          std::vector<Range> const& demands, bool test_evil);
+          std::vector<Range> const& demands, bool test_evil,
+          bool g1_uncompressed);
 }  // namespace scheme::table::atomic_swap_vc::capi
\ No newline at end of file
@@ -85,7 +85,7 @@ namespace scheme::table::ot_complaint::capi {
 
 bool Test(std::string const& output_path, WrapperAliceData const& a,
           WrapperBobData const& b, std::vector<Range> const& demands,
-          std::vector<Range> const& phantoms, bool evil) {
+          std::vector<Range> const& phantoms, bool evil, bool g1_uncompressed) {
   Tick _tick_(__FUNCTION__);
 
   WrapperAlice alice(a.h(), kDummyAliceId.data(), kDummyBobId.data());
@@ -105,6 +105,7 @@ bool Test(std::string const& output_path, WrapperAliceData const& a,
                  c_phantom.size());
 
   if (evil) E_TableOtComplaintAliceSetEvil(alice.h());
+  if (g1_uncompressed) E_TableOtComplaintBobSetG1Uncompressed(bob.h());
 
   std::string negoa_request_file = output_path + "/negoa_request";
   std::string negob_request_file = output_path + "/negob_request";
@@ -246,14 +247,14 @@ bool Test(std::string const& output_path, WrapperAliceData const& a,
 
 bool Test(std::string const& publish_path, std::string const& output_path,
           std::vector<Range> const& demands, std::vector<Range> const& phantoms,
-          bool test_evil) {
+          bool test_evil, bool g1_uncompressed) {
   try {
     WrapperAliceData alice_data(publish_path.c_str());
     std::string bulletin_file = publish_path + "/bulletin";
     std::string public_path = publish_path + "/public";
     WrapperBobData bob_data(bulletin_file.c_str(), public_path.c_str());
     return Test(output_path, alice_data, bob_data, demands, phantoms,
-                test_evil);
+                test_evil, g1_uncompressed);
   } catch (std::exception& e) {
     std::cerr << __FUNCTION__ << "\t" << e.what() << "\n";
     return false;
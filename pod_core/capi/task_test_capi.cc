@@ -0,0 +1,193 @@
+#include "task_test_capi.h"
+
+#include <atomic>
+#include <cassert>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include "c_api.h"
+#include "c_api_async.h"
+#include "parallel.h"
+#include "task.h"
+
+namespace {
+// the progress reports of one task, progress is never called concurrently so
+// only inside is atomic
+struct ProgressLog {
+  std::atomic<bool> inside{false};
+  bool concurrent = false;
+  bool monotonic = true;
+  uint64_t count = 0;
+  double last = 0;
+  std::string last_stage;
+
+  void Report(char const* stage, double fraction) {
+    if (inside.exchange(true)) concurrent = true;
+    if (count && fraction < last) monotonic = false;
+    last = fraction;
+    last_stage = stage;
+    ++count;
+    inside = false;
+  }
+};
+
+struct AsyncState {
+  ProgressLog log;
+  std::mutex mutex;
+  std::condition_variable cv;
+  bool started = false;
+  bool finished = false;
+  bool ret = false;
+};
+
+void OnProgress(void* ctx, char const* stage, double fraction) {
+  auto state = static_cast<AsyncState*>(ctx);
+  state->log.Report(stage, fraction);
+  std::scoped_lock<std::mutex> lock(state->mutex);
+  state->started = true;
+  state->cv.notify_all();
+}
+
+void OnDone(void* ctx, bool ret) {
+  auto state = static_cast<AsyncState*>(ctx);
+  std::scoped_lock<std::mutex> lock(state->mutex);
+  state->finished = true;
+  state->ret = ret;
+  state->cv.notify_all();
+}
+
+// a slow parallel loop under the current task, false if it was cancelled
+bool SlowLoop() {
+  uint64_t const kCount = 1000;
+  TaskLoop loop("slow", 0.0, 0.9, kCount);
+  ParallelFor(0, kCount, [&loop](int64_t) {
+    if (!loop.Step()) return;
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  });
+  return !loop.cancelled();
+}
+
+// run SlowLoop by CapiAsync, cancel it after the first report if cancel
+bool RunAsync(bool cancel, AsyncState& state) {
+  handle_t task = E_TaskNew(OnProgress, OnDone, &state);
+  if (!task) return false;
+
+  if (!CapiAsync(task, SlowLoop)) {
+    E_TaskFree(task);
+    return false;
+  }
+
+  {
+    std::unique_lock<std::mutex> lock(state.mutex);
+    if (cancel) {
+      state.cv.wait(lock, [&state]() { return state.started; });
+      E_TaskCancel(task);
+    }
+    state.cv.wait(lock, [&state]() { return state.finished; });
+  }
+
+  if (!E_TaskFree(task)) return false;
+  // the freed handle is unknown now
+  return !CapiAsync(task, SlowLoop);
+}
+}  // namespace
+
+bool TestTaskLoop() {
+  uint64_t const kCount = 10000;
+
+  // runs to the end
+  {
+    ProgressLog log;
+    Task task;
+    task.progress = [&log](char const* stage, double fraction) {
+      log.Report(stage, fraction);
+    };
+    TaskScope scope(&task);
+    TaskLoop loop("loop", 0.2, 0.8, kCount);
+    std::atomic<uint64_t> done{0};
+    std::atomic<bool> same_task{true};
+    ParallelFor(0, kCount, [&](int64_t) {
+      if (CurrentTask() != &task) same_task = false;
+      if (!loop.Step()) return;
+      ++done;
+    });
+    if (loop.cancelled() || done != kCount || !same_task) {
+      assert(false);
+      return false;
+    }
+    if (log.concurrent || !log.monotonic || !log.count || log.last < 0.2 ||
+        log.last > 0.8) {
+      assert(false);
+      return false;
+    }
+  }
+
+  // cancelled after a quarter, the items in flight may still finish
+  {
+    Task task;
+    TaskScope scope(&task);
+    TaskLoop loop("loop", 0.0, 1.0, kCount);
+    std::atomic<uint64_t> done{0};
+    ParallelFor(0, kCount, [&](int64_t) {
+      if (!loop.Step()) return;
+      if (++done == kCount / 4) task.cancelled = true;
+    });
+    if (!loop.cancelled() || done >= kCount / 2) {
+      assert(false);
+      return false;
+    }
+    // the next stage gives up too
+    if (TaskProgress("next", 1.0)) {
+      assert(false);
+      return false;
+    }
+  }
+
+  // without a task nothing stops the loop
+  {
+    TaskScope scope(nullptr);
+    TaskLoop loop("loop", 0.0, 1.0, kCount);
+    std::atomic<uint64_t> done{0};
+    ParallelFor(0, kCount, [&](int64_t) {
+      if (loop.Step()) ++done;
+    });
+    if (loop.cancelled() || done != kCount) {
+      assert(false);
+      return false;
+    }
+  }
+  return true;
+}
+
+bool TestCapiAsync() {
+  {
+    AsyncState state;
+    if (!RunAsync(false, state)) {
+      assert(false);
+      return false;
+    }
+    auto const& log = state.log;
+    if (!state.ret || log.concurrent || !log.monotonic ||
+        log.last_stage != "done" || log.last != 1.0) {
+      assert(false);
+      return false;
+    }
+  }
+
+  {
+    AsyncState state;
+    if (!RunAsync(true, state)) {
+      assert(false);
+      return false;
+    }
+    auto const& log = state.log;
+    if (state.ret || log.concurrent || log.last_stage == "done") {
+      assert(false);
+      return false;
+    }
+  }
+  return true;
+}
@@ -0,0 +1,9 @@
+#pragma once
+
+// TaskLoop in a parallel loop: the task follows the loop into the pool jobs,
+// the progress is serialized and never goes back, a cancel stops the loop
+bool TestTaskLoop();
+
+// CapiAsync with a parallel loop: a cancel in the middle ends the call with
+// false and no "done" report, an uncancelled call ends at ("done", 1.0)
+bool TestCapiAsync();
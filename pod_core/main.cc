@@ -17,6 +17,8 @@
 #include "scheme_ot_complaint_test.h"
 #include "scheme_ot_vrfq_test.h"
 #include "scheme_vrfq_test.h"
+#include "trace.h"
+#include "unit_test.h"
 #include "zkp.h"
 #include "zkp_key.h"
 
@@ -97,6 +99,10 @@ int main(int argc, char **argv)
   bool use_capi = false;
   bool test_evil = false;
   bool dump_ecc_pub = false;
+  bool unit_test = false;
+  bool g1_uncompressed = false;
+  bool tick = false;
+  std::string trace_file;
 #ifdef MULTICORE
   uint32_t omp_thread_num = 0;
 #endif
@@ -133,11 +139,17 @@ int main(int argc, char **argv)
 #ifdef MULTICORE
         (
             "omp_thread_num", po::value<uint32_t>(&omp_thread_num),
-            "Provide the number of the openmp thread, 1: disable "
-            "openmp, 0: default.")
+            "Provide the number of the parallel threads, 1: disable "
+            "parallel, 0: default.")
 #endif
             ("use_c_api,c", "")("test_evil", "")(
-                "dump_ecc_pub", "");
+                "dump_ecc_pub", "")(
+                "g1_uncompressed",
+                "Bob asks alice to send k uncompressed on the binary wire")(
+                "tick", "Print every traced function to the console")(
+                "unit_test", "Run the self contained tests in output_dir")(
+                "trace", po::value<std::string>(&trace_file),
+                "Save the chrome trace json to the file and print a summary");
 
     boost::program_options::variables_map vmap;
 
@@ -165,6 +177,21 @@ int main(int argc, char **argv)
     {
       dump_ecc_pub = true;
     }
+
+    if (vmap.count("g1_uncompressed"))
+    {
+      g1_uncompressed = true;
+    }
+
+    if (vmap.count("tick"))
+    {
+      tick = true;
+    }
+
+    if (vmap.count("unit_test"))
+    {
+      unit_test = true;
+    }
   }
   catch (std::exception &e)
   {
@@ -179,8 +206,10 @@ int main(int argc, char **argv)
   {
     std::cout << "omp_set_num_threads: " << omp_thread_num << "\n";
     omp_set_num_threads(omp_thread_num);
+    SetParallelThreads(omp_thread_num);
   }
   std::cout << "omp_get_max_threads: " << omp_get_max_threads() << "\n";
+  std::cout << "parallel threads: " << ParallelThreads() << "\n";
 #endif
 
   if (!InitAll(data_dir))
@@ -189,6 +218,22 @@ int main(int argc, char **argv)
     return -1;
   }
 
+  trace::SetConsole(tick);
+  trace::Enable(!trace_file.empty());
+  // save the trace on every return below
+  struct TraceSaver
+  {
+    std::string file;
+    ~TraceSaver()
+    {
+      if (file.empty())
+        return;
+      if (!trace::SaveChromeTrace(file))
+        std::cerr << "Save trace " << file << " failed\n";
+      trace::DumpSummary(std::cout);
+    }
+  } trace_saver{trace_file};
+
   if (dump_ecc_pub)
   {
     DumpEccPub();
@@ -201,7 +246,7 @@ int main(int argc, char **argv)
     return -1;
   }
 
-  if (publish_dir.empty() || !fs::is_directory(publish_dir))
+  if (!unit_test && (publish_dir.empty() || !fs::is_directory(publish_dir)))
   {
     std::cerr << "Open publish_dir " << publish_dir << " failed\n";
     return -1;
@@ -220,6 +265,11 @@ int main(int argc, char **argv)
     fs::remove_all(entry);
   }
 
+  if (unit_test)
+  {
+    return UnitTest(output_dir) ? 0 : -1;
+  }
+
   if (mode == Mode::kPlain)
   {
     if (action == Action::kVrfQuery || action == Action::kOtVrfQuery ||
@@ -260,7 +310,10 @@ int main(int argc, char **argv)
       func = use_capi ? scheme::table::complaint::capi::Test
                       : scheme::table::complaint::Test;
     }
-    return func(publish_dir, output_dir, demand_ranges, test_evil) ? 0 : -1;
+    return func(publish_dir, output_dir, demand_ranges, test_evil,
+                g1_uncompressed)
+               ? 0
+               : -1;
   }
 
   if (action == Action::kOtComplaintPod)
@@ -277,7 +330,7 @@ int main(int argc, char **argv)
                       : scheme::table::ot_complaint::Test;
     }
     return func(publish_dir, output_dir, demand_ranges, phantom_ranges,
-                test_evil)
+                test_evil, g1_uncompressed)
                ? 0
                : -1;
   }
@@ -295,7 +348,10 @@ int main(int argc, char **argv)
       func = use_capi ? scheme::table::atomic_swap::capi::Test
                       : scheme::table::atomic_swap::Test;
     }
-    return func(publish_dir, output_dir, demand_ranges, test_evil) ? 0 : -1;
+    return func(publish_dir, output_dir, demand_ranges, test_evil,
+                g1_uncompressed)
+               ? 0
+               : -1;
   }
 
   if (action == Action::kAtomicSwapPodVc)
@@ -311,7 +367,10 @@ int main(int argc, char **argv)
       func = use_capi ? scheme::table::atomic_swap_vc::capi::Test
                       : scheme::table::atomic_swap_vc::Test;
     }
-    return func(publish_dir, output_dir, demand_ranges, test_evil) ? 0 : -1;
+    return func(publish_dir, output_dir, demand_ranges, test_evil,
+                g1_uncompressed)
+               ? 0
+               : -1;
   }
 
   std::cerr << "Not implement yet.\n";
@@ -0,0 +1,104 @@
+#include "mkl_tree_test.h"
+
+#include <cassert>
+#include <iostream>
+
+#include "mkl_tree.h"
+
+namespace {
+h256_t Item(uint64_t i) {
+  h256_t h;
+  h.fill(0);
+  for (int j = 0; j < 8; ++j) h[j] = (uint8_t)((i + 1) >> (j * 8));
+  return h;
+}
+
+std::vector<std::vector<Range>> RangeSets(uint64_t item_count) {
+  std::vector<std::vector<Range>> sets;
+  // every single item, the last one of an odd count included
+  for (uint64_t i = 0; i < item_count; ++i) sets.push_back({Range(i, 1)});
+  // all items
+  sets.push_back({Range(0, item_count)});
+  // scattered
+  std::vector<Range> scattered;
+  for (uint64_t i = 0; i < item_count; i += 2) scattered.push_back(Range(i, 1));
+  sets.push_back(scattered);
+  if (item_count >= 3) {
+    // adjacent, merged into one run by the path
+    sets.push_back({Range(0, 1), Range(1, item_count - 2)});
+    sets.push_back({Range(1, 1), Range(2, item_count - 2)});
+    // scattered with the last item
+    sets.push_back({Range(0, 1), Range(item_count - 1, 1)});
+  }
+  return sets;
+}
+
+bool CheckRangesPath(uint64_t item_count, std::vector<Range> const& ranges) {
+  using namespace mkl;
+  auto tree = BuildTree(item_count, Item);
+  auto const& root = tree.back();
+  if (root != CalcRoot(Item, item_count)) {
+    assert(false);
+    return false;
+  }
+
+  auto path = GetRangesPath(item_count, Item, tree, ranges);
+  if (!VerifyRangesPath(Item, ranges, item_count, root, path)) {
+    assert(false);
+    return false;
+  }
+
+  auto extra = path;
+  extra.push_back(h256_t());
+  if (VerifyRangesPath(Item, ranges, item_count, root, extra)) {
+    assert(false);
+    return false;
+  }
+
+  if (!path.empty()) {
+    auto truncated = path;
+    truncated.pop_back();
+    if (VerifyRangesPath(Item, ranges, item_count, root, truncated)) {
+      assert(false);
+      return false;
+    }
+
+    for (size_t i = 0; i < path.size(); ++i) {
+      auto flipped = path;
+      flipped[i][0] ^= 1;
+      if (VerifyRangesPath(Item, ranges, item_count, root, flipped)) {
+        assert(false);
+        return false;
+      }
+    }
+  }
+
+  // an item that does not match the root
+  auto bad_item = [&ranges](uint64_t i) {
+    auto h = Item(i);
+    if (i == ranges.back().start) h[31] ^= 1;
+    return h;
+  };
+  if (VerifyRangesPath(bad_item, ranges, item_count, root, path)) {
+    assert(false);
+    return false;
+  }
+  return true;
+}
+}  // namespace
+
+namespace mkl {
+bool TestRangesPath() {
+  for (uint64_t item_count : {1, 2, 3, 4, 5, 7, 8, 13}) {
+    for (auto const& ranges : RangeSets(item_count)) {
+      if (!CheckRangesPath(item_count, ranges)) {
+        std::cerr << "item_count " << item_count << ", ranges";
+        for (auto const& r : ranges) std::cerr << " " << Range::to_string(r);
+        std::cerr << "\n";
+        return false;
+      }
+    }
+  }
+  return true;
+}
+}  // namespace mkl
@@ -0,0 +1,7 @@
+#pragma once
+
+namespace mkl {
+// multi range paths of scattered, adjacent and single item ranges verify for
+// several item counts, truncated, extended or flipped paths are rejected
+bool TestRangesPath();
+}  // namespace mkl
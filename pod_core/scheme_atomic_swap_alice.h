@@ -5,6 +5,7 @@
 #include <vector>
 
 #include "ecc.h"
+#include "range_set.h"
 #include "scheme_atomic_swap_protocol.h"
 
 namespace scheme::atomic_swap {
@@ -22,9 +23,6 @@ class Alice {
  public:
   void TestSetEvil() { evil_ = true; }
 
- private:
-  void BuildMapping();
-
  private:
   std::shared_ptr<AliceData> a_;
   h256_t const self_id_;
@@ -38,11 +36,8 @@ class Alice {
   h256_t seed2_;
 
  private:
-  struct Mapping {
-    uint64_t global_index;
-  };
   uint64_t demands_count_ = 0;
-  std::vector<Mapping> mappings_;
+  RangeSet demand_set_;
 
  private:
   h256_t seed0_;
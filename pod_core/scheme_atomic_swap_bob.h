@@ -1,9 +1,12 @@
 #pragma once
 
+#include <atomic>
+
 #include "basic_types.h"
 #include "ecc.h"
 #include "omp_helper.h"
 #include "public.h"
+#include "range_set.h"
 #include "scheme_atomic_swap_notary.h"
 #include "scheme_atomic_swap_protocol.h"
 #include "scheme_misc.h"
@@ -16,6 +19,10 @@ class Bob {
   Bob(std::shared_ptr<BobData> b, h256_t const& self_id, h256_t const& peer_id,
       std::vector<Range> demands);
 
+ public:
+  // ask alice to send k uncompressed, default off
+  void SetG1Uncompressed(bool uncompressed) { g1_uncompressed_ = uncompressed; }
+
  public:
   void GetRequest(Request& request);
   bool OnResponse(Response response, Receipt& receipt);
@@ -23,8 +30,7 @@ class Bob {
   bool SaveDecrypted(std::string const& file);
 
  private:
-  void BuildMapping();
-  bool CheckEncryptedM();
+  bool CheckEncryptedM(TaskLoop* loop);
   bool CheckKVW();
   void DecryptM(std::vector<Fr> const& v);
 
@@ -37,16 +43,14 @@ class Bob {
   std::vector<Range> const demands_;
   uint64_t demands_count_ = 0;
   h256_t seed2_seed_;
+  bool g1_uncompressed_ = false;
 
  private:
   std::vector<G1> k_;   // sizeof() = (count + 1) * s
   std::vector<Fr> vw_;  // sizeof() = s
 
  private:
-  struct Mapping {
-    uint64_t global_index;
-  };
-  std::vector<Mapping> mappings_;
+  RangeSet demand_set_;
   Fr sigma_vw_;
 
  private:
@@ -8,12 +8,14 @@ namespace scheme::atomic_swap {
 struct Request {
   h256_t seed2_seed;
   std::vector<Range> demands;
+  bool g1_uncompressed = false;  // bob wants k uncompressed
 };
 
 struct Response {
   std::vector<G1> k;   // (n+1)*s
   std::vector<Fr> m;   // n*s
   std::vector<Fr> vw;  // s
+  bool g1_uncompressed = false;  // not serialized, the seq size marks it
 };
 
 struct Receipt {
@@ -8,18 +8,21 @@ namespace scheme::atomic_swap {
 // save to json
 template <typename Ar>
 void serialize(Ar &ar, Request const &t) {
-  ar &YAS_OBJECT_NVP("Request", ("s", t.seed2_seed), ("p", t.demands));
+  ar &YAS_OBJECT_NVP("Request", ("s", t.seed2_seed), ("p", t.demands),
+                     ("u", t.g1_uncompressed));
 }
 
 // load from json
 template <typename Ar>
 void serialize(Ar &ar, Request &t) {
-  ar &YAS_OBJECT_NVP("Request", ("s", t.seed2_seed), ("p", t.demands));
+  ar &YAS_OBJECT_NVP("Request", ("s", t.seed2_seed), ("p", t.demands),
+                     ("u", t.g1_uncompressed));
 }
 
 // save to bin
 template <typename Ar>
 void serialize(Ar &ar, Response const &t) {
+  G1WireScope wire(t.g1_uncompressed);
   ar &YAS_OBJECT_NVP("Response", ("k", t.k), ("m", t.m), ("vw", t.vw));
 }
 
@@ -22,7 +22,7 @@ namespace scheme::atomic_swap {
 template <typename AliceData, typename BobData>
 bool Test(std::string const& output_path, std::shared_ptr<AliceData> alice_data,
           std::shared_ptr<BobData> bob_data, std::vector<Range> const& demands,
-          bool evil) {
+          bool evil, bool g1_uncompressed) {
   Tick _tick_(__FUNCTION__);
 
   auto output_file = output_path + "/decrypted_data";
@@ -30,6 +30,7 @@ bool Test(std::string const& output_path, std::shared_ptr<AliceData> alice_data,
   Alice alice(alice_data, kDummyAliceId, kDummyBobId);
   Bob bob(bob_data, kDummyBobId, kDummyAliceId, demands);
   if (evil) alice.TestSetEvil();
+  bob.SetG1Uncompressed(g1_uncompressed);
 
   Request request;
   bob.GetRequest(request);
@@ -78,7 +79,8 @@ bool Test(std::string const& output_path, std::shared_ptr<AliceData> alice_data,
 
 namespace scheme::plain::atomic_swap {
 bool Test(std::string const& publish_path, std::string const& output_path,
-          std::vector<Range> const& demands, bool test_evil) {
+          std::vector<Range> const& demands, bool test_evil,
+          bool g1_uncompressed) {
   try {
     using scheme::plain::AliceData;
     using scheme::plain::BobData;
@@ -91,7 +93,7 @@ bool Test(std::string const& publish_path, std::string const& output_path,
     std::cout << "n: " << bulletin.n << ", s: " << bulletin.s
               << ", size: " << bulletin.size << "\n";
     return scheme::atomic_swap::Test(output_path, alice_data, bob_data, demands,
-                                     test_evil);
+                                     test_evil, g1_uncompressed);
   } catch (std::exception& e) {
     std::cerr << __FUNCTION__ << "\t" << e.what() << "\n";
     return false;
@@ -101,7 +103,8 @@ bool Test(std::string const& publish_path, std::string const& output_path,
 
 namespace scheme::table::atomic_swap {
 bool Test(std::string const& publish_path, std::string const& output_path,
-          std::vector<Range> const& demands, bool test_evil) {
+          std::vector<Range> const& demands, bool test_evil,
+          bool g1_uncompressed) {
   try {
     using scheme::table::AliceData;
     using scheme::table::BobData;
@@ -113,7 +116,7 @@ bool Test(std::string const& publish_path, std::string const& output_path,
     auto const& bulletin = bob_data->bulletin();
     std::cout << "n: " << bulletin.n << ", s: " << bulletin.s << "\n";
     return scheme::atomic_swap::Test(output_path, alice_data, bob_data, demands,
-                                     test_evil);
+                                     test_evil, g1_uncompressed);
   } catch (std::exception& e) {
     std::cerr << __FUNCTION__ << "\t" << e.what() << "\n";
     return false;
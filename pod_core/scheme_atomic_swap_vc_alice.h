@@ -5,6 +5,7 @@
 #include <vector>
 
 #include "ecc.h"
+#include "range_set.h"
 #include "scheme_atomic_swap_vc_misc.h"
 #include "scheme_atomic_swap_vc_protocol.h"
 
@@ -23,9 +24,6 @@ class Alice {
  public:
   void TestSetEvil() { evil_ = true; }
 
- private:
-  void BuildMapping();
-
  private:
   std::shared_ptr<AliceData> a_;
   h256_t const self_id_;
@@ -39,11 +37,8 @@ class Alice {
   h256_t seed2_;
 
  private:
-  struct Mapping {
-    uint64_t global_index;
-  };
   uint64_t demands_count_ = 0;
-  std::vector<Mapping> mappings_;
+  RangeSet demand_set_;
 
  private:
   Fr seed0_;
@@ -56,8 +51,8 @@ class Alice {
   Fr seed0_rand_;
 
  private:
-  ZkPkPtr zk_pk_;
-  ZkVkPtr zk_vk_;
+  ZkPkFamily zk_pks_;
+  ZkVkFamily zk_vks_;
 
  private:
   bool evil_ = false;
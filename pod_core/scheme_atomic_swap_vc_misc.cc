@@ -2,13 +2,20 @@
 #include <algorithm>
 #include <fstream>
 #include <iostream>
+#include <limits>
 #include <numeric>
 #include "scheme_atomic_swap_vc_zkp.h"
+#include "task.h"
 #include "tick.h"
+#include "zkp_key.h"
 
 namespace scheme::atomic_swap_vc {
 
 namespace {
+// Groth16 prover cost is linear in the circuit size, plus a fixed cost per
+// proof.
+uint64_t ZkpProveCost(uint64_t count) { return count + kZkpProofOverhead; }
+
 void ConvertToZkpItems(std::vector<ZkpItem>& zkp_items,
                        std::vector<ZkItem> const& zk_items,
                        std::vector<Fr> const& zk_ip_vw, Fr const& seed,
@@ -39,66 +46,111 @@ void ConvertToZkvItems(std::vector<ZkvItem>& zkv_items,
 }
 }  // namespace
 
-void BuildZkItems(std::vector<ZkItem>& zk_items, uint64_t n, uint64_t s,
-                  std::vector<Fr> const& w) {
-  assert(w.size() == n);
-  auto const kMimcCount = ZkpMimcCount();
-  auto pad_count_of_col = PadCountOfCol(n);
-  auto nn = n + pad_count_of_col;
-  if (nn <= kMimcCount) {
-    assert(pad_count_of_col == 1);
-    // one proof contains multiple col
-    auto col_count = kMimcCount / nn;
-    zk_items.resize((s + col_count - 1) / col_count);
-    for (size_t i = 0; i < zk_items.size(); ++i) {
-      auto& item = zk_items[i];
-      item.row = 0;
-      for (size_t j = 0; j < col_count; ++j) {
-        auto col = j + i * col_count;
-        if (col >= s) continue;
-        item.col.push_back(col);
+ZkPkFamily GetZkPkFamily() {
+  return ZkpKey::instance().GetZkPkFamily(kAtomicSwapVcZkpFamily);
+}
+
+ZkVkFamily GetZkVkFamily() {
+  return ZkpKey::instance().GetZkVkFamily(kAtomicSwapVcZkpFamily);
+}
+
+std::vector<uint64_t> PlanZkSizes(uint64_t n, uint64_t s,
+                                  std::vector<uint64_t> const& family) {
+  std::vector<uint64_t> sizes;
+  for (auto i : family) {
+    if (i >= 2) sizes.push_back(i);
+  }
+  std::sort(sizes.begin(), sizes.end());
+  sizes.erase(std::unique(sizes.begin(), sizes.end()), sizes.end());
+  if (sizes.empty() || !n || !s) return std::vector<uint64_t>();
+
+  // the full pieces always fill the largest circuit
+  auto max_size = sizes.back();
+  auto pad_count_of_col = PadCountOfCol(n, {max_size});
+  std::vector<uint64_t> zk_sizes((pad_count_of_col - 1) * s, max_size);
+
+  // pack the s tail pieces, dp[q] is the min cost to pack q pieces
+  auto tail_len = n - (max_size - 1) * (pad_count_of_col - 1) + 1;
+  std::vector<uint64_t> dp(s + 1, std::numeric_limits<uint64_t>::max());
+  std::vector<uint64_t> choice(s + 1);
+  dp[0] = 0;
+  for (uint64_t q = 1; q <= s; ++q) {
+    for (auto c : sizes) {
+      auto cap = c / tail_len;
+      if (!cap) continue;
+      auto cost = dp[q > cap ? q - cap : 0] + ZkpProveCost(c);
+      if (cost < dp[q]) {
+        dp[q] = cost;
+        choice[q] = c;
       }
     }
-  } else {
-    // one proof contains kMimicCount (part of col)
-    zk_items.resize(pad_count_of_col * s);
+  }
+
+  for (uint64_t q = s; q;) {
+    auto c = choice[q];
+    zk_sizes.push_back(c);
+    auto cap = c / tail_len;
+    q = q > cap ? q - cap : 0;
+  }
+  return zk_sizes;
+}
+
+bool BuildZkItems(std::vector<ZkItem>& zk_items, uint64_t n, uint64_t s,
+                  std::vector<Fr> const& w,
+                  std::vector<uint64_t> const& zk_sizes) {
+  assert(w.size() == n);
+  if (zk_sizes.empty() || zk_sizes.size() > n * s) return false;
+  for (auto i : zk_sizes) {
+    if (i < 2) return false;
+  }
+
+  auto pad_count_of_col = PadCountOfCol(n, zk_sizes);
+  auto row_count = *std::max_element(zk_sizes.begin(), zk_sizes.end()) - 1;
+  zk_items.clear();
+  zk_items.resize(zk_sizes.size());
+  for (size_t k = 0; k < zk_items.size(); ++k) {
+    zk_items[k].public_offset.reserve(zk_sizes[k]);
+    zk_items[k].public_w.reserve(zk_sizes[k]);
+  }
+
+  // the pieces are ordered by row then by col, the full pieces go first
+  size_t cur = 0;
+  for (uint64_t row = 0; row < pad_count_of_col; ++row) {
+    auto start_i = row_count * row;
+    auto end_i = std::min(start_i + row_count, n);
+    auto len = end_i - start_i + 1;
     for (uint64_t j = 0; j < s; ++j) {
-      for (uint64_t i = 0; i < pad_count_of_col; ++i) {
-        auto& item = zk_items[pad_count_of_col * j + i];
-        item.row = i;
-        item.col.push_back(j);  // only one column
+      if (zk_items[cur].public_w.size() + len > zk_sizes[cur]) {
+        if (zk_items[cur].public_w.empty()) return false;
+        if (++cur == zk_items.size()) return false;
+        if (len > zk_sizes[cur]) return false;
       }
-    }
-  }
+      auto& item = zk_items[cur];
 
-  for (auto& item : zk_items) {
-    item.public_offset.reserve(kMimcCount);
-    item.public_w.reserve(kMimcCount);
-    for (auto j : item.col) {
       // add spring
-      auto offset = (n + item.row) * s + j;
-      item.public_offset.push_back(offset);
+      item.public_offset.push_back((n + row) * s + j);
       item.public_w.push_back(Fr(1));
 
       // add element
-      auto start_i = (kMimcCount - 1) * item.row;
-      auto end_i = (kMimcCount - 1) * (item.row + 1);
-      if (end_i > n) end_i = n;
       for (auto i = start_i; i < end_i; ++i) {
-        offset = i * s + j;
-        item.public_offset.push_back(offset);
+        item.public_offset.push_back(i * s + j);
         item.public_w.push_back(w[i]);
       }
     }
+  }
+  if (cur + 1 != zk_items.size()) return false;
 
-    auto pad_count = kMimcCount - item.public_w.size();
+  for (size_t k = 0; k < zk_items.size(); ++k) {
+    auto& item = zk_items[k];
+    auto pad_count = zk_sizes[k] - item.public_w.size();
     for (uint64_t i = 0; i < pad_count; ++i) {
       item.public_offset.push_back(0);
       item.public_w.push_back(Fr(0));
     }
-    assert(item.public_offset.size() == kMimcCount);
-    assert(item.public_w.size() == kMimcCount);
+    assert(item.public_offset.size() == zk_sizes[k]);
+    assert(item.public_w.size() == zk_sizes[k]);
   }
+  return true;
 }
 
 void BuildZkIpVw(std::vector<Fr>& zk_ip_vw, std::vector<Fr> const& v,
@@ -115,11 +167,11 @@ void BuildZkIpVw(std::vector<Fr>& zk_ip_vw, std::vector<Fr> const& v,
   }
 }
 
-void BuildZkProofs(std::vector<ZkProof>& zk_proofs, ZkPk const& pk,
+bool BuildZkProofs(std::vector<ZkProof>& zk_proofs, ZkPkFamily const& pks,
                    std::vector<ZkItem> const& zk_items,
                    std::vector<Fr> const& zk_ip_vw, Fr const& seed,
                    Fr const& seed_rand, Fr seed_mimc3_digest,
-                   ZkVkPtr check_vk) {
+                   ZkVkFamily const& check_vks, TaskLoop* loop) {
   Tick tick(__FUNCTION__);
   std::vector<ZkpItem> zkp_items;
   ConvertToZkpItems(zkp_items, zk_items, zk_ip_vw, seed, seed_rand,
@@ -129,17 +181,22 @@ void BuildZkProofs(std::vector<ZkProof>& zk_proofs, ZkPk const& pk,
   std::cout << "BuildZkProofs: zk_items.size() " << zk_items.size()
             << "\n";
 
-#ifdef MULTICORE
-#ifndef _DEBUG
-#pragma omp parallel for
+#ifdef _DEBUG
+  ConcurrencyScope serial(1);
 #endif
-#endif
-  for (size_t i = 0; i < zk_items.size(); ++i) {
-    GenerateZkProof(zk_proofs[i], pk, zkp_items[i], check_vk);
-  }
+  ParallelFor(0, zk_items.size(), [&](int64_t i) {
+    if (loop && !loop->Step()) return;
+    auto count = zk_items[i].public_w.size();
+    auto const& pk = pks.at(count);
+    auto it = check_vks.find(count);
+    auto check_vk = it == check_vks.end() ? ZkVkPtr() : it->second;
+    GenerateZkProof(zk_proofs[i], *pk, zkp_items[i], check_vk);
+  });
+  return !loop || !loop->cancelled();
 }
 
-bool VerifyZkProofs(std::vector<ZkProof> const& zk_proofs, ZkVk const& vk,
+bool VerifyZkProofs(std::vector<ZkProof> const& zk_proofs,
+                    ZkVkFamily const& vks,
                     std::vector<ZkItem> const& zk_items,
                     std::vector<Fr> const& zk_ip_vw,
                     Fr const& seed_mimc3_digest) {
@@ -154,7 +211,9 @@ bool VerifyZkProofs(std::vector<ZkProof> const& zk_proofs, ZkVk const& vk,
   ConvertToZkvItems(zkv_items, zk_items, zk_ip_vw, seed_mimc3_digest);
 
   for (size_t i = 0; i < zk_items.size(); ++i) {
-    if (!VerifyZkProof(zk_proofs[i], vk, zkv_items[i])) return false;
+    auto it = vks.find(zk_items[i].public_w.size());
+    if (it == vks.end()) return false;
+    if (!VerifyZkProof(zk_proofs[i], *it->second, zkv_items[i])) return false;
   }
   return true;
 }
@@ -1,38 +1,66 @@
 #pragma once
 
 #include <stdint.h>
+#include <algorithm>
+#include <cassert>
 #include <vector>
 
 #include "ecc.h"
 #include "scheme_atomic_swap_vc_zkp.h"
 
+class TaskLoop;
+
 namespace scheme::atomic_swap_vc {
 
-inline uint64_t PadCountOfCol(uint64_t n) {
-  uint64_t kZkFrCount = ZkpMimcCount() - 1;
+// The fixed cost of one Groth16 proof, in circuit rows on top of the circuit
+// size. PlanZkSizes trades it against the padding of the bigger circuits,
+// TestZkpProveCost checks it against real proofs.
+uint64_t constexpr kZkpProofOverhead = 128;
+
+// The column is split into pieces of (max(zk_sizes) - 1) rows, every piece
+// has one pad row (the spring).
+inline uint64_t PadCountOfCol(uint64_t n,
+                              std::vector<uint64_t> const& zk_sizes) {
+  assert(!zk_sizes.empty());
+  uint64_t kZkFrCount =
+      *std::max_element(zk_sizes.begin(), zk_sizes.end()) - 1;
+  assert(kZkFrCount);
   return (n + kZkFrCount - 1) / kZkFrCount;
 }
 
 struct ZkItem {
   std::vector<uint64_t> public_offset;  // MimcInv(seed0+offset)
   std::vector<Fr> public_w;
-  std::vector<uint64_t> col;
-  uint64_t row;
 };
 
-void BuildZkItems(std::vector<ZkItem>& zk_items, uint64_t n, uint64_t s,
-                  std::vector<Fr> const& w);
+ZkPkFamily GetZkPkFamily();
+
+ZkVkFamily GetZkVkFamily();
+
+// Choose the circuit sizes (one per proof) which minimise the proving cost,
+// return empty if family can not cover the demands.
+std::vector<uint64_t> PlanZkSizes(uint64_t n, uint64_t s,
+                                  std::vector<uint64_t> const& family);
+
+// Pack the pieces into the circuits in order, return false if the zk_sizes
+// is not a valid plan.
+bool BuildZkItems(std::vector<ZkItem>& zk_items, uint64_t n, uint64_t s,
+                  std::vector<Fr> const& w,
+                  std::vector<uint64_t> const& zk_sizes);
 
 void BuildZkIpVw(std::vector<Fr>& zk_ip_vw, std::vector<Fr> const& v,
                  std::vector<ZkItem> const& zk_items);
 
-void BuildZkProofs(std::vector<ZkProof>& zk_proofs, ZkPk const& pk,
+// the loop (may be null) steps once per proof, return false if its task was
+// cancelled
+bool BuildZkProofs(std::vector<ZkProof>& zk_proofs, ZkPkFamily const& pks,
                    std::vector<ZkItem> const& zk_items,
                    std::vector<Fr> const& zk_ip_vw, Fr const& seed,
                    Fr const& seed_rand, Fr seed_mimc3_digest,
-                   ZkVkPtr check_vk);
+                   ZkVkFamily const& check_vks, TaskLoop* loop = nullptr);
 
-bool VerifyZkProofs(std::vector<ZkProof> const& zk_proofs, ZkVk const& vk,
+bool VerifyZkProofs(std::vector<ZkProof> const& zk_proofs,
+                    ZkVkFamily const& vks,
                     std::vector<ZkItem> const& zk_items,
                     std::vector<Fr> const& zk_ip_vw,
                     Fr const& seed_mimc3_digest);
@@ -0,0 +1,130 @@
+#include "scheme_atomic_swap_vc_misc_test.h"
+
+#include <chrono>
+#include <iostream>
+
+#include "chain.h"
+#include "mimc.h"
+#include "misc.h"
+#include "scheme_atomic_swap_vc_misc.h"
+
+namespace scheme::atomic_swap_vc {
+
+namespace {
+struct PlanCase {
+  uint64_t n;
+  uint64_t s;
+  std::vector<uint64_t> family;
+  std::vector<uint64_t> want;
+};
+
+// the microseconds of one proof of a count circuit, the best of three
+double ProveMicroseconds(ZkPkFamily const& pks, ZkVkFamily const& vks,
+                         uint64_t count) {
+  uint64_t n = count - 1;  // one piece fills the circuit
+  std::vector<uint64_t> zk_sizes{count};
+  std::vector<Fr> w;
+  ChainKeccak256(misc::RandH256(), n, w);
+  Fr seed = FrRand();
+  Fr seed_rand = FrRand();
+  Fr seed_mimc3_digest = Mimc3(seed, seed_rand);
+  std::vector<Fr> v;
+  ChainMimcInv(seed, n + PadCountOfCol(n, zk_sizes), v);
+
+  std::vector<ZkItem> zk_items;
+  if (!BuildZkItems(zk_items, n, 1, w, zk_sizes)) {
+    assert(false);
+    return -1;
+  }
+  std::vector<Fr> zk_ip_vw;
+  BuildZkIpVw(zk_ip_vw, v, zk_items);
+
+  double best = -1;
+  for (int i = 0; i < 3; ++i) {
+    std::vector<ZkProof> zk_proofs;
+    auto begin = std::chrono::steady_clock::now();
+    BuildZkProofs(zk_proofs, pks, zk_items, zk_ip_vw, seed, seed_rand,
+                  seed_mimc3_digest, ZkVkFamily());
+    auto end = std::chrono::steady_clock::now();
+    if (!VerifyZkProofs(zk_proofs, vks, zk_items, zk_ip_vw,
+                        seed_mimc3_digest)) {
+      assert(false);
+      return -1;
+    }
+    double us =
+        std::chrono::duration<double, std::micro>(end - begin).count();
+    if (best < 0 || us < best) best = us;
+  }
+  return best;
+}
+}  // namespace
+
+bool TestPlanZkSizes() {
+  std::vector<uint64_t> const family{64, 16};
+  std::vector<PlanCase> const cases{
+      {1, 1, family, {16}},
+      {15, 1, family, {16}},  // the piece is exactly the small circuit
+      {16, 1, family, {64}},  // one over
+      {63, 1, family, {64}},  // exactly the large circuit
+      {64, 1, family, {64, 16}},
+      {1, 4, family, {16}},
+      {15, 4, family, {64}},
+      {16, 4, family, {64, 64}},
+      {63, 4, family, {64, 64, 64, 64}},
+      {64, 4, family, {64, 64, 64, 64, 16}},
+      {16, 1, {16}, {16, 16}},
+      {0, 1, family, {}},
+      {1, 0, family, {}},
+      {1, 1, {}, {}},
+      {1, 1, {1}, {}},
+  };
+
+  for (auto const& c : cases) {
+    auto zk_sizes = PlanZkSizes(c.n, c.s, c.family);
+    if (zk_sizes != c.want) {
+      std::cerr << "PlanZkSizes(" << c.n << ", " << c.s << ") got "
+                << zk_sizes.size() << " sizes\n";
+      assert(false);
+      return false;
+    }
+    if (zk_sizes.empty()) continue;
+
+    std::vector<Fr> w(c.n, FrOne());
+    std::vector<ZkItem> zk_items;
+    if (!BuildZkItems(zk_items, c.n, c.s, w, zk_sizes)) {
+      assert(false);
+      return false;
+    }
+  }
+  return true;
+}
+
+bool TestZkpProveCost() {
+  auto pks = GetZkPkFamily();
+  auto vks = GetZkVkFamily();
+  if (pks.size() < 2) {
+    std::cout << "skip: fewer than two atomic_swap_vc keys\n";
+    return true;
+  }
+
+  auto small = pks.begin()->first;
+  auto large = pks.rbegin()->first;
+  auto t_small = ProveMicroseconds(pks, vks, small);
+  auto t_large = ProveMicroseconds(pks, vks, large);
+  if (t_small <= 0 || t_large <= t_small) {
+    assert(false);
+    return false;
+  }
+
+  // t = a * (count + overhead)
+  double overhead = (t_small * large - t_large * small) / (t_large - t_small);
+  std::cout << "zkp proof overhead: " << overhead << " rows, want "
+            << kZkpProofOverhead << "\n";
+  if (overhead < kZkpProofOverhead / 4.0 ||
+      overhead > kZkpProofOverhead * 4.0) {
+    assert(false);
+    return false;
+  }
+  return true;
+}
+}  // namespace scheme::atomic_swap_vc
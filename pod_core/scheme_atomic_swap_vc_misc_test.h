@@ -0,0 +1,11 @@
+#pragma once
+
+namespace scheme::atomic_swap_vc {
+// PlanZkSizes and BuildZkItems over the boundary counts
+bool TestPlanZkSizes();
+
+// fit the fixed proof cost from real proofs of the smallest and the largest
+// circuit and check kZkpProofOverhead against it, skipped if fewer than two
+// circuit sizes are loaded
+bool TestZkpProveCost();
+}  // namespace scheme::atomic_swap_vc
@@ -9,6 +9,8 @@ namespace scheme::atomic_swap_vc {
 struct Request {
   h256_t seed2_seed;
   std::vector<Range> demands;
+  std::vector<uint64_t> zk_sizes;  // circuit sizes bob can verify
+  bool g1_uncompressed = false;  // bob wants k uncompressed
 };
 
 struct Response {
@@ -17,8 +19,10 @@ struct Response {
   std::vector<Fr> vw;  // s
   
   Fr seed0_mimc3_digest;
+  std::vector<uint64_t> zk_sizes;  // circuit size of each proof
   std::vector<Fr> zk_ip_vw;
   std::vector<ZkProof> zk_proofs;
+  bool g1_uncompressed = false;  // not serialized, the seq size marks it
 };
 
 struct Receipt {
@@ -8,21 +8,25 @@ namespace scheme::atomic_swap_vc {
 // save to bin
 template <typename Ar>
 void serialize(Ar &ar, Request const &t) {
-  ar &YAS_OBJECT_NVP("Request", ("s", t.seed2_seed), ("p", t.demands));
+  ar &YAS_OBJECT_NVP("Request", ("s", t.seed2_seed), ("p", t.demands),
+                     ("z", t.zk_sizes), ("u", t.g1_uncompressed));
 }
 
 // load from bin
 template <typename Ar>
 void serialize(Ar &ar, Request &t) {
-  ar &YAS_OBJECT_NVP("Request", ("s", t.seed2_seed), ("p", t.demands));
+  ar &YAS_OBJECT_NVP("Request", ("s", t.seed2_seed), ("p", t.demands),
+                     ("z", t.zk_sizes), ("u", t.g1_uncompressed));
 }
 
 // save to bin
 template <typename Ar>
 void serialize(Ar &ar, Response const &t) {
+  G1WireScope wire(t.g1_uncompressed);
   ar &YAS_OBJECT_NVP("Response", ("k", t.k), ("m", t.m), ("vw", t.vw),
                      ("seed0_mimc3_digest", t.seed0_mimc3_digest),
-                     ("zk_ip_vw", t.zk_ip_vw), ("zk_proofs", t.zk_proofs));
+                     ("zk_sizes", t.zk_sizes), ("zk_ip_vw", t.zk_ip_vw),
+                     ("zk_proofs", t.zk_proofs));
 }
 
 // load from bin
@@ -30,7 +34,8 @@ template <typename Ar>
 void serialize(Ar &ar, Response &t) {
   ar &YAS_OBJECT_NVP("Response", ("k", t.k), ("m", t.m), ("vw", t.vw),
                      ("seed0_mimc3_digest", t.seed0_mimc3_digest),
-                     ("zk_ip_vw", t.zk_ip_vw), ("zk_proofs", t.zk_proofs));
+                     ("zk_sizes", t.zk_sizes), ("zk_ip_vw", t.zk_ip_vw),
+                     ("zk_proofs", t.zk_proofs));
 }
 
 // save to json
@@ -9,8 +9,7 @@ namespace scheme::atomic_swap_vc {
 void GenerateZkProof(ZkProof& proof, ZkPk const& pk, ZkpItem const& item,
                      ZkVkPtr check_vk) {
   using namespace libsnark;
-  auto const kCount = ZkpMimcCount();
-  assert(item.o.size() == kCount);
+  auto const kCount = item.o.size();
   assert(item.w.size() == kCount);
 
   // Create protoboard
@@ -76,8 +75,7 @@ void GenerateZkProof(ZkProof& proof, ZkPk const& pk, ZkpItem const& item,
 
 bool VerifyZkProof(ZkProof const& proof, ZkVk const& vk, ZkvItem const& item) {
   using namespace libsnark;
-  auto const kCount = ZkpMimcCount();
-  assert(item.o.size() == kCount);
+  auto const kCount = item.o.size();
   assert(item.w.size() == kCount);
 
   // Create protoboard
@@ -1,12 +1,13 @@
 #pragma once
 
+#include <map>
+#include <string>
 #include "zkp.h"
 
 namespace scheme::atomic_swap_vc {
 
-inline uint64_t constexpr ZkpMimcCount() {
-  return 1024;
-}
+typedef std::map<uint64_t, ZkPkPtr> ZkPkFamily;  // count -> pk
+typedef std::map<uint64_t, ZkVkPtr> ZkVkFamily;  // count -> vk
 
 struct ZkpItem {
   std::vector<ZkFr> o;
@@ -2,6 +2,7 @@
 
 #include "ecc.h"
 #include "public.h"
+#include "range_set.h"
 #include "scheme_complaint_protocol.h"
 
 namespace scheme::complaint {
@@ -19,9 +20,6 @@ class Alice {
  public:
   void TestSetEvil() { evil_ = true; }
 
- private:
-  void BuildMapping();
-
  private:
   std::shared_ptr<AliceData> a_;
   h256_t const self_id_;
@@ -35,11 +33,8 @@ class Alice {
   h256_t seed2_;
 
  private:
-  struct Mapping {
-    uint64_t global_index;
-  };
   uint64_t demands_count_ = 0;
-  std::vector<Mapping> mappings_;
+  RangeSet demand_set_;
 
  private:
   h256_t seed0_;
@@ -1,9 +1,12 @@
 #pragma once
 
+#include <atomic>
+
 #include "basic_types.h"
 #include "ecc.h"
 #include "omp_helper.h"
 #include "public.h"
+#include "range_set.h"
 #include "scheme_complaint_notary.h"
 #include "scheme_complaint_protocol.h"
 #include "scheme_misc.h"
@@ -16,6 +19,10 @@ class Bob {
   Bob(std::shared_ptr<BobData> b, h256_t const& self_id, h256_t const& peer_id,
       std::vector<Range> demands);
 
+ public:
+  // ask alice to send k uncompressed, default off
+  void SetG1Uncompressed(bool uncompressed) { g1_uncompressed_ = uncompressed; }
+
  public:
   void GetRequest(Request& request);
   bool OnResponse(Response response, Receipt& receipt);
@@ -24,8 +31,7 @@ class Bob {
   bool SaveDecrypted(std::string const& file);
 
  private:
-  void BuildMapping();
-  bool CheckEncryptedM();
+  bool CheckEncryptedM(TaskLoop* loop);
   bool CheckK(std::vector<Fr> const& v);
   bool CheckKDirect(std::vector<Fr> const& v);
   bool CheckKMultiExp(std::vector<Fr> const& v);
@@ -44,20 +50,19 @@ class Bob {
   std::vector<Range> const demands_;
   uint64_t demands_count_ = 0;
   h256_t seed2_seed_;
+  bool g1_uncompressed_ = false;
 
  private:
   std::vector<G1> k_;
 
  private:
-  struct Mapping {
-    uint64_t global_index;
-  };
-  std::vector<Mapping> mappings_;
+  RangeSet demand_set_;
 
  private:
   h256_t seed2_;
   std::vector<Fr> w_;  // size() is L
   h256_t k_mkl_root_;
+  mkl::Tree k_mkl_tree_;
   std::vector<Fr> decrypted_m_;
   std::vector<Fr> encrypted_m_;
   int64_t claim_i_ = -1;
@@ -8,11 +8,13 @@ namespace scheme::complaint {
 struct Request {
   h256_t seed2_seed;
   std::vector<Range> demands;
+  bool g1_uncompressed = false;  // bob wants k uncompressed
 };
 
 struct Response {
   std::vector<G1> k;
   std::vector<Fr> m;
+  bool g1_uncompressed = false;  // not serialized, the seq size marks it
 };
 
 struct Receipt {
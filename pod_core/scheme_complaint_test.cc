@@ -22,7 +22,7 @@ namespace scheme::complaint {
 template <typename AliceData, typename BobData>
 bool Test(std::string const& output_path, std::shared_ptr<AliceData> alice_data,
           std::shared_ptr<BobData> bob_data, std::vector<Range> const& demands,
-          bool evil) {
+          bool evil, bool g1_uncompressed) {
   Tick _tick_(__FUNCTION__);
 
   auto output_file = output_path + "/decrypted_data";
@@ -30,6 +30,7 @@ bool Test(std::string const& output_path, std::shared_ptr<AliceData> alice_data,
   Alice alice(alice_data, kDummyAliceId, kDummyBobId);
   Bob bob(bob_data, kDummyBobId, kDummyAliceId, demands);
   if (evil) alice.TestSetEvil();
+  bob.SetG1Uncompressed(g1_uncompressed);
 
   Request request;
   bob.GetRequest(request);
@@ -89,7 +90,8 @@ bool Test(std::string const& output_path, std::shared_ptr<AliceData> alice_data,
 
 namespace scheme::plain::complaint {
 bool Test(std::string const& publish_path, std::string const& output_path,
-          std::vector<Range> const& demands, bool test_evil) {
+          std::vector<Range> const& demands, bool test_evil,
+          bool g1_uncompressed) {
   try {
     using scheme::plain::AliceData;
     using scheme::plain::BobData;
@@ -101,8 +103,18 @@ bool Test(std::string const& publish_path, std::string const& output_path,
     auto const& bulletin = bob_data->bulletin();
     std::cout << "n: " << bulletin.n << ", s: " << bulletin.s
               << ", size: " << bulletin.size << "\n";
-    return scheme::complaint::Test(output_path, alice_data, bob_data, demands,
-                                   test_evil);
+    if (!scheme::complaint::Test(output_path, alice_data, bob_data, demands,
+                                 test_evil, g1_uncompressed)) {
+      return false;
+    }
+
+    // again with bob getting only the sigmas of the demands from alice
+    SigmaSlice slice;
+    alice_data->GetSigmaSlice(demands, slice);
+    auto slice_bob_data = std::make_shared<BobData>(bulletin_file, slice);
+    std::cout << "sigma slice: " << demands.size() << " ranges\n";
+    return scheme::complaint::Test(output_path, alice_data, slice_bob_data,
+                                   demands, test_evil, g1_uncompressed);
   } catch (std::exception& e) {
     std::cerr << __FUNCTION__ << "\t" << e.what() << "\n";
     return false;
@@ -112,7 +124,8 @@ bool Test(std::string const& publish_path, std::string const& output_path,
 
 namespace scheme::table::complaint {
 bool Test(std::string const& publish_path, std::string const& output_path,
-          std::vector<Range> const& demands, bool test_evil) {
+          std::vector<Range> const& demands, bool test_evil,
+          bool g1_uncompressed) {
   try {
     using scheme::table::AliceData;
     using scheme::table::BobData;
@@ -124,7 +137,7 @@ bool Test(std::string const& publish_path, std::string const& output_path,
     auto const& bulletin = bob_data->bulletin();
     std::cout << "n: " << bulletin.n << ", s: " << bulletin.s << "\n";
     return scheme::complaint::Test(output_path, alice_data, bob_data, demands,
-                                   test_evil);
+                                   test_evil, g1_uncompressed);
   } catch (std::exception& e) {
     std::cerr << __FUNCTION__ << "\t" << e.what() << "\n";
     return false;
@@ -2,6 +2,7 @@
 
 #include "ecc.h"
 #include "public.h"
+#include "range_set.h"
 #include "scheme_ot_complaint_protocol.h"
 
 namespace scheme::ot_complaint {
@@ -24,9 +25,6 @@ class Alice {
  public:
   void TestSetEvil() { evil_ = true; }
 
- private:
-  void BuildMapping();
-
  private:
   AliceDataPtr a_;
   h256_t const self_id_;
@@ -42,11 +40,8 @@ class Alice {
   h256_t seed2_seed_;
 
  private:
-  struct Mapping {
-    uint64_t global_index;
-  };
   uint64_t phantoms_count_ = 0;
-  std::vector<Mapping> mappings_;
+  RangeSet phantom_set_;
 
  private:
   h256_t seed0_;
@@ -1,10 +1,12 @@
 #pragma once
 
+#include <atomic>
 #include <memory>
 #include <string>
 #include "basic_types.h"
 #include "ecc.h"
 #include "misc.h"
+#include "range_set.h"
 #include "scheme_misc.h"
 #include "scheme_ot_complaint_protocol.h"
 
@@ -22,6 +24,10 @@ class Bob {
   bool OnNegoRequest(NegoARequest const& request, NegoAResponse& response);
   bool OnNegoResponse(NegoBResponse const& response);
 
+ public:
+  // ask alice to send k uncompressed, default off
+  void SetG1Uncompressed(bool uncompressed) { g1_uncompressed_ = uncompressed; }
+
  public:
   void GetRequest(Request& request);
   bool OnResponse(Response response, Receipt& receipt);
@@ -30,8 +36,8 @@ class Bob {
   bool SaveDecrypted(std::string const& file);
 
  private:
-  void BuildMapping();
-  bool CheckEncryptedM();
+  uint64_t PhantomOffset(uint64_t i) const;
+  bool CheckEncryptedM(TaskLoop* loop);
   bool CheckK(std::vector<Fr> const& v);
   bool CheckKDirect(std::vector<Fr> const& v);
   bool CheckKMultiExp(std::vector<Fr> const& v);
@@ -51,6 +57,7 @@ class Bob {
   std::vector<Range> const phantoms_;
   uint64_t demands_count_ = 0;
   uint64_t phantoms_count_ = 0;
+  bool g1_uncompressed_ = false;
 
  private:
   Request request_;
@@ -59,16 +66,14 @@ class Bob {
   h256_t seed2_seed_;
 
  private:
-  struct Mapping {
-    uint64_t phantom_offset;
-    uint64_t global_index;
-  };
-  std::vector<Mapping> mappings_;
+  RangeSet demand_set_;
+  RangeSet phantom_set_;
 
  private:
   h256_t seed2_;
   std::vector<Fr> w_;  // size() is L
   h256_t k_mkl_root_;
+  mkl::Tree k_mkl_tree_;
   std::vector<Fr> decrypted_m_;
   std::vector<Fr> encrypted_m_;
   int64_t claim_i_ = -1;
@@ -28,12 +28,14 @@ struct Request {
   std::vector<Range> phantoms;  // sizeof() = L
   std::vector<G1> ot_vi;        // sizeof() = K
   G1 ot_v;
+  bool g1_uncompressed = false;  // bob wants k uncompressed
 };
 
 struct Response {
   std::vector<G1> k;      // sizeof() = L
   std::vector<G1> ot_ui;  // sizeof() = K
   std::vector<Fr> m;      // sizeof() = L
+  bool g1_uncompressed = false;  // not serialized, the seq size marks it
 };
 
 struct Receipt {
@@ -57,19 +57,22 @@ void serialize(Ar &ar, NegoBResponse &t) {
 template <typename Ar>
 void serialize(Ar &ar, Request const &t) {
   ar &YAS_OBJECT_NVP("Request", ("s", t.seed2_seed), ("p", t.phantoms),
-                     ("ot_vi", t.ot_vi), ("ot_v", t.ot_v));
+                     ("ot_vi", t.ot_vi), ("ot_v", t.ot_v),
+                     ("u", t.g1_uncompressed));
 }
 
 // load from bin
 template <typename Ar>
 void serialize(Ar &ar, Request &t) {
   ar &YAS_OBJECT_NVP("Request", ("s", t.seed2_seed), ("p", t.phantoms),
-                     ("ot_vi", t.ot_vi), ("ot_v", t.ot_v));
+                     ("ot_vi", t.ot_vi), ("ot_v", t.ot_v),
+                     ("u", t.g1_uncompressed));
 }
 
 // save to bin
 template <typename Ar>
 void serialize(Ar &ar, Response const &t) {
+  G1WireScope wire(t.g1_uncompressed);
   ar &YAS_OBJECT_NVP("Response", ("k", t.k), ("o", t.ot_ui), ("m", t.m));
 }
 
@@ -22,7 +22,7 @@ namespace scheme::ot_complaint {
 template <typename AliceData, typename BobData>
 bool Test(std::string const& output_path, std::shared_ptr<AliceData> alice_data,
           std::shared_ptr<BobData> bob_data, std::vector<Range> const& demands,
-          std::vector<Range> const& phantoms, bool evil) {
+          std::vector<Range> const& phantoms, bool evil, bool g1_uncompressed) {
   Tick _tick_(__FUNCTION__);
 
   auto output_file = output_path + "/decrypted_data";
@@ -30,6 +30,7 @@ bool Test(std::string const& output_path, std::shared_ptr<AliceData> alice_data,
   Alice alice(alice_data, kDummyAliceId, kDummyBobId);
   Bob bob(bob_data, kDummyBobId, kDummyAliceId, demands, phantoms);
   if (evil) alice.TestSetEvil();
+  bob.SetG1Uncompressed(g1_uncompressed);
 
   NegoBRequest b_nego_request;
   bob.GetNegoReqeust(b_nego_request);
@@ -113,7 +114,7 @@ bool Test(std::string const& output_path, std::shared_ptr<AliceData> alice_data,
 namespace scheme::plain::ot_complaint {
 bool Test(std::string const& publish_path, std::string const& output_path,
           std::vector<Range> const& demands, std::vector<Range> const& phantoms,
-          bool test_evil) {
+          bool test_evil, bool g1_uncompressed) {
   try {
     using scheme::plain::AliceData;
     using scheme::plain::BobData;
@@ -126,7 +127,8 @@ bool Test(std::string const& publish_path, std::string const& output_path,
     std::cout << "n: " << bulletin.n << ", s: " << bulletin.s
               << ", size: " << bulletin.size << "\n";
     return scheme::ot_complaint::Test(output_path, alice_data, bob_data,
-                                      demands, phantoms, test_evil);
+                                      demands, phantoms, test_evil,
+                                      g1_uncompressed);
   } catch (std::exception& e) {
     std::cerr << __FUNCTION__ << "\t" << e.what() << "\n";
     return false;
@@ -138,7 +140,7 @@ bool Test(std::string const& publish_path, std::string const& output_path,
 namespace scheme::table::ot_complaint {
 bool Test(std::string const& publish_path, std::string const& output_path,
           std::vector<Range> const& demands, std::vector<Range> const& phantoms,
-          bool test_evil) {
+          bool test_evil, bool g1_uncompressed) {
   try {
     using scheme::table::AliceData;
     using scheme::table::BobData;
@@ -150,7 +152,8 @@ bool Test(std::string const& publish_path, std::string const& output_path,
     auto const& bulletin = bob_data->bulletin();
     std::cout << "n: " << bulletin.n << ", s: " << bulletin.s << "\n";
     return scheme::ot_complaint::Test(output_path, alice_data, bob_data,
-                                      demands, phantoms, test_evil);
+                                      demands, phantoms, test_evil,
+                                      g1_uncompressed);
   } catch (std::exception& e) {
     std::cerr << __FUNCTION__ << "\t" << e.what() << "\n";
     return false;
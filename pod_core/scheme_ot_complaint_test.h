@@ -6,11 +6,11 @@
 namespace scheme::plain::ot_complaint {
 bool Test(std::string const& publish_path, std::string const& output_path,
           std::vector<Range> const& demands, std::vector<Range> const& phantoms,
-          bool test_evil);
+          bool test_evil, bool g1_uncompressed);
 }  // namespace scheme::plain::ot_complaint
 
 namespace scheme::table::ot_complaint {
 bool Test(std::string const& publish_path, std::string const& output_path,
           std::vector<Range> const& demands, std::vector<Range> const& phantoms,
-          bool test_evil);
+          bool test_evil, bool g1_uncompressed);
 }  // namespace scheme::table::ot_complaint
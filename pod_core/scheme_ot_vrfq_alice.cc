@@ -2,6 +2,7 @@
 #include "chain.h"
 #include "public.h"
 #include "scheme_table_alice_data.h"
+#include "task.h"
 #include "vrf.h"
 
 namespace scheme::table::ot_vrfq {
@@ -20,12 +21,12 @@ void Alice::GetNegoReqeust(NegoARequest& request) { request.s = ot_self_pk_; }
 bool Alice::OnNegoRequest(NegoBRequest const& request,
                           NegoBResponse& response) {
   ot_peer_pk_ = request.t;
-  response.t_exp_alpha = ot_peer_pk_ * ot_alpha_;
+  response.t_exp_alpha = G1Exp(ot_peer_pk_, ot_alpha_);
   return true;
 }
 
 bool Alice::OnNegoResponse(NegoAResponse const& response) {
-  ot_sk_ = response.s_exp_beta * ot_alpha_;
+  ot_sk_ = G2Exp(response.s_exp_beta, ot_alpha_);
   return true;
 }
 
@@ -50,13 +51,27 @@ bool Alice::OnRequest(Request const& request, Response& response) {
   response.ot_ui.resize(request.ot_vi.size());
 
   for (size_t i = 0; i < response.ot_ui.size(); ++i) {
-    response.ot_ui[i] = request.ot_vi[i] * c;
+    response.ot_ui[i] = G1Exp(request.ot_vi[i], c);
   }
 
-  response.shuffled_psk_exp_r.resize(request.shuffled_value_digests.size());
+  if (!TaskProgress("pairing", 0.0)) return false;
+
+  std::vector<G1> v_exp_key_c(request.shuffled_value_digests.size());
   for (size_t i = 0; i < request.shuffled_value_digests.size(); ++i) {
     auto const& key_digest = request.shuffled_value_digests[i];
     Fr key_fr = BinToFr31(key_digest.data(), key_digest.data() + 31);
+    v_exp_key_c[i] = G1Exp(request.ot_v, key_fr * c);
+  }
+
+  std::vector<G1> ge;
+  TaskLoop pairing("pairing", 0.0, 0.5, v_exp_key_c.size());
+  if (!PairingToG1(v_exp_key_c, ot_sk_, ge, &pairing)) return false;
+
+  if (!TaskProgress("prove", 0.5)) return false;
+
+  response.shuffled_psk_exp_r.resize(request.shuffled_value_digests.size());
+  for (size_t i = 0; i < request.shuffled_value_digests.size(); ++i) {
+    auto const& key_digest = request.shuffled_value_digests[i];
 
     auto& shuffled_psk_exp_r = response.shuffled_psk_exp_r[i];
     vrf::ProveWithR(a_->vrf_sk(), key_digest.data(), r_, shuffled_psk_exp_r);
@@ -70,19 +85,8 @@ bool Alice::OnRequest(Request const& request, Response& response) {
     assert(fsk1 == fsk2);
 #endif
 
-    Fp12 e;
-    G1 v_exp_key_c = request.ot_v * (key_fr * c);
-    mcl::bn256::pairing(e, v_exp_key_c, ot_sk_);
-    uint8_t buf[32 * 12];
-    auto ret_len = e.serialize(buf, sizeof(buf));
-    if (ret_len != sizeof(buf)) {
-      assert(false);
-      throw std::runtime_error("oops");
-    }
-    G1 ge = MapToG1(buf, sizeof(buf));
-
     for (auto& j : shuffled_psk_exp_r) {
-      j += ge;
+      j += ge[i];
     }
   }
 
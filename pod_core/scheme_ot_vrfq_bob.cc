@@ -4,6 +4,7 @@
 #include "scheme_ot_vrfq_notary.h"
 #include "scheme_table.h"
 #include "scheme_table_bob_data.h"
+#include "task.h"
 
 namespace scheme::table::ot_vrfq {
 
@@ -57,12 +58,12 @@ void Bob::GetNegoReqeust(NegoBRequest& request) { request.t = ot_self_pk_; }
 
 bool Bob::OnNegoRequest(NegoARequest const& request, NegoAResponse& response) {
   ot_peer_pk_ = request.s;
-  response.s_exp_beta = ot_peer_pk_ * ot_beta_;
+  response.s_exp_beta = G2Exp(ot_peer_pk_, ot_beta_);
   return true;
 }
 
 bool Bob::OnNegoResponse(NegoBResponse const& response) {
-  ot_sk_ = response.t_exp_alpha * ot_beta_;
+  ot_sk_ = G1Exp(response.t_exp_alpha, ot_beta_);
   return true;
 }
 
@@ -74,9 +75,9 @@ void Bob::GetRequest(Request& request) {
   for (size_t i = 0; i < request.ot_vi.size(); ++i) {
     h256_t const& key_digest = value_digests_[i];
     Fr key_fr = BinToFr31(key_digest.data(), key_digest.data() + 31);
-    request.ot_vi[i] = ot_sk_ * (ot_rand_b_ * key_fr);
+    request.ot_vi[i] = G1Exp(ot_sk_, ot_rand_b_ * key_fr);
   }
-  request.ot_v = ot_self_pk_ * (ot_rand_a_ * ot_rand_b_);
+  request.ot_v = G1Exp(ot_self_pk_, ot_rand_a_ * ot_rand_b_);
 }
 
 bool Bob::OnResponse(Response const& response, Receipt& receipt) {
@@ -95,20 +96,23 @@ bool Bob::OnResponse(Response const& response, Receipt& receipt) {
     psk_exp_r[i] = response.shuffled_psk_exp_r[shuffle_reference_[i]];
   }
 
+  if (!TaskProgress("pairing", 0.0)) return false;
+
+  std::vector<G1> ui_exp_a(psk_exp_r.size());
+  for (size_t i = 0; i < psk_exp_r.size(); ++i) {
+    ui_exp_a[i] = G1Exp(response.ot_ui[i], ot_rand_a_);
+  }
+
+  std::vector<G1> ge;
+  TaskLoop pairing("pairing", 0.0, 0.5, ui_exp_a.size());
+  if (!PairingToG1(ui_exp_a, ot_peer_pk_, ge, &pairing)) return false;
+
+  if (!TaskProgress("verify", 0.5)) return false;
+
   last_psk_exp_r_.resize(psk_exp_r.size());
   for (size_t i = 0; i < psk_exp_r.size(); ++i) {
-    Fp12 e;
-    G1 ui_exp_a = response.ot_ui[i] * ot_rand_a_;
-    mcl::bn256::pairing(e, ui_exp_a, ot_peer_pk_);
-    uint8_t buf[32 * 12];
-    auto ret_len = e.serialize(buf, sizeof(buf));
-    if (ret_len != sizeof(buf)) {
-      assert(false);
-      throw std::runtime_error("oops");
-    }
-    G1 ge = MapToG1(buf, sizeof(buf));
     for (auto& j : psk_exp_r[i]) {
-      j -= ge;
+      j -= ge[i];
     }
 
     if (!vrf::VerifyWithR(b_->vrf_pk(), value_digests_[i].data(), psk_exp_r[i],
@@ -1,5 +1,6 @@
 #include "scheme_plain_alice_data.h"
 #include "scheme_misc.h"
+#include "public.h"
 #include "scheme_plain.h"
 
 namespace {}
@@ -14,6 +15,8 @@ AliceData::AliceData(std::string const& publish_path)
   std::string sigma_file = public_path + "/sigma";
   std::string sigma_mkl_tree_file = public_path + "/sigma_mkl_tree";
   std::string matrix_file = private_path + "/matrix";
+  std::string pad_file = private_path + "/pad";
+  std::string manifest_file = publish_path_ + "/manifest";
 
   if (!LoadBulletin(bulletin_file, bulletin_)) {
     assert(false);
@@ -32,8 +35,15 @@ AliceData::AliceData(std::string const& publish_path)
     throw std::runtime_error("invalid sigma mkl tree file");
   }
 
-  // matrix
-  if (!LoadMatrix(matrix_file, bulletin_.n * bulletin_.s, m_)) {
+  // the original and the pads, a merged dataset keeps them in the shards.
+  // An older publish saved the whole matrix instead.
+  if (fs::is_regular_file(manifest_file)) {
+    LoadShards(manifest_file);
+  } else if (fs::is_regular_file(pad_file)) {
+    pads_.resize(bulletin_.n);
+    shard_rows_ = bulletin_.n;
+    LoadOriginal(private_path, bulletin_.size, pads_.data());
+  } else if (!LoadMatrix(matrix_file, bulletin_.n * bulletin_.s, m_)) {
     assert(false);
     throw std::runtime_error("invalid matrix file");
   }
@@ -48,4 +58,65 @@ AliceData::AliceData(std::string const& publish_path)
             << "\n";
 }
 
+// throw
+void AliceData::LoadShards(std::string const& manifest_file) {
+  Manifest manifest;
+  if (!LoadManifest(manifest_file, manifest) ||
+      !IsManifestValid(manifest, bulletin_)) {
+    assert(false);
+    throw std::runtime_error("invalid manifest file");
+  }
+
+  pads_.resize(bulletin_.n);
+  shard_rows_ = manifest.shard_rows;
+  for (uint64_t i = 0; i < manifest.shards.size(); ++i) {
+    auto const& shard = manifest.shards[i];
+    LoadOriginal(shard.path + "/private", shard.size,
+                 pads_.data() + i * manifest.shard_rows);
+  }
+}
+
+// throw
+void AliceData::LoadOriginal(std::string const& private_path, uint64_t size,
+                             Fr* pads) {
+  auto n = GetDataBlockCount(size, bulletin_.s - 1);
+  if (!LoadMatrix(private_path + "/pad", n, pads)) {
+    assert(false);
+    throw std::runtime_error("invalid pad file");
+  }
+
+  // mapped for the whole session, the rows are read as they are demanded
+  io::mapped_file_params params;
+  params.path = private_path + "/original";
+  params.flags = io::mapped_file_base::readonly;
+  io::mapped_file_source view(params);
+  if (view.size() != size) {
+    assert(false);
+    throw std::runtime_error("invalid original file");
+  }
+  originals_.push_back(std::move(view));
+}
+
+void AliceData::GetRow(uint64_t i, Fr* row) const {
+  auto s = bulletin_.s;
+  assert(i < bulletin_.n);
+  if (!m_.empty()) {
+    std::copy(m_.begin() + i * s, m_.begin() + (i + 1) * s, row);
+    return;
+  }
+
+  auto const& view = originals_[i / shard_rows_];
+  auto start = (uint8_t const*)view.data();
+  auto end = start + view.size();
+  auto p = std::min(start + (i % shard_rows_) * (s - 1) * 31, end);
+  row[0] = pads_[i];
+  BinToFr31(p, end - p, row + 1, s - 1);
+}
+
+// throw
+void AliceData::GetSigmaSlice(std::vector<Range> const& demands,
+                              SigmaSlice& slice) const {
+  BuildSigmaSlice(sigmas_, sigma_mkl_tree_, demands, slice);
+}
+
 }  // namespace scheme::plain
@@ -8,6 +8,7 @@
 #include "bp.h"
 #include "bulletin_plain.h"
 #include "mkl_tree.h"
+#include "public.h"
 #include "scheme_misc.h"
 
 namespace scheme::plain {
@@ -16,14 +17,25 @@ class AliceData {
   AliceData(std::string const& publish_path);
   Bulletin const& bulletin() const { return bulletin_; }
   std::vector<G1> const& sigmas() const { return sigmas_; }
-  std::vector<Fr> const& m() const { return m_; }
+  // row i of the matrix, s items: the pad then the data of the original
+  void GetRow(uint64_t i, Fr* row) const;
+  // the demanded sigmas for a BobData that does not hold the sigma file
+  void GetSigmaSlice(std::vector<Range> const& demands,
+                     SigmaSlice& slice) const;
+
+ private:
+  void LoadShards(std::string const& manifest_file);
+  void LoadOriginal(std::string const& private_path, uint64_t size, Fr* pads);
 
  private:
   std::string const publish_path_;
   scheme::plain::Bulletin bulletin_;
   std::vector<G1> sigmas_;
   mkl::Tree sigma_mkl_tree_;
-  std::vector<Fr> m_;  // secret
+  std::vector<io::mapped_file_source> originals_;  // secret, one per shard
+  uint64_t shard_rows_ = 0;
+  std::vector<Fr> pads_;  // secret
+  std::vector<Fr> m_;     // secret, only a publish with private/matrix
 };
 
 typedef std::shared_ptr<AliceData> AliceDataPtr;
@@ -16,6 +16,17 @@ BobData::BobData(std::string const& bulletin_file,
   LoadData();
 }
 
+BobData::BobData(Bulletin const& bulletin, SigmaSlice const& slice)
+    : bulletin_(bulletin) {
+  LoadSlice(slice);
+}
+
+BobData::BobData(std::string const& bulletin_file, SigmaSlice const& slice) {
+  if (!LoadBulletin(bulletin_file, bulletin_))
+    throw std::runtime_error("Bob: invalid bulletin file");
+  LoadSlice(slice);
+}
+
 // throw
 bool BobData::NeedVerify() {
   bool verify = false;
@@ -44,23 +55,51 @@ void BobData::LoadData() {
 
   std::string verify_file = public_path_ + "/.verify";
   std::string sigma_file = public_path_ + "/sigma";
+  std::string sigma_cache_file = public_path_ + "/.sigma_cache";
 
   h256_t const* check_h;
   bool verify = NeedVerify();
 
   // sigma
   check_h = verify ? &bulletin_.sigma_mkl_root : nullptr;
-  if (!LoadSigma(sigma_file, bulletin_.n, check_h, sigmas_)) {
+  bool cache_updated;
+  if (!LoadSigmaCached(sigma_file, sigma_cache_file, bulletin_.n, check_h,
+                       sigmas_, &cache_updated)) {
     assert(false);
     throw std::runtime_error("invalid sigma file");
   }
 
-  if (verify) {
+  // a fresh cache must not trigger the next verify
+  if (verify || cache_updated) {
     fs::remove(verify_file);
     fs::ofstream dummy(verify_file);
   }
 }
 
+// throw
+void BobData::LoadSlice(SigmaSlice const& slice) {
+  if (!bulletin_.n || !bulletin_.s)
+    throw std::runtime_error("Bob: invalid bulletin");
+
+  if (!VerifySigmaSlice(slice, bulletin_.n, bulletin_.sigma_mkl_root,
+                        sigmas_)) {
+    throw std::runtime_error("invalid sigma slice");
+  }
+
+  sigma_set_ = RangeSet(slice.ranges);
+}
+
+// throw
+G1 const& BobData::sigma(uint64_t index) const {
+  if (sigma_set_.ranges().empty()) return sigmas_.at(index);
+  return sigmas_[sigma_set_.OffsetOf(index)];
+}
+
+bool BobData::HasSigmas(std::vector<Range> const& demands) const {
+  if (sigma_set_.ranges().empty()) return true;
+  return sigma_set_.Contains(demands);
+}
+
 bool BobData::SaveDecryped(std::string const& file,
                            std::vector<Range> const& demands,
                            std::vector<Fr> const& decrypted) {
@@ -6,6 +6,7 @@
 #include "basic_types.h"
 #include "bulletin_plain.h"
 #include "mkl_tree.h"
+#include "range_set.h"
 #include "scheme_misc.h"
 
 namespace scheme::plain {
@@ -14,13 +15,20 @@ class BobData {
  public:
   BobData(Bulletin const& bulletin, std::string const& public_path);
   BobData(std::string const& bulletin_file, std::string const& public_path);
+  // only the sigmas of the slice rows, checked by the range paths
+  BobData(Bulletin const& bulletin, SigmaSlice const& slice);
+  BobData(std::string const& bulletin_file, SigmaSlice const& slice);
   Bulletin const& bulletin() const { return bulletin_; }
-  std::vector<G1> sigmas() const { return sigmas_; }
+  // all the sigmas, or the slice rows in range order
+  std::vector<G1> const& sigmas() const { return sigmas_; }
+  G1 const& sigma(uint64_t index) const;  // throw
+  bool HasSigmas(std::vector<Range> const& demands) const;
   bool SaveDecryped(std::string const& file, std::vector<Range> const& demands,
                     std::vector<Fr> const& decrypted);
 
  private:
   void LoadData();
+  void LoadSlice(SigmaSlice const& slice);
   bool NeedVerify();
 
  private:
@@ -29,6 +37,7 @@ class BobData {
 
  private:
   std::vector<G1> sigmas_;
+  RangeSet sigma_set_;  // empty if all the sigmas are loaded
 };
 
 typedef std::shared_ptr<BobData> BobDataPtr;
@@ -0,0 +1,180 @@
+#include "scheme_plain_shard_test.h"
+
+#include <cassert>
+#include <fstream>
+#include <random>
+
+#include "bulletin_plain.h"
+#include "misc.h"
+#include "public.h"
+#include "publish.h"
+#include "scheme_complaint_test.h"
+#include "scheme_misc.h"
+
+namespace {
+uint64_t const kColumnNum = 2;
+uint64_t const kShardRows = 4;
+uint64_t const kShardSize = kShardRows * kColumnNum * 31;
+// two full shards and a last one of 2 rows, the last row partial
+uint64_t const kFileSize = 2 * kShardSize + 100;
+
+bool CreateFile(std::string const& file, uint64_t size) {
+  std::mt19937 rng(size);
+  std::string data(size, 0);
+  for (auto& c : data) c = (char)(rng() & 0xff);
+  std::ofstream os(file, std::ios::binary);
+  os.write(data.data(), data.size());
+  return (bool)os;
+}
+
+// the root of the tree over the sigmas of all the shards, built the way a
+// whole file publish builds it
+bool CalcWholeRoot(std::vector<std::string> const& shard_paths,
+                   h256_t& root) {
+  using namespace scheme;
+  using namespace scheme::plain;
+  std::vector<G1> sigmas;
+  for (auto const& path : shard_paths) {
+    Bulletin bulletin;
+    if (!LoadBulletin(path + "/bulletin", bulletin)) return false;
+    std::vector<G1> shard_sigmas;
+    if (!LoadSigma(path + "/public/sigma", bulletin.n,
+                   &bulletin.sigma_mkl_root, shard_sigmas)) {
+      return false;
+    }
+    sigmas.insert(sigmas.end(), shard_sigmas.begin(), shard_sigmas.end());
+  }
+  root = BuildSigmaMklTree(sigmas).back();
+  return true;
+}
+
+bool TestBadManifests(std::string const& merged_path) {
+  using namespace scheme::plain;
+  Manifest manifest;
+  Bulletin bulletin;
+  if (!LoadManifest(merged_path + "/manifest", manifest) ||
+      !LoadBulletin(merged_path + "/bulletin", bulletin) ||
+      !IsManifestValid(manifest, bulletin)) {
+    assert(false);
+    return false;
+  }
+
+  // a non-last shard one row short, the totals still add up
+  {
+    auto bad_manifest = manifest;
+    auto bad_bulletin = bulletin;
+    auto& shard = bad_manifest.shards[0];
+    shard.n -= 1;
+    shard.size -= kColumnNum * 31;
+    bad_bulletin.n -= 1;
+    bad_bulletin.size -= kColumnNum * 31;
+    if (IsManifestValid(bad_manifest, bad_bulletin)) {
+      assert(false);
+      return false;
+    }
+  }
+
+  // the last shard claims one row less than its size needs
+  {
+    auto bad_manifest = manifest;
+    auto bad_bulletin = bulletin;
+    bad_manifest.shards.back().n -= 1;
+    bad_bulletin.n -= 1;
+    if (IsManifestValid(bad_manifest, bad_bulletin)) {
+      assert(false);
+      return false;
+    }
+  }
+
+  // two full shards swapped, the sizes match but the roots merge differently
+  {
+    auto bad_manifest = manifest;
+    std::swap(bad_manifest.shards[0], bad_manifest.shards[1]);
+    if (IsManifestValid(bad_manifest, bulletin)) {
+      assert(false);
+      return false;
+    }
+  }
+  return true;
+}
+}  // namespace
+
+namespace scheme::plain {
+bool TestShards(std::string const& output_path) {
+  std::string test_path = output_path + "/shard_test";
+  fs::remove_all(test_path);
+  if (!fs::create_directories(test_path)) {
+    assert(false);
+    return false;
+  }
+
+  std::string file = test_path + "/data";
+  if (!CreateFile(file, kFileSize)) {
+    assert(false);
+    return false;
+  }
+
+  std::string whole_path = test_path + "/whole";
+  if (!PublishPlain(file, whole_path, kColumnNum)) {
+    assert(false);
+    return false;
+  }
+
+  uint64_t const shard_count = (kFileSize + kShardSize - 1) / kShardSize;
+  std::vector<std::string> shard_paths;
+  for (uint64_t i = 0; i < shard_count; ++i) {
+    shard_paths.push_back(test_path + "/shard_" + std::to_string(i));
+    if (!PublishPlainShard(file, shard_paths.back(), kColumnNum, kShardRows,
+                           i)) {
+      assert(false);
+      return false;
+    }
+  }
+
+  std::string merged_path = test_path + "/merged";
+  if (!MergePlainShards(shard_paths, merged_path)) {
+    assert(false);
+    return false;
+  }
+
+  Bulletin whole;
+  Bulletin merged;
+  if (!LoadBulletin(whole_path + "/bulletin", whole) ||
+      !LoadBulletin(merged_path + "/bulletin", merged)) {
+    assert(false);
+    return false;
+  }
+  if (merged.size != whole.size || merged.n != whole.n ||
+      merged.s != whole.s) {
+    assert(false);
+    return false;
+  }
+
+  // the pads are random per publish, so the root of the whole publish is
+  // matched by the whole file tree over the sigmas of the shards
+  h256_t whole_root;
+  if (!CalcWholeRoot(shard_paths, whole_root) ||
+      whole_root != merged.sigma_mkl_root) {
+    assert(false);
+    return false;
+  }
+
+  if (!TestBadManifests(merged_path)) return false;
+
+  // the merged dataset loads through the manifest and its shards
+  std::vector<Range> all{Range(0, merged.n)};
+  if (!complaint::Test(merged_path, test_path, all, false, false) ||
+      !misc::IsSameFile(test_path + "/decrypted_data", file)) {
+    assert(false);
+    return false;
+  }
+
+  // the demands cross the shard boundaries and end in the partial shard
+  std::vector<Range> demands{Range(1, 2), Range(3, 3), Range(9, 1)};
+  if (!complaint::Test(merged_path, test_path, demands, false, false)) {
+    assert(false);
+    return false;
+  }
+  return true;
+}
+}  // namespace scheme::plain
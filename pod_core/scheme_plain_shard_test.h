@@ -0,0 +1,10 @@
+#pragma once
+
+#include <string>
+
+namespace scheme::plain {
+// publishes a file whole and in shards with a partial last shard, merges the
+// shards and runs the complaint protocol on the merged dataset. Also checks
+// that IsManifestValid rejects broken manifests. Writes into output_path.
+bool TestShards(std::string const& output_path);
+}  // namespace scheme::plain
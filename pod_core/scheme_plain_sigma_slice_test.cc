@@ -0,0 +1,99 @@
+#include "scheme_plain_sigma_slice_test.h"
+
+#include <cassert>
+#include <fstream>
+#include <functional>
+#include <random>
+
+#include "public.h"
+#include "publish.h"
+#include "scheme_plain_alice_data.h"
+#include "scheme_plain_bob_data.h"
+
+namespace {
+uint64_t const kColumnNum = 2;
+uint64_t const kFileSize = 20 * kColumnNum * 31 - 10;
+
+bool CreateFile(std::string const& file, uint64_t size) {
+  std::mt19937 rng(size);
+  std::string data(size, 0);
+  for (auto& c : data) c = (char)(rng() & 0xff);
+  std::ofstream os(file, std::ios::binary);
+  os.write(data.data(), data.size());
+  return (bool)os;
+}
+
+bool IsSliceValid(scheme::plain::Bulletin const& bulletin,
+                  scheme::SigmaSlice const& slice) {
+  try {
+    scheme::plain::BobData bob_data(bulletin, slice);
+    return true;
+  } catch (std::exception&) {
+    return false;
+  }
+}
+}  // namespace
+
+namespace scheme::plain {
+bool TestSigmaSlice(std::string const& output_path) {
+  std::string test_path = output_path + "/sigma_slice_test";
+  fs::remove_all(test_path);
+  if (!fs::create_directories(test_path)) {
+    assert(false);
+    return false;
+  }
+
+  std::string file = test_path + "/data";
+  std::string publish_path = test_path + "/publish";
+  // the same file again, the pads and so the sigmas differ
+  std::string other_path = test_path + "/other";
+  if (!CreateFile(file, kFileSize) ||
+      !PublishPlain(file, publish_path, kColumnNum) ||
+      !PublishPlain(file, other_path, kColumnNum)) {
+    assert(false);
+    return false;
+  }
+
+  AliceData alice_data(publish_path);
+  AliceData other_data(other_path);
+  auto const& bulletin = alice_data.bulletin();
+
+  // scattered, the last one ends at the last row
+  std::vector<Range> demands{Range(1, 2), Range(7, 3),
+                             Range(bulletin.n - 1, 1)};
+  SigmaSlice slice;
+  alice_data.GetSigmaSlice(demands, slice);
+  if (!IsSliceValid(bulletin, slice) || slice.path.empty()) {
+    assert(false);
+    return false;
+  }
+
+  std::vector<std::function<void(SigmaSlice&)>> const breaks{
+      [](SigmaSlice& s) { s.sigmas[1][7] ^= 1; },
+      [](SigmaSlice& s) { s.path.pop_back(); },
+      [](SigmaSlice& s) { s.path.erase(s.path.begin()); },
+      [](SigmaSlice& s) { s.path.push_back(s.path.back()); },
+      [](SigmaSlice& s) { s.ranges[1].count -= 1; },
+      [](SigmaSlice& s) { s.ranges.pop_back(); },
+      [](SigmaSlice& s) { s.sigmas.pop_back(); },
+  };
+  for (auto const& break_slice : breaks) {
+    auto bad_slice = slice;
+    break_slice(bad_slice);
+    if (IsSliceValid(bulletin, bad_slice)) {
+      assert(false);
+      return false;
+    }
+  }
+
+  // a valid slice, but under another root
+  SigmaSlice other_slice;
+  other_data.GetSigmaSlice(demands, other_slice);
+  if (!IsSliceValid(other_data.bulletin(), other_slice) ||
+      IsSliceValid(bulletin, other_slice)) {
+    assert(false);
+    return false;
+  }
+  return true;
+}
+}  // namespace scheme::plain
@@ -0,0 +1,10 @@
+#pragma once
+
+#include <string>
+
+namespace scheme::plain {
+// a BobData built from a sigma slice rejects flipped sigmas, broken paths,
+// ranges that do not match the sigmas and slices of another dataset. Writes
+// into output_path.
+bool TestSigmaSlice(std::string const& output_path);
+}  // namespace scheme::plain
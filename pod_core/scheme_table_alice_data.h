@@ -1,6 +1,7 @@
 #pragma once
 
 #include <stdint.h>
+#include <algorithm>
 #include <memory>
 #include <string>
 
@@ -23,6 +24,11 @@ class AliceData {
   vrf::Sk<> const& vrf_sk() const { return vrf_sk_; }
   std::vector<G1> const& sigmas() const { return sigmas_; }
   std::vector<Fr> const& m() const { return m_; }
+  // row i of the matrix, s items
+  void GetRow(uint64_t i, Fr* row) const {
+    std::copy(m_.begin() + i * bulletin_.s, m_.begin() + (i + 1) * bulletin_.s,
+              row);
+  }
 
  public:
   VrfKeyMeta const* GetKeyMetaByName(std::string const& name);
@@ -45,6 +45,7 @@ void BobData::LoadData() {
 
   std::string verify_file = public_path_ + "/.verify";
   std::string sigma_file = public_path_ + "/sigma";
+  std::string sigma_cache_file = public_path_ + "/.sigma_cache";
   std::string sigma_mkl_tree_file = public_path_ + "/sigma_mkl_tree";
   std::string vrf_pk_file = public_path_ + "/vrf_pk";
   std::string key_meta_file = public_path_ + "/vrf_meta";
@@ -74,20 +75,22 @@ void BobData::LoadData() {
 
   // sigma
   check_h = verify ? &bulletin_.sigma_mkl_root : nullptr;
-  if (!LoadSigma(sigma_file, bulletin_.n, check_h, sigmas_)) {
+  bool cache_updated;
+  if (!LoadSigmaCached(sigma_file, sigma_cache_file, bulletin_.n, check_h,
+                       sigmas_, &cache_updated)) {
     assert(false);
     throw std::runtime_error("invalid sigma file");
   }
 
   // vrf bp
   if (verify) {
-    for (size_t j = 0; j < vrf_meta_.keys.size(); ++j) {
-      auto key_bp_file = public_path_ + "/key_bp_" + std::to_string(j);
-      if (!VerifyKeyBp(key_bp_file, bulletin_, vrf_meta_, j, key_m_[j],
-                       sigmas_)) {
-        assert(false);
-        throw std::runtime_error("invalid key bp file");
-      }
+    std::vector<std::string> key_bp_files(vrf_meta_.keys.size());
+    for (size_t j = 0; j < key_bp_files.size(); ++j) {
+      key_bp_files[j] = public_path_ + "/key_bp_" + std::to_string(j);
+    }
+    if (!VerifyKeyBps(key_bp_files, bulletin_, vrf_meta_, key_m_, sigmas_)) {
+      assert(false);
+      throw std::runtime_error("invalid key bp file");
     }
   }
 
@@ -98,7 +101,8 @@ void BobData::LoadData() {
     throw std::runtime_error("invalid vrf pk file");
   }
 
-  if (verify) {
+  // a fresh cache must not trigger the next verify
+  if (verify || cache_updated) {
     fs::remove(verify_file);
     fs::ofstream dummy(verify_file);
   }
@@ -20,7 +20,10 @@ class BobData {
   Bulletin const& bulletin() const { return bulletin_; }
   vrf::Pk<> const& vrf_pk() const { return vrf_pk_; }
   VrfMeta const& vrf_meta() const { return vrf_meta_; }
-  std::vector<G1> sigmas() const { return sigmas_; }
+  std::vector<G1> const& sigmas() const { return sigmas_; }
+  G1 const& sigma(uint64_t index) const { return sigmas_[index]; }
+  // table mode always loads all the sigmas, the key bps need them
+  bool HasSigmas(std::vector<Range> const&) const { return true; }
   std::vector<std::vector<Fr>> const& key_m() const { return key_m_; }
   bool SaveDecryped(std::string const& file, std::vector<Range> const& demands,
                     std::vector<Fr> const& decrypted);
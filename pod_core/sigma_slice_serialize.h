@@ -0,0 +1,20 @@
+#pragma once
+
+#include "basic_types_serialize.h"
+#include "scheme_misc.h"
+
+namespace scheme {
+// save to bin
+template <typename Ar>
+void serialize(Ar &ar, SigmaSlice const &t) {
+  ar &YAS_OBJECT_NVP("SigmaSlice", ("r", t.ranges), ("s", t.sigmas),
+                     ("p", t.path));
+}
+
+// load from bin
+template <typename Ar>
+void serialize(Ar &ar, SigmaSlice &t) {
+  ar &YAS_OBJECT_NVP("SigmaSlice", ("r", t.ranges), ("s", t.sigmas),
+                     ("p", t.path));
+}
+}  // namespace scheme
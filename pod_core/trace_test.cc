@@ -0,0 +1,64 @@
+#include "trace_test.h"
+
+#include <cassert>
+#include <fstream>
+#include <set>
+#include <sstream>
+#include <thread>
+
+#include "trace.h"
+
+namespace {
+char const* const kSpanName = "trace_test_span";
+
+// the tids of the kSpanName events in a chrome trace
+std::set<uint32_t> SpanTids(std::string const& file) {
+  std::set<uint32_t> tids;
+  std::ifstream is(file);
+  std::string line;
+  std::string const name = std::string("\"name\": \"") + kSpanName + "\"";
+  std::string const tid = "\"tid\": ";
+  while (std::getline(is, line)) {
+    if (line.find(name) == std::string::npos) continue;
+    auto pos = line.find(tid);
+    if (pos == std::string::npos) continue;
+    tids.insert((uint32_t)std::stoul(line.substr(pos + tid.size())));
+  }
+  return tids;
+}
+}  // namespace
+
+bool TestTraceRecycle(std::string const& output_path) {
+  bool const enabled = trace::Enabled();
+  trace::Reset();
+  trace::Enable(true);
+
+  int const kThreads = 8;
+  for (int i = 0; i < kThreads; ++i) {
+    std::thread([]() { trace::Span span(kSpanName); }).join();
+  }
+
+  std::string chrome_file = output_path + "/trace_test.json";
+  bool saved = trace::SaveChromeTrace(chrome_file);
+  std::ostringstream summary;
+  trace::DumpSummary(summary);
+
+  trace::Enable(enabled);
+  trace::Reset();
+
+  if (!saved || SpanTids(chrome_file).size() != 1) {
+    assert(false);
+    return false;
+  }
+
+  // an empty span is far under 1 us
+  auto const& s = summary.str();
+  std::string count = std::string(kSpanName) + ": count " +
+                      std::to_string(kThreads) + ",";
+  if (s.find(count) == std::string::npos ||
+      s.find(" [0,1) ") == std::string::npos) {
+    assert(false);
+    return false;
+  }
+  return true;
+}
@@ -0,0 +1,8 @@
+#pragma once
+
+#include <string>
+
+// threads that run one after another record into the same recycled buffer,
+// and the summary puts spans under 1 us into their own bucket. Writes a
+// chrome trace into output_path.
+bool TestTraceRecycle(std::string const& output_path);
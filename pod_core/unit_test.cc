@@ -0,0 +1,54 @@
+#include "unit_test.h"
+
+#include <functional>
+#include <iostream>
+#include <vector>
+
+#include "basic_types_serialize_test.h"
+#include "capi/task_test_capi.h"
+#include "mkl_tree_test.h"
+#include "scheme_atomic_swap_vc_misc_test.h"
+#include "scheme_plain_shard_test.h"
+#include "scheme_plain_sigma_slice_test.h"
+#include "tick.h"
+#include "trace_test.h"
+
+namespace {
+struct UnitTestItem {
+  char const* name;
+  std::function<bool()> test;
+};
+}  // namespace
+
+bool UnitTest(std::string const& output_path) {
+  std::vector<UnitTestItem> const items{
+      {"PlanZkSizes", scheme::atomic_swap_vc::TestPlanZkSizes},
+      {"ZkpProveCost", scheme::atomic_swap_vc::TestZkpProveCost},
+      {"G1SeqSize", TestG1SeqSize},
+      {"MklRangesPath", mkl::TestRangesPath},
+      {"TaskLoop", TestTaskLoop},
+      {"CapiAsync", TestCapiAsync},
+      {"TraceRecycle",
+       [&output_path]() { return TestTraceRecycle(output_path); }},
+      {"PlainShards",
+       [&output_path]() { return scheme::plain::TestShards(output_path); }},
+      {"PlainSigmaSlice",
+       [&output_path]() { return scheme::plain::TestSigmaSlice(output_path); }},
+  };
+
+  size_t failed = 0;
+  for (auto const& item : items) {
+    bool ret;
+    try {
+      Tick _tick_(item.name);
+      ret = item.test();
+    } catch (std::exception& e) {
+      std::cerr << item.name << "\t" << e.what() << "\n";
+      ret = false;
+    }
+    std::cout << (ret ? "pass: " : "FAIL: ") << item.name << "\n";
+    if (!ret) ++failed;
+  }
+  std::cout << items.size() - failed << "/" << items.size() << " passed\n";
+  return !failed;
+}
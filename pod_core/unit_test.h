@@ -0,0 +1,6 @@
+#pragma once
+
+#include <string>
+
+// the self contained tests, output_path is their scratch dir
+bool UnitTest(std::string const& output_path);
@@ -1,10 +1,12 @@
 #pragma once
 
 #include <boost/noncopyable.hpp>
+#include <map>
 #include <mutex>
 #include <unordered_map>
-#include "zkp.h"
 #include "tick.h"
+#include "zkp.h"
+#include "zkp_key_name.h"
 
 class ZkpKey : boost::noncopyable {
  public:
@@ -25,6 +27,15 @@ class ZkpKey : boost::noncopyable {
     return ZkVkPtr();
   }
 
+  // keys named ZkpKeyName(name, count), for example atomic_swap_vc_1024
+  std::map<uint64_t, ZkPkPtr> GetZkPkFamily(std::string const& name) const {
+    return GetFamily(pk_, name);
+  }
+
+  std::map<uint64_t, ZkVkPtr> GetZkVkFamily(std::string const& name) const {
+    return GetFamily(vk_, name);
+  }
+
   bool IsEmpty() const { return pk_.empty() && vk_.empty(); }
 
  private:
@@ -44,6 +55,17 @@ class ZkpKey : boost::noncopyable {
       }
     }
   }
+  template <typename T>
+  static std::map<uint64_t, T> GetFamily(
+      std::unordered_map<std::string, T> const& keys, std::string const& name) {
+    std::map<uint64_t, T> family;
+    for (auto const& i : keys) {
+      uint64_t count;
+      if (ParseZkpKeyName(i.first, name, &count)) family[count] = i.second;
+    }
+    return family;
+  }
+
   std::string path_;
   std::unordered_map<std::string, ZkPkPtr> pk_;
   std::unordered_map<std::string, ZkVkPtr> vk_;
@@ -1,3 +1,3 @@
 module github.com/sec-bit/zkPoD-lib/pod_go
 
-go 1.12
+go 1.21
@@ -60,6 +60,34 @@ func (a *A) Free() error {
 	return nil
 }
 
+// SigmaSlice provides the Go interface for E_PlainAliceSigmaSlice()
+func (a *A) SigmaSlice(demands []types.Range, sliceFile string) error {
+	nrDemands := len(demands)
+	if nrDemands == 0 {
+		return fmt.Errorf("no demands")
+	}
+
+	cDemands := make([]C.range_t, nrDemands)
+	for idx, demand := range demands {
+		cDemands[idx].start = C.uint64_t(demand.Start)
+		cDemands[idx].count = C.uint64_t(demand.Count)
+	}
+	cDemandsPtr := (*C.range_t)(unsafe.Pointer(&cDemands[0]))
+
+	sliceFileCStr := C.CString(sliceFile)
+	defer C.free(unsafe.Pointer(sliceFileCStr))
+
+	ret := bool(C.E_PlainAliceSigmaSlice(
+		C.handle_t(a.handle), cDemandsPtr, C.uint64_t(nrDemands),
+		sliceFileCStr))
+	if !ret {
+		return fmt.Errorf(
+			"E_PlainAliceSigmaSlice(%v, %v, %s) failed",
+			a.handle, demands, sliceFile)
+	}
+	return nil
+}
+
 // NewB provides the Go interface for E_PlainBobDataNew()
 //
 // XXX: setup.Load() must have been called.
@@ -86,6 +114,33 @@ func NewB(bulletinFile, publicPath string) (*B, error) {
 	return &B{handle: handle}, nil
 }
 
+// NewBFromSlice provides the Go interface for E_PlainBobDataNewFromSlice()
+//
+// XXX: setup.Load() must have been called.
+func NewBFromSlice(bulletinFile, sliceFile string) (*B, error) {
+	if err := utils.CheckRegularFileReadPerm(bulletinFile); err != nil {
+		return nil, err
+	}
+	if err := utils.CheckRegularFileReadPerm(sliceFile); err != nil {
+		return nil, err
+	}
+
+	bulletinFileCStr := C.CString(bulletinFile)
+	defer C.free(unsafe.Pointer(bulletinFileCStr))
+
+	sliceFileCStr := C.CString(sliceFile)
+	defer C.free(unsafe.Pointer(sliceFileCStr))
+
+	handle := types.CHandle(
+		C.E_PlainBobDataNewFromSlice(bulletinFileCStr, sliceFileCStr))
+	if handle == nil {
+		return nil, fmt.Errorf(
+			"E_PlainBobDataNewFromSlice(%s, %s) failed", bulletinFile, sliceFile)
+	}
+
+	return &B{handle: handle}, nil
+}
+
 func (b *B) CHandle() types.CHandle {
 	return b.handle
 }
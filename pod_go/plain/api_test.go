@@ -1,9 +1,12 @@
 package plain
 
 import (
+	"fmt"
+	"os"
 	"testing"
 
 	"github.com/sec-bit/zkPoD-lib/pod_go/setup"
+	"github.com/sec-bit/zkPoD-lib/pod_go/types"
 )
 
 const (
@@ -17,6 +20,8 @@ const (
 
 	testPlainBulletinSucc = "../test_data/publish/plain/bulletin"
 	testPlainBulletinFail = "../test_data/publish/plain_not_exist_dir/bulletin"
+
+	testOutputDir = "../test_data/output/plain_slice"
 )
 
 var (
@@ -83,3 +88,59 @@ func TestFreeB(t *testing.T) {
 		t.Errorf("%v\n", err)
 	}
 }
+
+func TestSigmaSlice(t *testing.T) {
+	prepare(t)
+
+	if err := os.MkdirAll(testOutputDir, 0700); err != nil {
+		t.Fatalf("failed to create directory %s: %v", testOutputDir, err)
+	}
+
+	a, err := NewA(testPlainPublishPathSucc)
+	if err != nil {
+		t.Fatalf("%v\n", err)
+	}
+	defer a.Free()
+
+	sliceFile := fmt.Sprintf("%s/slice", testOutputDir)
+	demands := []types.Range{{Start: 1, Count: 2}, {Start: 5, Count: 3}}
+	if err := a.SigmaSlice(demands, sliceFile); err != nil {
+		t.Fatalf("%v\n", err)
+	}
+
+	b, err := NewBFromSlice(testPlainBulletinSucc, sliceFile)
+	if err != nil {
+		t.Fatalf("%v\n", err)
+	}
+	if err := b.Free(); err != nil {
+		t.Errorf("%v\n", err)
+	}
+
+	if err := a.SigmaSlice(nil, sliceFile); err == nil {
+		t.Errorf("SigmaSlice() without demands should fail\n")
+	}
+
+	overlapped := []types.Range{{Start: 1, Count: 2}, {Start: 2, Count: 3}}
+	if err := a.SigmaSlice(overlapped, sliceFile); err == nil {
+		t.Errorf("SigmaSlice(%v) should fail\n", overlapped)
+	}
+
+	// the slice ends with the path, a flipped node must not verify
+	slice, err := os.ReadFile(sliceFile)
+	if err != nil {
+		t.Fatalf("%v\n", err)
+	}
+	slice[len(slice)-1] ^= 1
+	badSliceFile := fmt.Sprintf("%s/bad_slice", testOutputDir)
+	if err := os.WriteFile(badSliceFile, slice, 0600); err != nil {
+		t.Fatalf("%v\n", err)
+	}
+	if _, err := NewBFromSlice(testPlainBulletinSucc, badSliceFile); err == nil {
+		t.Errorf("NewBFromSlice(%s) should fail\n", badSliceFile)
+	}
+
+	if _, err := NewBFromSlice(testPlainBulletinFail, sliceFile); err == nil {
+		t.Errorf("NewBFromSlice(%s, %s) should fail\n",
+			testPlainBulletinFail, sliceFile)
+	}
+}
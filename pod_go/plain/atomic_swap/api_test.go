@@ -1,8 +1,10 @@
 package atomic_swap
 
 import (
+	"bytes"
 	"fmt"
 	"os"
+	"sync"
 	"testing"
 
 	"github.com/sec-bit/zkPoD-lib/pod_go/setup"
@@ -339,3 +341,331 @@ func TestDecrypt(t *testing.T) {
 		t.Fatalf("%v\n", err)
 	}
 }
+
+// runFile runs the protocol through the file methods.
+func runFile(t *testing.T, dir, outFile string) {
+	requestFile := fmt.Sprintf("%s/request", dir)
+	responseFile := fmt.Sprintf("%s/response", dir)
+	receiptFile := fmt.Sprintf("%s/receipt", dir)
+	secretFile := fmt.Sprintf("%s/secret", dir)
+
+	buyer := prepareBobSession(t)
+	defer buyer.Free()
+	seller := prepareAliceSession(t)
+	defer seller.Free()
+
+	if err := buyer.GetRequest(requestFile); err != nil {
+		t.Fatalf("%v\n", err)
+	}
+
+	if err := seller.OnRequest(requestFile, responseFile); err != nil {
+		t.Fatalf("%v\n", err)
+	}
+
+	if err := buyer.OnResponse(responseFile, receiptFile); err != nil {
+		t.Fatalf("%v\n", err)
+	}
+
+	if err := seller.OnReceipt(receiptFile, secretFile); err != nil {
+		t.Fatalf("%v\n", err)
+	}
+
+	if err := buyer.OnSecret(secretFile); err != nil {
+		t.Fatalf("%v\n", err)
+	}
+
+	if err := buyer.Decrypt(outFile); err != nil {
+		t.Fatalf("%v\n", err)
+	}
+}
+
+// runBuf runs the same protocol through the Buf methods, an empty receipt
+// must be rejected without breaking the session.
+func runBuf(t *testing.T, outFile string) {
+	buyer := prepareBobSession(t)
+	defer buyer.Free()
+	seller := prepareAliceSession(t)
+	defer seller.Free()
+
+	request, err := buyer.GetRequestBuf()
+	if err != nil {
+		t.Fatalf("%v\n", err)
+	}
+
+	response, err := seller.OnRequestBuf(request)
+	if err != nil {
+		t.Fatalf("%v\n", err)
+	}
+
+	receipt, err := buyer.OnResponseBuf(response)
+	if err != nil {
+		t.Fatalf("%v\n", err)
+	}
+
+	if _, err := seller.OnReceiptBuf(nil); err == nil {
+		t.Fatalf("should fail: empty receipt\n")
+	}
+
+	secret, err := seller.OnReceiptBuf(receipt)
+	if err != nil {
+		t.Fatalf("%v\n", err)
+	}
+
+	if err := buyer.OnSecretBuf(secret); err != nil {
+		t.Fatalf("%v\n", err)
+	}
+
+	if err := buyer.Decrypt(outFile); err != nil {
+		t.Fatalf("%v\n", err)
+	}
+}
+
+func TestBuf(t *testing.T) {
+	dir := fmt.Sprintf("%s/Buf", testOutputDir)
+	mkdir(t, dir)
+	fileOutFile := fmt.Sprintf("%s/file_output", dir)
+	bufOutFile := fmt.Sprintf("%s/buf_output", dir)
+
+	prepare(t)
+
+	runFile(t, dir, fileOutFile)
+	runBuf(t, bufOutFile)
+
+	fileOut, err := os.ReadFile(fileOutFile)
+	if err != nil {
+		t.Fatalf("%v\n", err)
+	}
+	bufOut, err := os.ReadFile(bufOutFile)
+	if err != nil {
+		t.Fatalf("%v\n", err)
+	}
+	if !bytes.Equal(fileOut, bufOut) {
+		t.Fatalf("%s and %s differ\n", fileOutFile, bufOutFile)
+	}
+}
+
+// progressLog records the progress of the calls run by one task
+type progressLog struct {
+	mutex     sync.Mutex
+	stages    []string
+	fractions []float64
+}
+
+func (l *progressLog) report(stage string, fraction float64) {
+	l.mutex.Lock()
+	defer l.mutex.Unlock()
+	l.stages = append(l.stages, stage)
+	l.fractions = append(l.fractions, fraction)
+}
+
+// check fails unless the progress of the last call never went back and
+// ended at ("done", 1.0), it then clears the log for the next call
+func (l *progressLog) check(t *testing.T, call string) {
+	l.mutex.Lock()
+	defer l.mutex.Unlock()
+
+	n := len(l.stages)
+	if n == 0 {
+		t.Fatalf("%s: no progress\n", call)
+	}
+	for i := 1; i < n; i++ {
+		if l.fractions[i] < l.fractions[i-1] {
+			t.Fatalf("%s: progress went back from %s %v to %s %v\n", call,
+				l.stages[i-1], l.fractions[i-1], l.stages[i], l.fractions[i])
+		}
+	}
+	if l.stages[n-1] != "done" || l.fractions[n-1] != 1.0 {
+		t.Fatalf("%s: progress ended at %s %v\n",
+			call, l.stages[n-1], l.fractions[n-1])
+	}
+	l.stages = nil
+	l.fractions = nil
+}
+
+func prepareTask(t *testing.T, log *progressLog) *types.Task {
+	task, err := types.NewTask(log.report)
+	if err != nil {
+		t.Fatalf("%v\n", err)
+	}
+	return task
+}
+
+func TestAsync(t *testing.T) {
+	dir := fmt.Sprintf("%s/Async", testOutputDir)
+	mkdir(t, dir)
+	requestFile := fmt.Sprintf("%s/request", dir)
+	responseFile := fmt.Sprintf("%s/response", dir)
+	receiptFile := fmt.Sprintf("%s/receipt", dir)
+	secretFile := fmt.Sprintf("%s/secret", dir)
+	outFile := fmt.Sprintf("%s/output", dir)
+
+	prepare(t)
+
+	buyer := prepareBobSession(t)
+	defer buyer.Free()
+	seller := prepareAliceSession(t)
+	defer seller.Free()
+
+	// one task runs the calls of both sides
+	var log progressLog
+	task := prepareTask(t, &log)
+	defer task.Free()
+
+	if err := task.SetConcurrency(2); err != nil {
+		t.Fatalf("%v\n", err)
+	}
+
+	if err := buyer.GetRequest(requestFile); err != nil {
+		t.Fatalf("%v\n", err)
+	}
+
+	if err := seller.OnRequestAsync(task, requestFile, responseFile); err != nil {
+		t.Fatalf("%v\n", err)
+	}
+	log.check(t, "OnRequestAsync")
+
+	if err := buyer.OnResponseAsync(task, responseFile, receiptFile); err != nil {
+		t.Fatalf("%v\n", err)
+	}
+	log.check(t, "OnResponseAsync")
+
+	if err := seller.OnReceipt(receiptFile, secretFile); err != nil {
+		t.Fatalf("%v\n", err)
+	}
+
+	if err := buyer.OnSecret(secretFile); err != nil {
+		t.Fatalf("%v\n", err)
+	}
+
+	if err := buyer.Decrypt(outFile); err != nil {
+		t.Fatalf("%v\n", err)
+	}
+}
+
+func TestBufAsync(t *testing.T) {
+	prepare(t)
+
+	buyer := prepareBobSession(t)
+	defer buyer.Free()
+	seller := prepareAliceSession(t)
+	defer seller.Free()
+
+	var log progressLog
+	task := prepareTask(t, &log)
+	defer task.Free()
+
+	request, err := buyer.GetRequestBuf()
+	if err != nil {
+		t.Fatalf("%v\n", err)
+	}
+
+	response, err := seller.OnRequestBufAsync(task, request)
+	if err != nil {
+		t.Fatalf("%v\n", err)
+	}
+	log.check(t, "OnRequestBufAsync")
+
+	receipt, err := buyer.OnResponseBufAsync(task, response)
+	if err != nil {
+		t.Fatalf("%v\n", err)
+	}
+	log.check(t, "OnResponseBufAsync")
+
+	secret, err := seller.OnReceiptBuf(receipt)
+	if err != nil {
+		t.Fatalf("%v\n", err)
+	}
+
+	if err := buyer.OnSecretBuf(secret); err != nil {
+		t.Fatalf("%v\n", err)
+	}
+}
+
+// a failed call must not leave its result for the next call of the task
+func TestAsyncReuse(t *testing.T) {
+	dir := fmt.Sprintf("%s/AsyncReuse", testOutputDir)
+	mkdir(t, dir)
+	requestFile := fmt.Sprintf("%s/request", dir)
+	responseFile := fmt.Sprintf("%s/response", dir)
+
+	prepare(t)
+
+	buyer := prepareBobSession(t)
+	defer buyer.Free()
+	seller := prepareAliceSession(t)
+	defer seller.Free()
+
+	var log progressLog
+	task := prepareTask(t, &log)
+	defer task.Free()
+
+	if err := buyer.GetRequest(requestFile); err != nil {
+		t.Fatalf("%v\n", err)
+	}
+
+	// not a request
+	if err := seller.OnRequestAsync(
+		task, testIncorrectSecret, responseFile,
+	); err == nil {
+		t.Fatalf("should fail: invalid request %s\n", testIncorrectSecret)
+	}
+
+	if err := seller.OnRequestAsync(task, requestFile, responseFile); err != nil {
+		t.Fatalf("%v\n", err)
+	}
+
+	if _, err := buyer.OnResponseBufAsync(task, nil); err == nil {
+		t.Fatalf("should fail: empty response\n")
+	}
+}
+
+func TestAsyncCancel(t *testing.T) {
+	dir := fmt.Sprintf("%s/AsyncCancel", testOutputDir)
+	mkdir(t, dir)
+	requestFile := fmt.Sprintf("%s/request", dir)
+	responseFile := fmt.Sprintf("%s/response", dir)
+
+	prepare(t)
+
+	buyer := prepareBobSession(t)
+	defer buyer.Free()
+	seller := prepareAliceSession(t)
+	defer seller.Free()
+
+	if err := buyer.GetRequest(requestFile); err != nil {
+		t.Fatalf("%v\n", err)
+	}
+
+	// the first report holds the call until the test has cancelled it
+	started := make(chan struct{})
+	cancelled := make(chan struct{})
+	var once sync.Once
+	task, err := types.NewTask(func(stage string, fraction float64) {
+		once.Do(func() {
+			close(started)
+			<-cancelled
+		})
+	})
+	if err != nil {
+		t.Fatalf("%v\n", err)
+	}
+
+	result := make(chan error, 1)
+	go func() {
+		result <- seller.OnRequestAsync(task, requestFile, responseFile)
+	}()
+
+	<-started
+	if err := task.Cancel(); err != nil {
+		t.Fatalf("%v\n", err)
+	}
+	close(cancelled)
+
+	if err := <-result; err == nil {
+		t.Fatalf("should fail: the task was cancelled\n")
+	}
+
+	if err := task.Free(); err != nil {
+		t.Fatalf("%v\n", err)
+	}
+}
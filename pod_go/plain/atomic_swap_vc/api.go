@@ -99,6 +99,85 @@ func (session *AliceSession) OnRequest(requestFile, responseFile string) error {
 	return nil
 }
 
+// OnRequestAsync provides the Go interface for E_PlainAtomicSwapVcAliceOnRequestAsync(),
+// it waits for the done callback of task.
+func (session *AliceSession) OnRequestAsync(
+	task *types.Task, requestFile, responseFile string,
+) error {
+	if err := utils.CheckRegularFileReadPerm(requestFile); err != nil {
+		return err
+	}
+	if err := utils.CheckDirOfPathExistence(requestFile); err != nil {
+		return err
+	}
+
+	handle := C.handle_t(session.handle)
+
+	requestFileCStr := C.CString(requestFile)
+	defer C.free(unsafe.Pointer(requestFileCStr))
+
+	responseFileCStr := C.CString(responseFile)
+	defer C.free(unsafe.Pointer(responseFileCStr))
+
+	ret := bool(C.E_PlainAtomicSwapVcAliceOnRequestAsync(
+		handle, requestFileCStr, responseFileCStr,
+		C.handle_t(task.Handle()))) && task.Wait()
+	if !ret {
+		return fmt.Errorf(
+			"E_PlainAtomicSwapVcAliceOnRequestAsync(%v, %s, %s) failed",
+			handle, requestFile, responseFile)
+	}
+
+	return nil
+}
+
+// OnRequestBuf provides the Go interface for E_PlainAtomicSwapVcAliceOnRequestBuf(),
+// the response is written straight into Go memory.
+func (session *AliceSession) OnRequestBuf(request []byte) ([]byte, error) {
+	handle := C.handle_t(session.handle)
+
+	requestBuf := types.NewInBuffer(request)
+	defer requestBuf.Free()
+
+	responseBuf := types.NewOutBuffer()
+	defer responseBuf.Free()
+
+	ret := bool(C.E_PlainAtomicSwapVcAliceOnRequestBuf(
+		handle, (*C.buffer_t)(requestBuf.CBuffer()),
+		(*C.buffer_t)(responseBuf.CBuffer()),
+		C.alloc_t(types.CAlloc()), responseBuf.CAllocCtx()))
+	if !ret {
+		return nil, fmt.Errorf("E_PlainAtomicSwapVcAliceOnRequestBuf(%v) failed", handle)
+	}
+
+	return responseBuf.Bytes(), nil
+}
+
+// OnRequestBufAsync provides the Go interface for E_PlainAtomicSwapVcAliceOnRequestBufAsync(),
+// it waits for the done callback of task.
+func (session *AliceSession) OnRequestBufAsync(
+	task *types.Task, request []byte,
+) ([]byte, error) {
+	handle := C.handle_t(session.handle)
+
+	requestBuf := types.NewInBuffer(request)
+	defer requestBuf.Free()
+
+	responseBuf := types.NewOutBuffer()
+	defer responseBuf.Free()
+
+	ret := bool(C.E_PlainAtomicSwapVcAliceOnRequestBufAsync(
+		handle, (*C.buffer_t)(requestBuf.CBuffer()),
+		(*C.buffer_t)(responseBuf.CBuffer()),
+		C.alloc_t(types.CAlloc()), responseBuf.CAllocCtx(),
+		C.handle_t(task.Handle()))) && task.Wait()
+	if !ret {
+		return nil, fmt.Errorf("E_PlainAtomicSwapVcAliceOnRequestBufAsync(%v) failed", handle)
+	}
+
+	return responseBuf.Bytes(), nil
+}
+
 // OnReceipt provides the Go interface for E_PlainAtomicSwapVcAliceOnReceipt()
 func (session *AliceSession) OnReceipt(receiptFile, secretFile string) error {
 	if err := utils.CheckRegularFileReadPerm(receiptFile); err != nil {
@@ -127,6 +206,28 @@ func (session *AliceSession) OnReceipt(receiptFile, secretFile string) error {
 	return nil
 }
 
+// OnReceiptBuf provides the Go interface for E_PlainAtomicSwapVcAliceOnReceiptBuf(),
+// the secret is written straight into Go memory.
+func (session *AliceSession) OnReceiptBuf(receipt []byte) ([]byte, error) {
+	handle := C.handle_t(session.handle)
+
+	receiptBuf := types.NewInBuffer(receipt)
+	defer receiptBuf.Free()
+
+	secretBuf := types.NewOutBuffer()
+	defer secretBuf.Free()
+
+	ret := bool(C.E_PlainAtomicSwapVcAliceOnReceiptBuf(
+		handle, (*C.buffer_t)(receiptBuf.CBuffer()),
+		(*C.buffer_t)(secretBuf.CBuffer()),
+		C.alloc_t(types.CAlloc()), secretBuf.CAllocCtx()))
+	if !ret {
+		return nil, fmt.Errorf("E_PlainAtomicSwapVcAliceOnReceiptBuf(%v) failed", handle)
+	}
+
+	return secretBuf.Bytes(), nil
+}
+
 // NewBobSession provides the Go interface for E_PlainAtomicSwapVcBobNew()
 func NewBobSession(
 	bulletinFile, publicPath string,
@@ -180,6 +281,19 @@ func (session *BobSession) Free() error {
 	return session.b.Free()
 }
 
+// SetG1Uncompressed provides the Go interface for
+// E_PlainAtomicSwapVcBobSetG1Uncompressed(), call it before GetRequest.
+func (session *BobSession) SetG1Uncompressed(uncompressed bool) error {
+	handle := C.handle_t(session.handle)
+	if ret := bool(
+		C.E_PlainAtomicSwapVcBobSetG1Uncompressed(handle, C.bool(uncompressed))); !ret {
+		return fmt.Errorf("E_PlainAtomicSwapVcBobSetG1Uncompressed(%v, %v) failed",
+			handle, uncompressed)
+	}
+
+	return nil
+}
+
 // GetRequest provides the Go interface for E_PlainAtomicSwapVcBobGetRequest()
 func (session *BobSession) GetRequest(requestFile string) error {
 	if err := utils.CheckDirOfPathExistence(requestFile); err != nil {
@@ -200,6 +314,24 @@ func (session *BobSession) GetRequest(requestFile string) error {
 	return nil
 }
 
+// GetRequestBuf provides the Go interface for E_PlainAtomicSwapVcBobGetRequestBuf(),
+// the request is written straight into Go memory.
+func (session *BobSession) GetRequestBuf() ([]byte, error) {
+	handle := C.handle_t(session.handle)
+
+	requestBuf := types.NewOutBuffer()
+	defer requestBuf.Free()
+
+	ret := bool(C.E_PlainAtomicSwapVcBobGetRequestBuf(
+		handle, (*C.buffer_t)(requestBuf.CBuffer()),
+		C.alloc_t(types.CAlloc()), requestBuf.CAllocCtx()))
+	if !ret {
+		return nil, fmt.Errorf("E_PlainAtomicSwapVcBobGetRequestBuf(%v) failed", handle)
+	}
+
+	return requestBuf.Bytes(), nil
+}
+
 // OnResponse provides the Go interface for E_PlainAtomicSwapVcBobOnResponse()
 func (session *BobSession) OnResponse(responseFile, receiptFile string) error {
 	if err := utils.CheckRegularFileReadPerm(responseFile); err != nil {
@@ -228,6 +360,85 @@ func (session *BobSession) OnResponse(responseFile, receiptFile string) error {
 	return nil
 }
 
+// OnResponseAsync provides the Go interface for E_PlainAtomicSwapVcBobOnResponseAsync(),
+// it waits for the done callback of task.
+func (session *BobSession) OnResponseAsync(
+	task *types.Task, responseFile, receiptFile string,
+) error {
+	if err := utils.CheckRegularFileReadPerm(responseFile); err != nil {
+		return err
+	}
+	if err := utils.CheckDirOfPathExistence(receiptFile); err != nil {
+		return err
+	}
+
+	handle := C.handle_t(session.handle)
+
+	responseFileCStr := C.CString(responseFile)
+	defer C.free(unsafe.Pointer(responseFileCStr))
+
+	receiptFileCStr := C.CString(receiptFile)
+	defer C.free(unsafe.Pointer(receiptFileCStr))
+
+	ret := bool(C.E_PlainAtomicSwapVcBobOnResponseAsync(
+		handle, responseFileCStr, receiptFileCStr,
+		C.handle_t(task.Handle()))) && task.Wait()
+	if !ret {
+		return fmt.Errorf(
+			"E_PlainAtomicSwapVcBobOnResponseAsync(%v, %s, %s) failed",
+			handle, responseFile, receiptFile)
+	}
+
+	return nil
+}
+
+// OnResponseBuf provides the Go interface for E_PlainAtomicSwapVcBobOnResponseBuf(),
+// the receipt is written straight into Go memory.
+func (session *BobSession) OnResponseBuf(response []byte) ([]byte, error) {
+	handle := C.handle_t(session.handle)
+
+	responseBuf := types.NewInBuffer(response)
+	defer responseBuf.Free()
+
+	receiptBuf := types.NewOutBuffer()
+	defer receiptBuf.Free()
+
+	ret := bool(C.E_PlainAtomicSwapVcBobOnResponseBuf(
+		handle, (*C.buffer_t)(responseBuf.CBuffer()),
+		(*C.buffer_t)(receiptBuf.CBuffer()),
+		C.alloc_t(types.CAlloc()), receiptBuf.CAllocCtx()))
+	if !ret {
+		return nil, fmt.Errorf("E_PlainAtomicSwapVcBobOnResponseBuf(%v) failed", handle)
+	}
+
+	return receiptBuf.Bytes(), nil
+}
+
+// OnResponseBufAsync provides the Go interface for E_PlainAtomicSwapVcBobOnResponseBufAsync(),
+// it waits for the done callback of task.
+func (session *BobSession) OnResponseBufAsync(
+	task *types.Task, response []byte,
+) ([]byte, error) {
+	handle := C.handle_t(session.handle)
+
+	responseBuf := types.NewInBuffer(response)
+	defer responseBuf.Free()
+
+	receiptBuf := types.NewOutBuffer()
+	defer receiptBuf.Free()
+
+	ret := bool(C.E_PlainAtomicSwapVcBobOnResponseBufAsync(
+		handle, (*C.buffer_t)(responseBuf.CBuffer()),
+		(*C.buffer_t)(receiptBuf.CBuffer()),
+		C.alloc_t(types.CAlloc()), receiptBuf.CAllocCtx(),
+		C.handle_t(task.Handle()))) && task.Wait()
+	if !ret {
+		return nil, fmt.Errorf("E_PlainAtomicSwapVcBobOnResponseBufAsync(%v) failed", handle)
+	}
+
+	return receiptBuf.Bytes(), nil
+}
+
 // OnSecret provides the Go interface for E_PlainAtomicSwapVcBobOnSecret()
 func (session *BobSession) OnSecret(secretFile string) error {
 	if err := utils.CheckRegularFileReadPerm(secretFile); err != nil {
@@ -249,6 +460,22 @@ func (session *BobSession) OnSecret(secretFile string) error {
 	return nil
 }
 
+// OnSecretBuf provides the Go interface for E_PlainAtomicSwapVcBobOnSecretBuf()
+func (session *BobSession) OnSecretBuf(secret []byte) error {
+	handle := C.handle_t(session.handle)
+
+	secretBuf := types.NewInBuffer(secret)
+	defer secretBuf.Free()
+
+	ret := bool(C.E_PlainAtomicSwapVcBobOnSecretBuf(
+		handle, (*C.buffer_t)(secretBuf.CBuffer())))
+	if !ret {
+		return fmt.Errorf("E_PlainAtomicSwapVcBobOnSecretBuf(%v) failed", handle)
+	}
+
+	return nil
+}
+
 // Decrypt provides the Go interface for E_PlainAtomicSwapVcBobSaveDecrypted()
 func (session *BobSession) Decrypt(outFile string) error {
 	if err := utils.CheckDirOfPathExistence(outFile); err != nil {
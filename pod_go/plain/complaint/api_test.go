@@ -1,6 +1,7 @@
 package complaint
 
 import (
+	"bytes"
 	"fmt"
 	"os"
 	"testing"
@@ -378,3 +379,105 @@ func TestGenerateClaim(t *testing.T) {
 		t.Fatal(err)
 	}
 }
+
+// runFile runs the protocol through the file methods.
+func runFile(t *testing.T, dir, outFile string) {
+	requestFile := fmt.Sprintf("%s/request", dir)
+	responseFile := fmt.Sprintf("%s/response", dir)
+	receiptFile := fmt.Sprintf("%s/receipt", dir)
+	secretFile := fmt.Sprintf("%s/secret", dir)
+
+	buyer := prepareBobSession(t)
+	defer buyer.Free()
+	seller := prepareAliceSession(t)
+	defer seller.Free()
+
+	if err := buyer.GetRequest(requestFile); err != nil {
+		t.Fatalf("%v\n", err)
+	}
+
+	if err := seller.OnRequest(requestFile, responseFile); err != nil {
+		t.Fatalf("%v\n", err)
+	}
+
+	if err := buyer.OnResponse(responseFile, receiptFile); err != nil {
+		t.Fatalf("%v\n", err)
+	}
+
+	if err := seller.OnReceipt(receiptFile, secretFile); err != nil {
+		t.Fatalf("%v\n", err)
+	}
+
+	if err := buyer.OnSecret(secretFile); err != nil {
+		t.Fatalf("%v\n", err)
+	}
+
+	if err := buyer.Decrypt(outFile); err != nil {
+		t.Fatalf("%v\n", err)
+	}
+}
+
+// runBuf runs the same protocol through the Buf methods, an empty receipt
+// must be rejected without breaking the session.
+func runBuf(t *testing.T, outFile string) {
+	buyer := prepareBobSession(t)
+	defer buyer.Free()
+	seller := prepareAliceSession(t)
+	defer seller.Free()
+
+	request, err := buyer.GetRequestBuf()
+	if err != nil {
+		t.Fatalf("%v\n", err)
+	}
+
+	response, err := seller.OnRequestBuf(request)
+	if err != nil {
+		t.Fatalf("%v\n", err)
+	}
+
+	receipt, err := buyer.OnResponseBuf(response)
+	if err != nil {
+		t.Fatalf("%v\n", err)
+	}
+
+	if _, err := seller.OnReceiptBuf(nil); err == nil {
+		t.Fatalf("should fail: empty receipt\n")
+	}
+
+	secret, err := seller.OnReceiptBuf(receipt)
+	if err != nil {
+		t.Fatalf("%v\n", err)
+	}
+
+	if err := buyer.OnSecretBuf(secret); err != nil {
+		t.Fatalf("%v\n", err)
+	}
+
+	if err := buyer.Decrypt(outFile); err != nil {
+		t.Fatalf("%v\n", err)
+	}
+}
+
+func TestBuf(t *testing.T) {
+	dir := fmt.Sprintf("%s/Buf", testOutputDir)
+	mkdir(t, dir)
+	fileOutFile := fmt.Sprintf("%s/file_output", dir)
+	bufOutFile := fmt.Sprintf("%s/buf_output", dir)
+
+	prepare(t)
+
+	runFile(t, dir, fileOutFile)
+	runBuf(t, bufOutFile)
+
+	fileOut, err := os.ReadFile(fileOutFile)
+	if err != nil {
+		t.Fatalf("%v\n", err)
+	}
+	bufOut, err := os.ReadFile(bufOutFile)
+	if err != nil {
+		t.Fatalf("%v\n", err)
+	}
+	if !bytes.Equal(fileOut, bufOut) {
+		t.Fatalf("%s and %s differ\n", fileOutFile, bufOutFile)
+	}
+}
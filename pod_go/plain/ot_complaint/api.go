@@ -91,6 +91,24 @@ func (session *AliceSession) GetNegoRequest(requestFile string) error {
 	return nil
 }
 
+// GetNegoRequestBuf provides the Go interface for E_PlainOtComplaintAliceGetNegoRequestBuf(),
+// the request is written straight into Go memory.
+func (session *AliceSession) GetNegoRequestBuf() ([]byte, error) {
+	handle := C.handle_t(session.handle)
+
+	requestBuf := types.NewOutBuffer()
+	defer requestBuf.Free()
+
+	ret := bool(C.E_PlainOtComplaintAliceGetNegoRequestBuf(
+		handle, (*C.buffer_t)(requestBuf.CBuffer()),
+		C.alloc_t(types.CAlloc()), requestBuf.CAllocCtx()))
+	if !ret {
+		return nil, fmt.Errorf("E_PlainOtComplaintAliceGetNegoRequestBuf(%v) failed", handle)
+	}
+
+	return requestBuf.Bytes(), nil
+}
+
 // OnNegoRequest provides the Go interface for E_PlainOtComplaintAliceOnNegoRequest()
 func (session *AliceSession) OnNegoRequest(requestFile, responseFile string) error {
 	if err := utils.CheckRegularFileReadPerm(requestFile); err != nil {
@@ -118,6 +136,28 @@ func (session *AliceSession) OnNegoRequest(requestFile, responseFile string) err
 	return nil
 }
 
+// OnNegoRequestBuf provides the Go interface for E_PlainOtComplaintAliceOnNegoRequestBuf(),
+// the response is written straight into Go memory.
+func (session *AliceSession) OnNegoRequestBuf(request []byte) ([]byte, error) {
+	handle := C.handle_t(session.handle)
+
+	requestBuf := types.NewInBuffer(request)
+	defer requestBuf.Free()
+
+	responseBuf := types.NewOutBuffer()
+	defer responseBuf.Free()
+
+	ret := bool(C.E_PlainOtComplaintAliceOnNegoRequestBuf(
+		handle, (*C.buffer_t)(requestBuf.CBuffer()),
+		(*C.buffer_t)(responseBuf.CBuffer()),
+		C.alloc_t(types.CAlloc()), responseBuf.CAllocCtx()))
+	if !ret {
+		return nil, fmt.Errorf("E_PlainOtComplaintAliceOnNegoRequestBuf(%v) failed", handle)
+	}
+
+	return responseBuf.Bytes(), nil
+}
+
 // OnNegoResponse provides the Go interface for E_PlainOtComplaintAliceOnNegoResponse()
 func (session *AliceSession) OnNegoResponse(responseFile string) error {
 	if err := utils.CheckRegularFileReadPerm(responseFile); err != nil {
@@ -139,6 +179,22 @@ func (session *AliceSession) OnNegoResponse(responseFile string) error {
 	return nil
 }
 
+// OnNegoResponseBuf provides the Go interface for E_PlainOtComplaintAliceOnNegoResponseBuf()
+func (session *AliceSession) OnNegoResponseBuf(response []byte) error {
+	handle := C.handle_t(session.handle)
+
+	responseBuf := types.NewInBuffer(response)
+	defer responseBuf.Free()
+
+	ret := bool(C.E_PlainOtComplaintAliceOnNegoResponseBuf(
+		handle, (*C.buffer_t)(responseBuf.CBuffer())))
+	if !ret {
+		return fmt.Errorf("E_PlainOtComplaintAliceOnNegoResponseBuf(%v) failed", handle)
+	}
+
+	return nil
+}
+
 // OnRequest provides the Go interface for E_PlainOtComplaintAliceOnRequest().
 func (session *AliceSession) OnRequest(requestFile, responseFile string) error {
 	if err := utils.CheckRegularFileReadPerm(requestFile); err != nil {
@@ -167,6 +223,85 @@ func (session *AliceSession) OnRequest(requestFile, responseFile string) error {
 	return nil
 }
 
+// OnRequestAsync provides the Go interface for E_PlainOtComplaintAliceOnRequestAsync(),
+// it waits for the done callback of task.
+func (session *AliceSession) OnRequestAsync(
+	task *types.Task, requestFile, responseFile string,
+) error {
+	if err := utils.CheckRegularFileReadPerm(requestFile); err != nil {
+		return err
+	}
+	if err := utils.CheckDirOfPathExistence(responseFile); err != nil {
+		return err
+	}
+
+	handle := C.handle_t(session.handle)
+
+	requestFileCStr := C.CString(requestFile)
+	defer C.free(unsafe.Pointer(requestFileCStr))
+
+	responseFileCStr := C.CString(responseFile)
+	defer C.free(unsafe.Pointer(responseFileCStr))
+
+	ret := bool(C.E_PlainOtComplaintAliceOnRequestAsync(
+		handle, requestFileCStr, responseFileCStr,
+		C.handle_t(task.Handle()))) && task.Wait()
+	if !ret {
+		return fmt.Errorf(
+			"E_PlainOtComplaintAliceOnRequestAsync(%v, %s, %s) failed",
+			handle, requestFile, responseFile)
+	}
+
+	return nil
+}
+
+// OnRequestBuf provides the Go interface for E_PlainOtComplaintAliceOnRequestBuf(),
+// the response is written straight into Go memory.
+func (session *AliceSession) OnRequestBuf(request []byte) ([]byte, error) {
+	handle := C.handle_t(session.handle)
+
+	requestBuf := types.NewInBuffer(request)
+	defer requestBuf.Free()
+
+	responseBuf := types.NewOutBuffer()
+	defer responseBuf.Free()
+
+	ret := bool(C.E_PlainOtComplaintAliceOnRequestBuf(
+		handle, (*C.buffer_t)(requestBuf.CBuffer()),
+		(*C.buffer_t)(responseBuf.CBuffer()),
+		C.alloc_t(types.CAlloc()), responseBuf.CAllocCtx()))
+	if !ret {
+		return nil, fmt.Errorf("E_PlainOtComplaintAliceOnRequestBuf(%v) failed", handle)
+	}
+
+	return responseBuf.Bytes(), nil
+}
+
+// OnRequestBufAsync provides the Go interface for E_PlainOtComplaintAliceOnRequestBufAsync(),
+// it waits for the done callback of task.
+func (session *AliceSession) OnRequestBufAsync(
+	task *types.Task, request []byte,
+) ([]byte, error) {
+	handle := C.handle_t(session.handle)
+
+	requestBuf := types.NewInBuffer(request)
+	defer requestBuf.Free()
+
+	responseBuf := types.NewOutBuffer()
+	defer responseBuf.Free()
+
+	ret := bool(C.E_PlainOtComplaintAliceOnRequestBufAsync(
+		handle, (*C.buffer_t)(requestBuf.CBuffer()),
+		(*C.buffer_t)(responseBuf.CBuffer()),
+		C.alloc_t(types.CAlloc()), responseBuf.CAllocCtx(),
+		C.handle_t(task.Handle()))) && task.Wait()
+	if !ret {
+		return nil, fmt.Errorf("E_PlainOtComplaintAliceOnRequestBufAsync(%v) failed", handle)
+	}
+
+	return responseBuf.Bytes(), nil
+}
+
 // OnReceipt provides the Go interface for E_PlainOtComplaintAliceOnReceipt()
 func (session *AliceSession) OnReceipt(receiptFile, secretFile string) error {
 	if err := utils.CheckRegularFileReadPerm(receiptFile); err != nil {
@@ -195,6 +330,28 @@ func (session *AliceSession) OnReceipt(receiptFile, secretFile string) error {
 	return nil
 }
 
+// OnReceiptBuf provides the Go interface for E_PlainOtComplaintAliceOnReceiptBuf(),
+// the secret is written straight into Go memory.
+func (session *AliceSession) OnReceiptBuf(receipt []byte) ([]byte, error) {
+	handle := C.handle_t(session.handle)
+
+	receiptBuf := types.NewInBuffer(receipt)
+	defer receiptBuf.Free()
+
+	secretBuf := types.NewOutBuffer()
+	defer secretBuf.Free()
+
+	ret := bool(C.E_PlainOtComplaintAliceOnReceiptBuf(
+		handle, (*C.buffer_t)(receiptBuf.CBuffer()),
+		(*C.buffer_t)(secretBuf.CBuffer()),
+		C.alloc_t(types.CAlloc()), secretBuf.CAllocCtx()))
+	if !ret {
+		return nil, fmt.Errorf("E_PlainOtComplaintAliceOnReceiptBuf(%v) failed", handle)
+	}
+
+	return secretBuf.Bytes(), nil
+}
+
 // NewBobSession provides the Go interface for E_PlainOtComplaintBobNew()
 func NewBobSession(
 	bulletinFile, publicPath string,
@@ -279,6 +436,24 @@ func (session *BobSession) GetNegoRequest(requestFile string) error {
 	return nil
 }
 
+// GetNegoRequestBuf provides the Go interface for E_PlainOtComplaintBobGetNegoRequestBuf(),
+// the request is written straight into Go memory.
+func (session *BobSession) GetNegoRequestBuf() ([]byte, error) {
+	handle := C.handle_t(session.handle)
+
+	requestBuf := types.NewOutBuffer()
+	defer requestBuf.Free()
+
+	ret := bool(C.E_PlainOtComplaintBobGetNegoRequestBuf(
+		handle, (*C.buffer_t)(requestBuf.CBuffer()),
+		C.alloc_t(types.CAlloc()), requestBuf.CAllocCtx()))
+	if !ret {
+		return nil, fmt.Errorf("E_PlainOtComplaintBobGetNegoRequestBuf(%v) failed", handle)
+	}
+
+	return requestBuf.Bytes(), nil
+}
+
 // OnNegoResponse provides the Go interface for E_PlainOtComplaintBobOnNegoResponse()
 func (session *BobSession) OnNegoResponse(responseFile string) error {
 	if err := utils.CheckRegularFileReadPerm(responseFile); err != nil {
@@ -300,6 +475,22 @@ func (session *BobSession) OnNegoResponse(responseFile string) error {
 	return nil
 }
 
+// OnNegoResponseBuf provides the Go interface for E_PlainOtComplaintBobOnNegoResponseBuf()
+func (session *BobSession) OnNegoResponseBuf(response []byte) error {
+	handle := C.handle_t(session.handle)
+
+	responseBuf := types.NewInBuffer(response)
+	defer responseBuf.Free()
+
+	ret := bool(C.E_PlainOtComplaintBobOnNegoResponseBuf(
+		handle, (*C.buffer_t)(responseBuf.CBuffer())))
+	if !ret {
+		return fmt.Errorf("E_PlainOtComplaintBobOnNegoResponseBuf(%v) failed", handle)
+	}
+
+	return nil
+}
+
 // OnNegoRequest provides the Go interface for E_PlainOtComplaintBobOnNegoRequest()
 func (session *BobSession) OnNegoRequest(requestFile, responseFile string) error {
 	if err := utils.CheckRegularFileReadPerm(requestFile); err != nil {
@@ -327,6 +518,41 @@ func (session *BobSession) OnNegoRequest(requestFile, responseFile string) error
 	return nil
 }
 
+// OnNegoRequestBuf provides the Go interface for E_PlainOtComplaintBobOnNegoRequestBuf(),
+// the response is written straight into Go memory.
+func (session *BobSession) OnNegoRequestBuf(request []byte) ([]byte, error) {
+	handle := C.handle_t(session.handle)
+
+	requestBuf := types.NewInBuffer(request)
+	defer requestBuf.Free()
+
+	responseBuf := types.NewOutBuffer()
+	defer responseBuf.Free()
+
+	ret := bool(C.E_PlainOtComplaintBobOnNegoRequestBuf(
+		handle, (*C.buffer_t)(requestBuf.CBuffer()),
+		(*C.buffer_t)(responseBuf.CBuffer()),
+		C.alloc_t(types.CAlloc()), responseBuf.CAllocCtx()))
+	if !ret {
+		return nil, fmt.Errorf("E_PlainOtComplaintBobOnNegoRequestBuf(%v) failed", handle)
+	}
+
+	return responseBuf.Bytes(), nil
+}
+
+// SetG1Uncompressed provides the Go interface for
+// E_PlainOtComplaintBobSetG1Uncompressed(), call it before GetRequest.
+func (session *BobSession) SetG1Uncompressed(uncompressed bool) error {
+	handle := C.handle_t(session.handle)
+	if ret := bool(
+		C.E_PlainOtComplaintBobSetG1Uncompressed(handle, C.bool(uncompressed))); !ret {
+		return fmt.Errorf("E_PlainOtComplaintBobSetG1Uncompressed(%v, %v) failed",
+			handle, uncompressed)
+	}
+
+	return nil
+}
+
 // GetRequest provides the Go interface for E_PlainOtComplaintBobGetRequest()
 func (session *BobSession) GetRequest(requestFile string) error {
 	if err := utils.CheckDirOfPathExistence(requestFile); err != nil {
@@ -347,6 +573,24 @@ func (session *BobSession) GetRequest(requestFile string) error {
 	return nil
 }
 
+// GetRequestBuf provides the Go interface for E_PlainOtComplaintBobGetRequestBuf(),
+// the request is written straight into Go memory.
+func (session *BobSession) GetRequestBuf() ([]byte, error) {
+	handle := C.handle_t(session.handle)
+
+	requestBuf := types.NewOutBuffer()
+	defer requestBuf.Free()
+
+	ret := bool(C.E_PlainOtComplaintBobGetRequestBuf(
+		handle, (*C.buffer_t)(requestBuf.CBuffer()),
+		C.alloc_t(types.CAlloc()), requestBuf.CAllocCtx()))
+	if !ret {
+		return nil, fmt.Errorf("E_PlainOtComplaintBobGetRequestBuf(%v) failed", handle)
+	}
+
+	return requestBuf.Bytes(), nil
+}
+
 // OnResponse provides the Go interface for E_PlainOtComplaintBobOnResponse()
 func (session *BobSession) OnResponse(responseFile, receiptFile string) error {
 	if err := utils.CheckRegularFileReadPerm(responseFile); err != nil {
@@ -375,6 +619,85 @@ func (session *BobSession) OnResponse(responseFile, receiptFile string) error {
 	return nil
 }
 
+// OnResponseAsync provides the Go interface for E_PlainOtComplaintBobOnResponseAsync(),
+// it waits for the done callback of task.
+func (session *BobSession) OnResponseAsync(
+	task *types.Task, responseFile, receiptFile string,
+) error {
+	if err := utils.CheckRegularFileReadPerm(responseFile); err != nil {
+		return err
+	}
+	if err := utils.CheckDirOfPathExistence(receiptFile); err != nil {
+		return err
+	}
+
+	handle := C.handle_t(session.handle)
+
+	responseFileCStr := C.CString(responseFile)
+	defer C.free(unsafe.Pointer(responseFileCStr))
+
+	receiptFileCStr := C.CString(receiptFile)
+	defer C.free(unsafe.Pointer(receiptFileCStr))
+
+	ret := bool(C.E_PlainOtComplaintBobOnResponseAsync(
+		handle, responseFileCStr, receiptFileCStr,
+		C.handle_t(task.Handle()))) && task.Wait()
+	if !ret {
+		return fmt.Errorf(
+			"E_PlainOtComplaintBobOnResponseAsync(%v, %s, %s) failed",
+			handle, responseFile, receiptFile)
+	}
+
+	return nil
+}
+
+// OnResponseBuf provides the Go interface for E_PlainOtComplaintBobOnResponseBuf(),
+// the receipt is written straight into Go memory.
+func (session *BobSession) OnResponseBuf(response []byte) ([]byte, error) {
+	handle := C.handle_t(session.handle)
+
+	responseBuf := types.NewInBuffer(response)
+	defer responseBuf.Free()
+
+	receiptBuf := types.NewOutBuffer()
+	defer receiptBuf.Free()
+
+	ret := bool(C.E_PlainOtComplaintBobOnResponseBuf(
+		handle, (*C.buffer_t)(responseBuf.CBuffer()),
+		(*C.buffer_t)(receiptBuf.CBuffer()),
+		C.alloc_t(types.CAlloc()), receiptBuf.CAllocCtx()))
+	if !ret {
+		return nil, fmt.Errorf("E_PlainOtComplaintBobOnResponseBuf(%v) failed", handle)
+	}
+
+	return receiptBuf.Bytes(), nil
+}
+
+// OnResponseBufAsync provides the Go interface for E_PlainOtComplaintBobOnResponseBufAsync(),
+// it waits for the done callback of task.
+func (session *BobSession) OnResponseBufAsync(
+	task *types.Task, response []byte,
+) ([]byte, error) {
+	handle := C.handle_t(session.handle)
+
+	responseBuf := types.NewInBuffer(response)
+	defer responseBuf.Free()
+
+	receiptBuf := types.NewOutBuffer()
+	defer receiptBuf.Free()
+
+	ret := bool(C.E_PlainOtComplaintBobOnResponseBufAsync(
+		handle, (*C.buffer_t)(responseBuf.CBuffer()),
+		(*C.buffer_t)(receiptBuf.CBuffer()),
+		C.alloc_t(types.CAlloc()), receiptBuf.CAllocCtx(),
+		C.handle_t(task.Handle()))) && task.Wait()
+	if !ret {
+		return nil, fmt.Errorf("E_PlainOtComplaintBobOnResponseBufAsync(%v) failed", handle)
+	}
+
+	return receiptBuf.Bytes(), nil
+}
+
 // OnSecret provides the Go interface for E_PlainOtComplaintBobOnSecret()
 func (session *BobSession) OnSecret(secretFile string) error {
 	if err := utils.CheckRegularFileReadPerm(secretFile); err != nil {
@@ -396,6 +719,22 @@ func (session *BobSession) OnSecret(secretFile string) error {
 	return nil
 }
 
+// OnSecretBuf provides the Go interface for E_PlainOtComplaintBobOnSecretBuf()
+func (session *BobSession) OnSecretBuf(secret []byte) error {
+	handle := C.handle_t(session.handle)
+
+	secretBuf := types.NewInBuffer(secret)
+	defer secretBuf.Free()
+
+	ret := bool(C.E_PlainOtComplaintBobOnSecretBuf(
+		handle, (*C.buffer_t)(secretBuf.CBuffer())))
+	if !ret {
+		return fmt.Errorf("E_PlainOtComplaintBobOnSecretBuf(%v) failed", handle)
+	}
+
+	return nil
+}
+
 // Decrypt provides the Go interface for E_PlainOtComplaintBobSaveDecrypted()
 func (session *BobSession) Decrypt(outFile string) error {
 	if err := utils.CheckDirOfPathExistence(outFile); err != nil {
@@ -438,3 +777,21 @@ func (session *BobSession) GenerateClaim(claimFile string) error {
 
 	return nil
 }
+
+// GenerateClaimBuf provides the Go interface for E_PlainOtComplaintBobGenerateClaimBuf(),
+// the claim is written straight into Go memory.
+func (session *BobSession) GenerateClaimBuf() ([]byte, error) {
+	handle := C.handle_t(session.handle)
+
+	claimBuf := types.NewOutBuffer()
+	defer claimBuf.Free()
+
+	ret := bool(C.E_PlainOtComplaintBobGenerateClaimBuf(
+		handle, (*C.buffer_t)(claimBuf.CBuffer()),
+		C.alloc_t(types.CAlloc()), claimBuf.CAllocCtx()))
+	if !ret {
+		return nil, fmt.Errorf("E_PlainOtComplaintBobGenerateClaimBuf(%v) failed", handle)
+	}
+
+	return claimBuf.Bytes(), nil
+}
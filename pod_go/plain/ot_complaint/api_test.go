@@ -1,6 +1,7 @@
 package ot_complaint
 
 import (
+	"bytes"
 	"fmt"
 	"os"
 	"testing"
@@ -554,3 +555,134 @@ func TestGenerateClaim(t *testing.T) {
 		t.Fatal(err)
 	}
 }
+
+func prepareSessionsBuf(t *testing.T) (*AliceSession, *BobSession) {
+	seller := prepareAliceSession(t)
+	buyer := prepareBobSession(t)
+
+	buyerReq, err := buyer.GetNegoRequestBuf()
+	if err != nil {
+		t.Fatal(err)
+	}
+	sellerResp, err := seller.OnNegoRequestBuf(buyerReq)
+	if err != nil {
+		t.Fatal(err)
+	}
+	if err := buyer.OnNegoResponseBuf(sellerResp); err != nil {
+		t.Fatal(err)
+	}
+
+	sellerReq, err := seller.GetNegoRequestBuf()
+	if err != nil {
+		t.Fatal(err)
+	}
+	buyerResp, err := buyer.OnNegoRequestBuf(sellerReq)
+	if err != nil {
+		t.Fatal(err)
+	}
+	if err := seller.OnNegoResponseBuf(buyerResp); err != nil {
+		t.Fatal(err)
+	}
+
+	return seller, buyer
+}
+
+// runFile runs the protocol through the file methods.
+func runFile(t *testing.T, dir, outFile string) {
+	requestFile := fmt.Sprintf("%s/request", dir)
+	responseFile := fmt.Sprintf("%s/response", dir)
+	receiptFile := fmt.Sprintf("%s/receipt", dir)
+	secretFile := fmt.Sprintf("%s/secret", dir)
+
+	seller, buyer := prepareSessions(t, dir)
+	defer buyer.Free()
+	defer seller.Free()
+
+	if err := buyer.GetRequest(requestFile); err != nil {
+		t.Fatalf("%v\n", err)
+	}
+
+	if err := seller.OnRequest(requestFile, responseFile); err != nil {
+		t.Fatalf("%v\n", err)
+	}
+
+	if err := buyer.OnResponse(responseFile, receiptFile); err != nil {
+		t.Fatalf("%v\n", err)
+	}
+
+	if err := seller.OnReceipt(receiptFile, secretFile); err != nil {
+		t.Fatalf("%v\n", err)
+	}
+
+	if err := buyer.OnSecret(secretFile); err != nil {
+		t.Fatalf("%v\n", err)
+	}
+
+	if err := buyer.Decrypt(outFile); err != nil {
+		t.Fatalf("%v\n", err)
+	}
+}
+
+// runBuf runs the same protocol through the Buf methods, an empty receipt
+// must be rejected without breaking the session.
+func runBuf(t *testing.T, outFile string) {
+	seller, buyer := prepareSessionsBuf(t)
+	defer buyer.Free()
+	defer seller.Free()
+
+	request, err := buyer.GetRequestBuf()
+	if err != nil {
+		t.Fatalf("%v\n", err)
+	}
+
+	response, err := seller.OnRequestBuf(request)
+	if err != nil {
+		t.Fatalf("%v\n", err)
+	}
+
+	receipt, err := buyer.OnResponseBuf(response)
+	if err != nil {
+		t.Fatalf("%v\n", err)
+	}
+
+	if _, err := seller.OnReceiptBuf(nil); err == nil {
+		t.Fatalf("should fail: empty receipt\n")
+	}
+
+	secret, err := seller.OnReceiptBuf(receipt)
+	if err != nil {
+		t.Fatalf("%v\n", err)
+	}
+
+	if err := buyer.OnSecretBuf(secret); err != nil {
+		t.Fatalf("%v\n", err)
+	}
+
+	if err := buyer.Decrypt(outFile); err != nil {
+		t.Fatalf("%v\n", err)
+	}
+}
+
+func TestBuf(t *testing.T) {
+	dir := fmt.Sprintf("%s/Buf", testOutputDir)
+	mkdir(t, dir)
+	fileOutFile := fmt.Sprintf("%s/file_output", dir)
+	bufOutFile := fmt.Sprintf("%s/buf_output", dir)
+
+	prepare(t)
+
+	runFile(t, dir, fileOutFile)
+	runBuf(t, bufOutFile)
+
+	fileOut, err := os.ReadFile(fileOutFile)
+	if err != nil {
+		t.Fatalf("%v\n", err)
+	}
+	bufOut, err := os.ReadFile(bufOutFile)
+	if err != nil {
+		t.Fatalf("%v\n", err)
+	}
+	if !bytes.Equal(fileOut, bufOut) {
+		t.Fatalf("%s and %s differ\n", fileOutFile, bufOutFile)
+	}
+}
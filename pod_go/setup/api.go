@@ -23,3 +23,34 @@ func Load(setupPubDir string) bool {
 	fmt.Printf("setupPubDir=%v\n", setupPubDir)
 	return bool(C.E_InitAll(setupPubCDir))
 }
+
+// SetParallelThreads provides the Go interface for E_SetParallelThreads(),
+// call it before InitAll.
+func SetParallelThreads(threads uint32) {
+	C.E_SetParallelThreads(C.uint32_t(threads))
+}
+
+// TraceEnable provides the Go interface for E_TraceEnable().
+func TraceEnable(enable bool, console bool) {
+	C.E_TraceEnable(C.bool(enable), C.bool(console))
+}
+
+// TraceSave provides the Go interface for E_TraceSave(), an empty file
+// name skips that output.
+func TraceSave(chromeFile string, summaryFile string) bool {
+	var chromeCFile, summaryCFile *C.char
+	if chromeFile != "" {
+		chromeCFile = C.CString(chromeFile)
+		defer C.free(unsafe.Pointer(chromeCFile))
+	}
+	if summaryFile != "" {
+		summaryCFile = C.CString(summaryFile)
+		defer C.free(unsafe.Pointer(summaryCFile))
+	}
+	return bool(C.E_TraceSave(chromeCFile, summaryCFile))
+}
+
+// TraceReset provides the Go interface for E_TraceReset().
+func TraceReset() {
+	C.E_TraceReset()
+}
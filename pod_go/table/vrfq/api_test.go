@@ -1,6 +1,7 @@
 package vrfq
 
 import (
+	"bytes"
 	"fmt"
 	"os"
 	"testing"
@@ -303,3 +304,96 @@ func TestOnSecretFail(t *testing.T) {
 			testIncorrectSecret)
 	}
 }
+
+// runFile runs the protocol through the file methods.
+func runFile(t *testing.T, dir string) []byte {
+	requestFile := fmt.Sprintf("%s/request", dir)
+	responseFile := fmt.Sprintf("%s/response", dir)
+	receiptFile := fmt.Sprintf("%s/receipt", dir)
+	secretFile := fmt.Sprintf("%s/secret", dir)
+	positionsFile := fmt.Sprintf("%s/positions", dir)
+
+	buyer := prepareBobSession(t)
+	defer buyer.Free()
+	seller := prepareAliceSession(t)
+	defer seller.Free()
+
+	if err := buyer.GetRequest(requestFile); err != nil {
+		t.Fatalf("%v\n", err)
+	}
+
+	if err := seller.OnRequest(requestFile, responseFile); err != nil {
+		t.Fatalf("%v\n", err)
+	}
+
+	if err := buyer.OnResponse(responseFile, receiptFile); err != nil {
+		t.Fatalf("%v\n", err)
+	}
+
+	if err := seller.OnReceipt(receiptFile, secretFile); err != nil {
+		t.Fatalf("%v\n", err)
+	}
+
+	if err := buyer.OnSecret(secretFile, positionsFile); err != nil {
+		t.Fatalf("%v\n", err)
+	}
+
+	positions, err := os.ReadFile(positionsFile)
+	if err != nil {
+		t.Fatalf("%v\n", err)
+	}
+	return positions
+}
+
+// runBuf runs the same protocol through the Buf methods, an empty receipt
+// must be rejected without breaking the session.
+func runBuf(t *testing.T) []byte {
+	buyer := prepareBobSession(t)
+	defer buyer.Free()
+	seller := prepareAliceSession(t)
+	defer seller.Free()
+
+	request, err := buyer.GetRequestBuf()
+	if err != nil {
+		t.Fatalf("%v\n", err)
+	}
+
+	response, err := seller.OnRequestBuf(request)
+	if err != nil {
+		t.Fatalf("%v\n", err)
+	}
+
+	receipt, err := buyer.OnResponseBuf(response)
+	if err != nil {
+		t.Fatalf("%v\n", err)
+	}
+
+	if _, err := seller.OnReceiptBuf(nil); err == nil {
+		t.Fatalf("should fail: empty receipt\n")
+	}
+
+	secret, err := seller.OnReceiptBuf(receipt)
+	if err != nil {
+		t.Fatalf("%v\n", err)
+	}
+
+	positions, err := buyer.OnSecretBuf(secret)
+	if err != nil {
+		t.Fatalf("%v\n", err)
+	}
+	return positions
+}
+
+func TestBuf(t *testing.T) {
+	dir := fmt.Sprintf("%s/Buf", testOutputDir)
+	mkdir(t, dir)
+
+	prepare(t)
+
+	filePositions := runFile(t, dir)
+	bufPositions := runBuf(t)
+	if !bytes.Equal(filePositions, bufPositions) {
+		t.Fatalf("positions differ: %s by file, %s by buffer\n",
+			filePositions, bufPositions)
+	}
+}
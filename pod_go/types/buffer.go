@@ -0,0 +1,92 @@
+package types
+
+/*
+#cgo CFLAGS: -I../..
+
+#include <stdlib.h>
+#include "pod_core/capi/c_api.h"
+
+uint8_t *podGoAlloc(void *ctx, uint64_t len);
+*/
+import "C"
+
+import (
+	"runtime"
+	"runtime/cgo"
+	"unsafe"
+)
+
+// Buffer passes a message in Go memory to or from a *Buf call of the C API.
+// An out Buffer gives the C side an alloc callback that returns pinned Go
+// memory, so the message is serialized straight into the Go slice.
+type Buffer struct {
+	data   []byte
+	pinner runtime.Pinner
+	cbuf   *C.buffer_t
+	ctx    *C.uintptr_t
+	handle cgo.Handle
+}
+
+// NewInBuffer wraps data for a buffer_t const * argument.
+func NewInBuffer(data []byte) *Buffer {
+	b := &Buffer{data: data}
+	b.cbuf = (*C.buffer_t)(C.calloc(1, C.size_t(unsafe.Sizeof(C.buffer_t{}))))
+	if len(data) > 0 {
+		b.pinner.Pin(&data[0])
+		b.cbuf.p = (*C.uint8_t)(unsafe.Pointer(&data[0]))
+	}
+	b.cbuf.len = C.uint64_t(len(data))
+	return b
+}
+
+// NewOutBuffer makes a Buffer for a buffer_t *, alloc_t, void *ctx argument
+// triple.
+func NewOutBuffer() *Buffer {
+	b := &Buffer{}
+	b.cbuf = (*C.buffer_t)(C.calloc(1, C.size_t(unsafe.Sizeof(C.buffer_t{}))))
+	b.handle = cgo.NewHandle(b)
+	b.ctx = (*C.uintptr_t)(C.malloc(C.size_t(unsafe.Sizeof(C.uintptr_t(0)))))
+	*b.ctx = C.uintptr_t(b.handle)
+	return b
+}
+
+// CBuffer returns the buffer_t * to pass to the C call.
+func (b *Buffer) CBuffer() unsafe.Pointer {
+	return unsafe.Pointer(b.cbuf)
+}
+
+// CAllocCtx returns the ctx to pass with CAlloc().
+func (b *Buffer) CAllocCtx() unsafe.Pointer {
+	return unsafe.Pointer(b.ctx)
+}
+
+// CAlloc returns the alloc_t that allocates the message of an out Buffer.
+func CAlloc() unsafe.Pointer {
+	return unsafe.Pointer(C.podGoAlloc)
+}
+
+// Bytes returns the message, it stays valid after Free().
+func (b *Buffer) Bytes() []byte {
+	return b.data
+}
+
+// Free unpins the message and frees the C side of the Buffer.
+func (b *Buffer) Free() {
+	b.pinner.Unpin()
+	C.free(unsafe.Pointer(b.cbuf))
+	if b.ctx != nil {
+		C.free(unsafe.Pointer(b.ctx))
+		b.handle.Delete()
+	}
+}
+
+//export podGoAlloc
+func podGoAlloc(ctx unsafe.Pointer, n C.uint64_t) *C.uint8_t {
+	b := cgo.Handle(*(*C.uintptr_t)(ctx)).Value().(*Buffer)
+	b.data = make([]byte, int(n))
+	if n == 0 {
+		return nil
+	}
+	b.pinner.Pin(&b.data[0])
+	return (*C.uint8_t)(unsafe.Pointer(&b.data[0]))
+}
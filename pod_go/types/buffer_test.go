@@ -0,0 +1,40 @@
+package types
+
+import (
+	"testing"
+)
+
+func TestNewInBufferEmpty(t *testing.T) {
+	b := NewInBuffer(nil)
+	defer b.Free()
+
+	if b.cbuf.p != nil || b.cbuf.len != 0 {
+		t.Fatalf("empty in buffer = {%v, %d}, {nil, 0} expected",
+			b.cbuf.p, b.cbuf.len)
+	}
+}
+
+func TestOutBufferAlloc(t *testing.T) {
+	b := NewOutBuffer()
+	defer b.Free()
+
+	p := podGoAlloc(b.CAllocCtx(), 8)
+	if p == nil {
+		t.Fatalf("podGoAlloc(8) returned nil")
+	}
+	if len(b.Bytes()) != 8 {
+		t.Fatalf("len(Bytes()) = %d, 8 expected", len(b.Bytes()))
+	}
+}
+
+func TestOutBufferAllocEmpty(t *testing.T) {
+	b := NewOutBuffer()
+	defer b.Free()
+
+	if p := podGoAlloc(b.CAllocCtx(), 0); p != nil {
+		t.Fatalf("podGoAlloc(0) = %v, nil expected", p)
+	}
+	if b.Bytes() == nil || len(b.Bytes()) != 0 {
+		t.Fatalf("Bytes() = %v, an empty message expected", b.Bytes())
+	}
+}
@@ -0,0 +1,109 @@
+package types
+
+/*
+#cgo CFLAGS: -I../..
+
+#include <stdlib.h>
+#include "pod_core/capi/c_api.h"
+
+void podGoTaskProgress(void *ctx, char *stage, double fraction);
+void podGoTaskDone(void *ctx, bool ret);
+*/
+import "C"
+
+import (
+	"fmt"
+	"runtime/cgo"
+	"unsafe"
+)
+
+// Task provides the Go interface for the tasks that drive the *Async calls.
+// The Async methods of the sessions run one call at a time under a task and
+// wait for its done callback, Cancel() from another goroutine stops the call
+// at its next check.
+type Task struct {
+	handle   CHandle
+	ctx      *C.uintptr_t
+	self     cgo.Handle
+	progress func(stage string, fraction float64)
+	done     chan bool
+}
+
+// NewTask provides the Go interface for E_TaskNew(), progress may be nil.
+// progress is called on the C worker or pool threads, but never
+// concurrently.
+func NewTask(progress func(stage string, fraction float64)) (*Task, error) {
+	t := &Task{progress: progress, done: make(chan bool, 1)}
+	t.self = cgo.NewHandle(t)
+	t.ctx = (*C.uintptr_t)(C.malloc(C.size_t(unsafe.Sizeof(C.uintptr_t(0)))))
+	*t.ctx = C.uintptr_t(t.self)
+
+	handle := C.E_TaskNew(C.progress_t(C.podGoTaskProgress),
+		C.done_t(C.podGoTaskDone), unsafe.Pointer(t.ctx))
+	if handle == nil {
+		C.free(unsafe.Pointer(t.ctx))
+		t.self.Delete()
+		return nil, fmt.Errorf("E_TaskNew() failed")
+	}
+	t.handle = CHandle(handle)
+
+	return t, nil
+}
+
+// Handle returns the handle_t to pass to the *Async calls.
+func (t *Task) Handle() CHandle {
+	return t.handle
+}
+
+// Wait blocks until the done callback of the running call and returns its
+// result.
+func (t *Task) Wait() bool {
+	return <-t.done
+}
+
+// Cancel provides the Go interface for E_TaskCancel()
+func (t *Task) Cancel() error {
+	handle := C.handle_t(t.handle)
+	ret := bool(C.E_TaskCancel(handle))
+	if !ret {
+		return fmt.Errorf("E_TaskCancel(%v) failed", handle)
+	}
+	return nil
+}
+
+// SetConcurrency provides the Go interface for E_TaskSetConcurrency()
+func (t *Task) SetConcurrency(threads uint32) error {
+	handle := C.handle_t(t.handle)
+	ret := bool(C.E_TaskSetConcurrency(handle, C.uint32_t(threads)))
+	if !ret {
+		return fmt.Errorf("E_TaskSetConcurrency(%v, %d) failed", handle, threads)
+	}
+	return nil
+}
+
+// Free provides the Go interface for E_TaskFree(), call it only when no call
+// of the task is running.
+func (t *Task) Free() error {
+	handle := C.handle_t(t.handle)
+	ret := bool(C.E_TaskFree(handle))
+	C.free(unsafe.Pointer(t.ctx))
+	t.self.Delete()
+	if !ret {
+		return fmt.Errorf("E_TaskFree(%v) failed", handle)
+	}
+	return nil
+}
+
+//export podGoTaskProgress
+func podGoTaskProgress(ctx unsafe.Pointer, stage *C.char, fraction C.double) {
+	t := cgo.Handle(*(*C.uintptr_t)(ctx)).Value().(*Task)
+	if t.progress != nil {
+		t.progress(C.GoString(stage), float64(fraction))
+	}
+}
+
+//export podGoTaskDone
+func podGoTaskDone(ctx unsafe.Pointer, ret C.bool) {
+	t := cgo.Handle(*(*C.uintptr_t)(ctx)).Value().(*Task)
+	t.done <- bool(ret)
+}
@@ -0,0 +1,72 @@
+package types
+
+import (
+	"testing"
+	"unsafe"
+)
+
+func prepareTask(t *testing.T) *Task {
+	task, err := NewTask(nil)
+	if err != nil {
+		t.Fatalf("%v", err)
+	}
+	if task.Handle() == nil {
+		t.Fatalf("NewTask() returned a nil handle")
+	}
+	return task
+}
+
+// taskDone plays the done callback of a C call
+func taskDone(task *Task, ret bool) {
+	if ret {
+		podGoTaskDone(unsafe.Pointer(task.ctx), true)
+	} else {
+		podGoTaskDone(unsafe.Pointer(task.ctx), false)
+	}
+}
+
+func TestNewTask(t *testing.T) {
+	task := prepareTask(t)
+	if err := task.Free(); err != nil {
+		t.Fatalf("%v", err)
+	}
+}
+
+func TestTaskSetConcurrency(t *testing.T) {
+	task := prepareTask(t)
+	defer task.Free()
+
+	for _, threads := range []uint32{1, 2, 0} {
+		if err := task.SetConcurrency(threads); err != nil {
+			t.Fatalf("%v", err)
+		}
+	}
+}
+
+func TestTaskCancel(t *testing.T) {
+	task := prepareTask(t)
+
+	if err := task.Cancel(); err != nil {
+		t.Fatalf("%v", err)
+	}
+	if err := task.Free(); err != nil {
+		t.Fatalf("%v", err)
+	}
+}
+
+// each Wait gets the result of its own call, nothing is left over for the
+// next call of the task
+func TestTaskWait(t *testing.T) {
+	task := prepareTask(t)
+	defer task.Free()
+
+	for _, ret := range []bool{true, false, false, true} {
+		go taskDone(task, ret)
+		if got := task.Wait(); got != ret {
+			t.Fatalf("Wait() = %v, %v expected", got, ret)
+		}
+		if len(task.done) != 0 {
+			t.Fatalf("%d stale results left", len(task.done))
+		}
+	}
+}
@@ -22,6 +22,9 @@ int main(int argc, char **argv)
   std::vector<uint64_t> vrf_colnum_index;
   std::vector<bool> unique_key;
   uint64_t column_num;
+  uint64_t shard_rows;
+  uint64_t shard_index;
+  std::vector<std::string> merge_shards;
   std::string data_dir;
 #ifdef MULTICORE
   uint32_t omp_thread_num;
@@ -35,6 +38,11 @@ int main(int argc, char **argv)
         "publish table file")(
         "-d data_dir -m plain -f file -o output_dir -c column_num",
         "publish plain file")(
+        "-d data_dir -m plain -f file -o output_dir -c column_num "
+        "--shard_rows rows --shard_index i",
+        "publish one shard of plain file")(
+        "-d data_dir -o output_dir --merge shard_dir...",
+        "merge the plain shards")(
         "data_dir,d", po::value<std::string>(&data_dir)->default_value("."),
         "Provide the configure file dir")(
         "mode,m", po::value<Mode>(&task_mode)->default_value(Mode::kPlain),
@@ -50,6 +58,14 @@ int main(int argc, char **argv)
         "column_num,c", po::value<uint64_t>(&column_num)->default_value(1023),
         "Provide the column number per block(line) in "
         "plain mode (default 1023)")(
+        "shard_rows", po::value<uint64_t>(&shard_rows)->default_value(0),
+        "Provide the rows per shard in plain mode, a power of 2 (0: no "
+        "shard)")(
+        "shard_index", po::value<uint64_t>(&shard_index)->default_value(0),
+        "Provide the shard to publish in plain mode")(
+        "merge", po::value<std::vector<std::string>>(&merge_shards)->multitoken(),
+        "Provide the published shard dirs in the order of the rows, merge "
+        "them into output_dir")(
         "vrf_colnum_index,k",
         po::value<std::vector<uint64_t>>(&vrf_colnum_index)->multitoken(),
         "Provide the publish file vrf key column index "
@@ -59,7 +75,7 @@ int main(int argc, char **argv)
         " in table mode (for example: -u 1 0 1)")
 #ifdef MULTICORE
         ("omp_thread_num", po::value<uint32_t>(&omp_thread_num)->default_value(0),
-         "Provide the number of the openmp thread, 1: disable openmp, 0: "
+         "Provide the number of the parallel threads, 1: disable parallel, 0: "
          "default.")
 #endif
         ;
@@ -83,14 +99,22 @@ int main(int argc, char **argv)
       return -1;
     }
 
-    if (publish_file.empty() || !fs::is_regular(publish_file))
+    if ((!merge_shards.empty() || shard_rows) && task_mode != Mode::kPlain)
+    {
+      std::cout << "Only plain mode can be sharded.\n";
+      std::cout << options << std::endl;
+      return -1;
+    }
+
+    if (merge_shards.empty() &&
+        (publish_file.empty() || !fs::is_regular(publish_file)))
     {
       std::cout << "Open publish_file " << publish_file << " failed\n";
       std::cout << options << std::endl;
       return -1;
     }
 
-    if (fs::file_size(publish_file) == 0)
+    if (merge_shards.empty() && fs::file_size(publish_file) == 0)
     {
       std::cout << "The file size of " << publish_file << " is 0\n";
       std::cout << options << std::endl;
@@ -143,6 +167,7 @@ int main(int argc, char **argv)
   {
     std::cout << "set openmp threadnum: " << omp_thread_num << "\n";
     omp_set_num_threads(omp_thread_num);
+    SetParallelThreads(omp_thread_num);
   }
 #endif
 
@@ -160,8 +185,14 @@ int main(int argc, char **argv)
   {
   case Mode::kPlain:
   {
-    ret = PublishPlain(std::move(publish_file), std::move(output_dir),
-                       column_num);
+    if (!merge_shards.empty())
+      ret = MergePlainShards(std::move(merge_shards), std::move(output_dir));
+    else if (shard_rows)
+      ret = PublishPlainShard(std::move(publish_file), std::move(output_dir),
+                              column_num, shard_rows, shard_index);
+    else
+      ret = PublishPlain(std::move(publish_file), std::move(output_dir),
+                         column_num);
     break;
   }
   case Mode::kTable:
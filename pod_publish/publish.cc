@@ -224,17 +224,17 @@ bool PublishTable(std::string publish_file, std::string output_path,
   for (size_t i = 0; i < vrf_colnums_index.size(); ++i) {
     auto& key = vrf_meta.keys[i];
     bp::P1Proof bp_p1_proof;
-    BuildKeyBp(bulletin.n, bulletin.s, m, bulletin.sigma_mkl_root,
-               key.column_index, key.mj_mkl_root, bp_p1_proof);
+    // the key j is the column j of m
+    BuildKeyBp(bulletin.n, bulletin.s, m, bulletin.sigma_mkl_root, key.j,
+               key.mj_mkl_root, bp_p1_proof);
 
 #ifdef _DEBUG
     std::vector<Fr> dummy_km(bulletin.n);
     for (uint64_t col = 0; col < bulletin.n; ++col) {
-      dummy_km[col] = m[col * bulletin.s + key.column_index];
+      dummy_km[col] = m[col * bulletin.s + key.j];
     }
-    assert(VerifyKeyBp(bulletin.n, bulletin.s, dummy_km, sigmas,
-                       key.column_index, bulletin.sigma_mkl_root,
-                       key.mj_mkl_root, bp_p1_proof));
+    assert(VerifyKeyBp(bulletin.n, bulletin.s, dummy_km, sigmas, key.j,
+                       bulletin.sigma_mkl_root, key.mj_mkl_root, bp_p1_proof));
 #endif
 
     if (!SaveBpP1Proof(key_bp_files[i], bp_p1_proof)) {
@@ -289,8 +289,11 @@ bool PublishTable(std::string publish_file, std::string output_path,
   return true;
 }
 
-bool PublishPlain(std::string publish_file, std::string output_path,
-                  uint64_t column_num) {
+namespace {
+// publish the bytes [offset, offset + size) of the file
+bool PublishPlainRange(std::string const& publish_file, uint64_t offset,
+                       uint64_t size, std::string const& output_path,
+                       uint64_t column_num) {
   using namespace scheme;
   using namespace scheme::plain;
   using namespace misc;
@@ -317,18 +320,18 @@ bool PublishPlain(std::string publish_file, std::string output_path,
   }
 
   Bulletin bulletin;
-  bulletin.size = fs::file_size(publish_file);
+  bulletin.size = size;
   if (!bulletin.size) return false;
   bulletin.s = column_num + 1;
   bulletin.n = GetDataBlockCount(bulletin.size, column_num);
 
   std::string bulletin_file = output_path + "/bulletin";
   std::string original_file = private_path + "/original";
-  std::string matrix_file = private_path + "/matrix";
+  std::string pad_file = private_path + "/pad";
   std::string sigma_file = public_path + "/sigma";
   std::string sigma_mkl_file = public_path + "/sigma_mkl_tree";
 
-  if (!CopyData(publish_file, original_file)) {
+  if (!CopyData(publish_file, offset, size, original_file)) {
     assert(false);
     return false;
   }
@@ -339,7 +342,10 @@ bool PublishPlain(std::string publish_file, std::string output_path,
     return false;
   }
 
-  if (!SaveMatrix(matrix_file, m)) {
+  // the matrix is the original plus the pad column, only the pads are saved
+  std::vector<Fr> pads(bulletin.n);
+  for (uint64_t i = 0; i < bulletin.n; ++i) pads[i] = m[i * bulletin.s];
+  if (!SaveMatrix(pad_file, pads)) {
     assert(false);
     return false;
   }
@@ -384,4 +390,138 @@ bool PublishPlain(std::string publish_file, std::string output_path,
   std::cout << "n: " << bulletin.n << ", s: " << bulletin.s << "\n";
 
   return true;
-}
\ No newline at end of file
+}
+}  // namespace
+
+bool PublishPlain(std::string publish_file, std::string output_path,
+                  uint64_t column_num) {
+  return PublishPlainRange(publish_file, 0, fs::file_size(publish_file),
+                           output_path, column_num);
+}
+
+bool PublishPlainShard(std::string publish_file, std::string output_path,
+                       uint64_t column_num, uint64_t shard_rows,
+                       uint64_t shard_index) {
+  if (!column_num || !shard_rows || (shard_rows & (shard_rows - 1))) {
+    std::cerr << "shard_rows must be a power of 2\n";
+    return false;
+  }
+  uint64_t file_size = fs::file_size(publish_file);
+  uint64_t shard_size = shard_rows * column_num * 31;
+  if (shard_index >= (file_size + shard_size - 1) / shard_size) {
+    std::cerr << "shard_index out of range\n";
+    return false;
+  }
+  uint64_t offset = shard_index * shard_size;
+  uint64_t size = std::min(shard_size, file_size - offset);
+  return PublishPlainRange(publish_file, offset, size, output_path,
+                           column_num);
+}
+
+bool MergePlainShards(std::vector<std::string> shard_paths,
+                      std::string output_path) {
+  using namespace scheme;
+  using namespace scheme::plain;
+
+  if (shard_paths.empty()) return false;
+
+  boost::system::error_code err;
+  std::string public_path = output_path + "/public";
+  if (!fs::is_directory(public_path, err) &&
+      !fs::create_directories(public_path, err)) {
+    assert(false);
+    return false;
+  }
+
+  std::string bulletin_file = output_path + "/bulletin";
+  std::string manifest_file = output_path + "/manifest";
+  std::string sigma_file = public_path + "/sigma";
+  std::string sigma_mkl_file = public_path + "/sigma_mkl_tree";
+
+  Bulletin bulletin;
+  bulletin.size = 0;
+  bulletin.n = 0;
+  Manifest manifest;
+  std::vector<h256_t> roots;
+  for (auto const& path : shard_paths) {
+    Bulletin shard_bulletin;
+    if (!LoadBulletin(path + "/bulletin", shard_bulletin) ||
+        (!roots.empty() && shard_bulletin.s != bulletin.s)) {
+      std::cerr << "invalid shard " << path << "\n";
+      return false;
+    }
+    Shard shard;
+    shard.path = fs::absolute(path).string();
+    shard.size = shard_bulletin.size;
+    shard.n = shard_bulletin.n;
+    shard.sigma_mkl_root = shard_bulletin.sigma_mkl_root;
+    manifest.shards.push_back(std::move(shard));
+    bulletin.s = shard_bulletin.s;
+    bulletin.size += shard_bulletin.size;
+    bulletin.n += shard_bulletin.n;
+    roots.push_back(shard_bulletin.sigma_mkl_root);
+  }
+  manifest.s = bulletin.s;
+  manifest.shard_rows = misc::Pow2UB(manifest.shards[0].n);
+  bulletin.sigma_mkl_root =
+      mkl::MergeRoots(roots, manifest.shard_rows, manifest.shards.back().n);
+  if (!IsBulletinValid(bulletin) || !IsManifestValid(manifest, bulletin)) {
+    std::cerr << "the shards do not make up one dataset\n";
+    return false;
+  }
+
+  // the shard sigma files are compressed points, so they just concatenate
+  try {
+    io::mapped_file_params params;
+    params.path = sigma_file;
+    params.flags = io::mapped_file_base::readwrite;
+    params.new_file_size = bulletin.n * 32;
+    io::mapped_file view(params);
+    uint8_t* start = (uint8_t*)view.data();
+    for (auto const& shard : manifest.shards) {
+      io::mapped_file_params shard_params;
+      shard_params.path = shard.path + "/public/sigma";
+      shard_params.flags = io::mapped_file_base::readonly;
+      io::mapped_file_source shard_view(shard_params);
+      if (shard_view.size() != shard.n * 32) {
+        assert(false);
+        return false;
+      }
+      memcpy(start, shard_view.data(), shard_view.size());
+      start += shard_view.size();
+    }
+
+    auto get_sigma = [&view](uint64_t i) -> h256_t {
+      h256_t h;
+      memcpy(h.data(), view.data() + i * 32, 32);
+      return h;
+    };
+    auto sigma_mkl_tree = mkl::BuildTree(bulletin.n, get_sigma);
+    if (sigma_mkl_tree.back() != bulletin.sigma_mkl_root) {
+      assert(false);
+      return false;
+    }
+    if (!SaveMkl(sigma_mkl_file, sigma_mkl_tree)) {
+      assert(false);
+      return false;
+    }
+  } catch (std::exception&) {
+    assert(false);
+    return false;
+  }
+
+  if (!SaveManifest(manifest_file, manifest)) {
+    assert(false);
+    return false;
+  }
+
+  if (!SaveBulletin(bulletin_file, bulletin)) {
+    assert(false);
+    return false;
+  }
+
+  std::cout << "shards: " << manifest.shards.size() << "\n";
+  std::cout << "file size: " << bulletin.size << "\n";
+  std::cout << "n: " << bulletin.n << ", s: " << bulletin.s << "\n";
+  return true;
+}
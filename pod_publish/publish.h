@@ -14,4 +14,16 @@ bool PublishTable(std::string publish_file, std::string output_path,
                   std::vector<bool> unique_key);
 
 bool PublishPlain(std::string publish_file, std::string output_path,
-                  uint64_t column_num);
\ No newline at end of file
+                  uint64_t column_num);
+
+// publish the rows [shard_index * shard_rows, (shard_index + 1) * shard_rows)
+// of the file as a dataset of its own, shard_rows must be a power of 2. The
+// shards can be published by different processes and then merged.
+bool PublishPlainShard(std::string publish_file, std::string output_path,
+                       uint64_t column_num, uint64_t shard_rows,
+                       uint64_t shard_index);
+
+// merge the shards (in the order of the rows) into output_path, which then
+// loads like one plain dataset. The private matrices stay in the shards.
+bool MergePlainShards(std::vector<std::string> shard_paths,
+                      std::string output_path);
\ No newline at end of file
@@ -0,0 +1,164 @@
+#include "client.h"
+
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include <array>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <random>
+
+#include "frame.h"
+#include "protocols.h"
+
+namespace {
+int Connect(std::string const& socket_path) {
+  sockaddr_un addr;
+  memset(&addr, 0, sizeof(addr));
+  addr.sun_family = AF_UNIX;
+  if (socket_path.size() >= sizeof(addr.sun_path)) return -1;
+  strcpy(addr.sun_path, socket_path.c_str());
+
+  int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+  if (fd < 0) return -1;
+  if (connect(fd, (sockaddr*)&addr, sizeof(addr)) != 0) {
+    close(fd);
+    return -1;
+  }
+  return fd;
+}
+
+bool Recv(int fd, FrameType want, std::vector<uint8_t>& payload) {
+  FrameType type;
+  if (!RecvFrame(fd, type, payload)) return false;
+  if (type == FrameType::kError) {
+    std::cerr << "server: " << std::string(payload.begin(), payload.end())
+              << "\n";
+    return false;
+  }
+  return type == want;
+}
+
+bool Open(int fd, ClientParams const& params,
+          std::array<uint8_t, 32> const& self_id,
+          std::array<uint8_t, 32>& peer_id) {
+  std::vector<uint8_t> open(self_id.begin(), self_id.end());
+  open.insert(open.end(), params.protocol.begin(), params.protocol.end());
+  open.push_back('\0');
+  open.insert(open.end(), params.dataset.begin(), params.dataset.end());
+  if (!SendFrame(fd, FrameType::kOpen, open.data(), open.size())) return false;
+
+  std::vector<uint8_t> accept;
+  if (!Recv(fd, FrameType::kAccept, accept) || accept.size() != 32)
+    return false;
+  memcpy(peer_id.data(), accept.data(), 32);
+  return true;
+}
+
+// request, response, receipt and secret, the bob steps are passed in
+template <typename GetRequest, typename OnResponse, typename OnSecret>
+bool Exchange(int fd, GetRequest get_request, OnResponse on_response,
+              OnSecret on_secret) {
+  std::vector<uint8_t> frame;
+  buffer_t out;
+  if (!get_request(&out, AllocFrame, &frame)) return false;
+  if (!SendFrame(fd, FrameType::kRequest, frame)) return false;
+
+  std::vector<uint8_t> payload;
+  if (!Recv(fd, FrameType::kResponse, payload)) return false;
+  buffer_t response{payload.data(), payload.size()};
+  if (!on_response(&response, &out, AllocFrame, &frame)) return false;
+  if (!SendFrame(fd, FrameType::kReceipt, frame)) return false;
+
+  if (!Recv(fd, FrameType::kSecret, payload)) return false;
+  buffer_t secret{payload.data(), payload.size()};
+  return on_secret(&secret);
+}
+
+bool RunRangeClient(int fd, ClientParams const& params, handle_t bob_data,
+                    std::array<uint8_t, 32> const& self_id,
+                    std::array<uint8_t, 32> const& peer_id) {
+  auto ops = FindBobOps(params.table, params.protocol);
+  if (!ops) return false;
+  handle_t bob = ops->create(bob_data, self_id.data(), peer_id.data(),
+                             params.demands.data(), params.demands.size());
+  if (!bob) return false;
+  std::shared_ptr<void> bob_guard(bob, ops->destroy);
+
+  auto get_request = [&](buffer_t* request, alloc_t alloc, void* ctx) {
+    return ops->get_request(bob, request, alloc, ctx);
+  };
+  auto on_response = [&](buffer_t const* response, buffer_t* receipt,
+                         alloc_t alloc, void* ctx) {
+    return ops->on_response(bob, response, receipt, alloc, ctx);
+  };
+  auto on_secret = [&](buffer_t const* secret) {
+    return ops->on_secret(bob, secret);
+  };
+  if (!Exchange(fd, get_request, on_response, on_secret)) return false;
+
+  return ops->save_decrypted(bob, params.output.c_str());
+}
+
+bool RunVrfqClient(int fd, ClientParams const& params, handle_t bob_data,
+                   std::array<uint8_t, 32> const& self_id,
+                   std::array<uint8_t, 32> const& peer_id) {
+  std::vector<char const*> values;
+  for (auto const& i : params.query_values) values.push_back(i.c_str());
+  handle_t bob = E_TableVrfqBobNew(bob_data, self_id.data(), peer_id.data(),
+                                   params.query_key.c_str(), values.data(),
+                                   values.size());
+  if (!bob) return false;
+  std::shared_ptr<void> bob_guard(bob, E_TableVrfqBobFree);
+
+  std::vector<uint8_t> positions_frame;
+  auto get_request = [&](buffer_t* request, alloc_t alloc, void* ctx) {
+    return E_TableVrfqBobGetRequestBuf(bob, request, alloc, ctx);
+  };
+  auto on_response = [&](buffer_t const* response, buffer_t* receipt,
+                         alloc_t alloc, void* ctx) {
+    return E_TableVrfqBobOnResponseBuf(bob, response, receipt, alloc, ctx);
+  };
+  auto on_secret = [&](buffer_t const* secret) {
+    buffer_t positions;
+    return E_TableVrfqBobOnSecretBuf(bob, secret, &positions, AllocFrame,
+                                     &positions_frame);
+  };
+  if (!Exchange(fd, get_request, on_response, on_secret)) return false;
+
+  std::ofstream os(params.output, std::ios::binary);
+  os.write((char const*)positions_frame.data() + kFrameHeaderSize,
+           positions_frame.size() - kFrameHeaderSize);
+  return (bool)os;
+}
+}  // namespace
+
+bool RunClient(ClientParams const& params) {
+  handle_t bob_data =
+      params.table ? E_TableBobDataNew(params.bulletin_file.c_str(),
+                                       params.public_path.c_str())
+                   : E_PlainBobDataNew(params.bulletin_file.c_str(),
+                                       params.public_path.c_str());
+  if (!bob_data) return false;
+  std::shared_ptr<void> data_guard(
+      bob_data, params.table ? E_TableBobDataFree : E_PlainBobDataFree);
+
+  std::array<uint8_t, 32> self_id;
+  std::random_device rd;
+  for (auto& i : self_id) i = (uint8_t)rd();
+
+  int fd = Connect(params.socket_path);
+  if (fd < 0) return false;
+  std::shared_ptr<void> fd_guard(nullptr, [fd](void*) { close(fd); });
+
+  std::array<uint8_t, 32> peer_id;
+  if (!Open(fd, params, self_id, peer_id)) return false;
+
+  if (params.table && params.protocol == "vrfq") {
+    return RunVrfqClient(fd, params, bob_data, self_id, peer_id);
+  }
+  return RunRangeClient(fd, params, bob_data, self_id, peer_id);
+}
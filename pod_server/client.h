@@ -0,0 +1,22 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "pod_core/capi/c_api.h"
+
+// a local bob to test the server end to end
+struct ClientParams {
+  std::string socket_path;
+  bool table = false;
+  std::string protocol;
+  std::string dataset;
+  std::string bulletin_file;
+  std::string public_path;
+  std::string output;                      // decrypted file or positions
+  std::vector<range_t> demands;            // complaint, atomic_swap...
+  std::string query_key;                   // vrfq
+  std::vector<std::string> query_values;  // vrfq
+};
+
+bool RunClient(ClientParams const& params);
@@ -0,0 +1,91 @@
+#include "frame.h"
+
+#include <errno.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <algorithm>
+
+namespace {
+// frames larger than this are rejected
+constexpr uint64_t kMaxFrameSize = 1ULL << 48;
+
+// RecvFrame reads the payload at most this much at a time
+constexpr uint64_t kRecvChunkSize = 1ULL << 24;
+
+bool WriteAll(int fd, uint8_t const* p, size_t len) {
+  while (len) {
+    auto ret = send(fd, p, len, MSG_NOSIGNAL);
+    if (ret < 0 && errno == EINTR) continue;
+    if (ret <= 0) return false;
+    p += ret;
+    len -= ret;
+  }
+  return true;
+}
+
+bool ReadAll(int fd, uint8_t* p, size_t len) {
+  while (len) {
+    auto ret = read(fd, p, len);
+    if (ret < 0 && errno == EINTR) continue;
+    if (ret <= 0) return false;
+    p += ret;
+    len -= ret;
+  }
+  return true;
+}
+
+void PutHeader(uint8_t* p, FrameType type, size_t len) {
+  uint64_t size = (uint64_t)len + 1;
+  for (int i = 0; i < 8; ++i) p[i] = (uint8_t)(size >> (8 * i));
+  p[8] = (uint8_t)type;
+}
+}  // namespace
+
+bool SendFrame(int fd, FrameType type, std::vector<uint8_t>& frame) {
+  if (frame.size() < kFrameHeaderSize) frame.resize(kFrameHeaderSize);
+  if (frame.size() - 1 >= kMaxFrameSize) return false;
+  PutHeader(frame.data(), type, frame.size() - kFrameHeaderSize);
+  return WriteAll(fd, frame.data(), frame.size());
+}
+
+bool SendFrame(int fd, FrameType type, uint8_t const* payload, size_t len) {
+  if (len + 1 >= kMaxFrameSize) return false;
+  uint8_t header[kFrameHeaderSize];
+  PutHeader(header, type, len);
+  if (!WriteAll(fd, header, sizeof(header))) return false;
+  return WriteAll(fd, payload, len);
+}
+
+bool SendError(int fd, std::string const& what) {
+  return SendFrame(fd, FrameType::kError, (uint8_t const*)what.data(),
+                   what.size());
+}
+
+bool RecvFrame(int fd, FrameType& type, std::vector<uint8_t>& payload) {
+  uint8_t header[kFrameHeaderSize];
+  if (!ReadAll(fd, header, sizeof(header))) return false;
+  uint64_t size = 0;
+  for (int i = 0; i < 8; ++i) size |= (uint64_t)header[i] << (8 * i);
+  if (size == 0 || size >= kMaxFrameSize) return false;
+  type = (FrameType)header[8];
+  payload.clear();
+  for (uint64_t left = size - 1; left;) {
+    auto offset = payload.size();
+    auto chunk = std::min(left, kRecvChunkSize);
+    payload.resize(offset + chunk);
+    if (!ReadAll(fd, payload.data() + offset, chunk)) return false;
+    left -= chunk;
+  }
+  return true;
+}
+
+uint8_t* AllocFrame(void* ctx, uint64_t len) {
+  auto frame = (std::vector<uint8_t>*)ctx;
+  try {
+    frame->resize(kFrameHeaderSize + len);
+  } catch (std::exception&) {
+    return nullptr;
+  }
+  return frame->data() + kFrameHeaderSize;
+}
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <stdint.h>
+
+#include <string>
+#include <vector>
+
+// every frame is a 8 bytes little endian length, 1 byte type and the
+// payload, the length counts the type and the payload
+enum class FrameType : uint8_t {
+  kOpen = 1,  // bob id(32) + protocol + '\0' + dataset
+  kAccept,    // alice id(32)
+  kRequest,
+  kResponse,
+  kReceipt,
+  kSecret,
+  kError,  // error text
+};
+
+constexpr size_t kFrameHeaderSize = 9;
+
+// the frame vector has kFrameHeaderSize bytes reserved before the payload
+bool SendFrame(int fd, FrameType type, std::vector<uint8_t>& frame);
+
+bool SendFrame(int fd, FrameType type, uint8_t const* payload, size_t len);
+
+bool SendError(int fd, std::string const& what);
+
+// the payload grows as its bytes arrive, a peer can not make us allocate
+// more than it actually sent
+bool RecvFrame(int fd, FrameType& type, std::vector<uint8_t>& payload);
+
+// alloc_t that writes the payload right behind the header of a frame vector
+uint8_t* AllocFrame(void* ctx, uint64_t len);
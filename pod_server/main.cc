@@ -0,0 +1,186 @@
+#include <array>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <boost/algorithm/hex.hpp>
+#include <boost/program_options.hpp>
+
+#include "client.h"
+#include "public/basic_types.h"
+#include "server.h"
+#include "server_test.h"
+
+namespace {
+// name=path
+bool ParseDataset(std::string const& s, std::string& name, std::string& path) {
+  auto pos = s.find('=');
+  if (pos == std::string::npos || pos == 0 || pos + 1 == s.size())
+    return false;
+  name = s.substr(0, pos);
+  path = s.substr(pos + 1);
+  return true;
+}
+
+bool ParseId(std::string const& s, std::array<uint8_t, 32>& id) {
+  if (s.size() != id.size() * 2) return false;
+  try {
+    boost::algorithm::unhex(s.begin(), s.end(), id.begin());
+  } catch (std::exception&) {
+    return false;
+  }
+  return true;
+}
+}  // namespace
+
+int main(int argc, char** argv) {
+  setlocale(LC_ALL, "");
+
+  namespace po = boost::program_options;
+
+  std::string data_dir;
+  std::string socket_path;
+  std::vector<std::string> plain_datasets;
+  std::vector<std::string> table_datasets;
+  std::string id_hex;
+  bool client = false;
+  bool unit_test = false;
+  std::string mode;
+  std::vector<std::string> demand_ranges;
+  ClientParams params;
+
+  try {
+    po::options_description options("command line options");
+    options.add_options()("help,h", "Use -h or --help to list all arguments")(
+        "data_dir,d", po::value<std::string>(&data_dir)->default_value("."),
+        "Provide the configure file dir")(
+        "socket,s",
+        po::value<std::string>(&socket_path)
+            ->default_value("/tmp/pod_server.sock"),
+        "Provide the unix socket path")(
+        "plain",
+        po::value<std::vector<std::string>>(&plain_datasets)->multitoken(),
+        "Serve plain datasets (for example --plain a=publish_dir_a)")(
+        "table",
+        po::value<std::vector<std::string>>(&table_datasets)->multitoken(),
+        "Serve table datasets (for example --table b=publish_dir_b)")(
+        "id", po::value<std::string>(&id_hex),
+        "Provide the alice id in hex, random if not given")(
+        "client", "Run as bob against a running server")(
+        "unit_test",
+        "Run the frame tests, and the session tests against the plain "
+        "datasets")(
+        "mode,m", po::value<std::string>(&mode),
+        "Provide pod mode (plain, table), client only")(
+        "protocol,a", po::value<std::string>(&params.protocol),
+        "Provide protocol (complaint, atomic_swap, atomic_swap_vc, vrfq), "
+        "client only")(
+        "dataset,n", po::value<std::string>(&params.dataset),
+        "Provide the dataset name, client only")(
+        "bulletin,b", po::value<std::string>(&params.bulletin_file),
+        "Provide the bulletin file, client only")(
+        "public,p", po::value<std::string>(&params.public_path),
+        "Provide the public dir, client only")(
+        "demand_ranges",
+        po::value<std::vector<std::string>>(&demand_ranges)->multitoken(),
+        "Provide the demand ranges, client only")(
+        "query_key,k", po::value<std::string>(&params.query_key),
+        "Provide the query key name(vrfq)")(
+        "key_value,v",
+        po::value<std::vector<std::string>>(&params.query_values)
+            ->multitoken(),
+        "Provide the query key values(vrfq)")(
+        "output,o", po::value<std::string>(&params.output),
+        "Provide the output file, client only");
+
+    po::variables_map vmap;
+    po::store(po::parse_command_line(argc, argv, options), vmap);
+    po::notify(vmap);
+
+    if (vmap.count("help")) {
+      std::cerr << options << std::endl;
+      return -1;
+    }
+
+    if (vmap.count("client")) {
+      client = true;
+    }
+
+    if (vmap.count("unit_test")) {
+      unit_test = true;
+    }
+
+    for (auto const& i : demand_ranges) {
+      Range range = Range::from_string(i);  // throw
+      params.demands.push_back(range_t{range.start, range.count});
+    }
+  } catch (std::exception& e) {
+    std::cerr << "Unknown parameters.\n"
+              << e.what() << "\n"
+              << "-h or --help to list all arguments.\n";
+    return -1;
+  }
+
+  if (!E_InitAll(data_dir.c_str())) {
+    std::cerr << "Init failed\n";
+    return -1;
+  }
+
+  if (client) {
+    if (mode != "plain" && mode != "table") {
+      std::cerr << "Want mode(-m) plain or table\n";
+      return -1;
+    }
+    params.table = mode == "table";
+    params.socket_path = socket_path;
+    if (params.output.empty()) {
+      std::cerr << "Want output(-o)\n";
+      return -1;
+    }
+    if (!RunClient(params)) {
+      std::cerr << "Client failed\n";
+      return -1;
+    }
+    std::cout << "Client success\n";
+    return 0;
+  }
+
+  std::array<uint8_t, 32> id;
+  if (id_hex.empty()) {
+    std::random_device rd;
+    for (auto& i : id) i = (uint8_t)rd();
+  } else if (!ParseId(id_hex, id)) {
+    std::cerr << "Invalid id " << id_hex << "\n";
+    return -1;
+  }
+
+  Server server(socket_path, id);
+  std::vector<std::pair<std::string, std::string>> plain;
+  for (int i = 0; i < 2; ++i) {
+    bool table = i == 1;
+    for (auto const& s : table ? table_datasets : plain_datasets) {
+      std::string name, path;
+      if (!ParseDataset(s, name, path)) {
+        std::cerr << "Invalid dataset " << s << "\n";
+        return -1;
+      }
+      if (!server.AddDataset(name, table, path)) {
+        std::cerr << "Load dataset " << name << " from " << path
+                  << " failed\n";
+        return -1;
+      }
+      if (!table) plain.emplace_back(name, path);
+    }
+  }
+
+  if (unit_test) {
+    return UnitTest(server, plain) ? 0 : -1;
+  }
+
+  if (!server.Run()) {
+    std::cerr << "Server failed\n";
+    return -1;
+  }
+  return 0;
+}
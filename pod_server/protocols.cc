@@ -0,0 +1,77 @@
+#include "protocols.h"
+
+#include <map>
+
+namespace {
+typedef std::map<std::string, AliceOps> AliceOpsMap;
+typedef std::map<std::string, BobOps> BobOpsMap;
+
+AliceOpsMap const kPlainAlice{
+    {"complaint",
+     {E_PlainComplaintAliceNew, E_PlainComplaintAliceOnRequestBufAsync,
+      E_PlainComplaintAliceOnReceiptBuf, E_PlainComplaintAliceFree}},
+    {"atomic_swap",
+     {E_PlainAtomicSwapAliceNew, E_PlainAtomicSwapAliceOnRequestBufAsync,
+      E_PlainAtomicSwapAliceOnReceiptBuf, E_PlainAtomicSwapAliceFree}},
+    {"atomic_swap_vc",
+     {E_PlainAtomicSwapVcAliceNew, E_PlainAtomicSwapVcAliceOnRequestBufAsync,
+      E_PlainAtomicSwapVcAliceOnReceiptBuf, E_PlainAtomicSwapVcAliceFree}},
+};
+
+AliceOpsMap const kTableAlice{
+    {"complaint",
+     {E_TableComplaintAliceNew, E_TableComplaintAliceOnRequestBufAsync,
+      E_TableComplaintAliceOnReceiptBuf, E_TableComplaintAliceFree}},
+    {"atomic_swap",
+     {E_TableAtomicSwapAliceNew, E_TableAtomicSwapAliceOnRequestBufAsync,
+      E_TableAtomicSwapAliceOnReceiptBuf, E_TableAtomicSwapAliceFree}},
+    {"atomic_swap_vc",
+     {E_TableAtomicSwapVcAliceNew, E_TableAtomicSwapVcAliceOnRequestBufAsync,
+      E_TableAtomicSwapVcAliceOnReceiptBuf, E_TableAtomicSwapVcAliceFree}},
+    {"vrfq",
+     {E_TableVrfqAliceNew, E_TableVrfqAliceOnRequestBufAsync,
+      E_TableVrfqAliceOnReceiptBuf, E_TableVrfqAliceFree}},
+};
+
+BobOpsMap const kPlainBob{
+    {"complaint",
+     {E_PlainComplaintBobNew, E_PlainComplaintBobGetRequestBuf,
+      E_PlainComplaintBobOnResponseBuf, E_PlainComplaintBobOnSecretBuf,
+      E_PlainComplaintBobSaveDecrypted, E_PlainComplaintBobFree}},
+    {"atomic_swap",
+     {E_PlainAtomicSwapBobNew, E_PlainAtomicSwapBobGetRequestBuf,
+      E_PlainAtomicSwapBobOnResponseBuf, E_PlainAtomicSwapBobOnSecretBuf,
+      E_PlainAtomicSwapBobSaveDecrypted, E_PlainAtomicSwapBobFree}},
+    {"atomic_swap_vc",
+     {E_PlainAtomicSwapVcBobNew, E_PlainAtomicSwapVcBobGetRequestBuf,
+      E_PlainAtomicSwapVcBobOnResponseBuf, E_PlainAtomicSwapVcBobOnSecretBuf,
+      E_PlainAtomicSwapVcBobSaveDecrypted, E_PlainAtomicSwapVcBobFree}},
+};
+
+BobOpsMap const kTableBob{
+    {"complaint",
+     {E_TableComplaintBobNew, E_TableComplaintBobGetRequestBuf,
+      E_TableComplaintBobOnResponseBuf, E_TableComplaintBobOnSecretBuf,
+      E_TableComplaintBobSaveDecrypted, E_TableComplaintBobFree}},
+    {"atomic_swap",
+     {E_TableAtomicSwapBobNew, E_TableAtomicSwapBobGetRequestBuf,
+      E_TableAtomicSwapBobOnResponseBuf, E_TableAtomicSwapBobOnSecretBuf,
+      E_TableAtomicSwapBobSaveDecrypted, E_TableAtomicSwapBobFree}},
+    {"atomic_swap_vc",
+     {E_TableAtomicSwapVcBobNew, E_TableAtomicSwapVcBobGetRequestBuf,
+      E_TableAtomicSwapVcBobOnResponseBuf, E_TableAtomicSwapVcBobOnSecretBuf,
+      E_TableAtomicSwapVcBobSaveDecrypted, E_TableAtomicSwapVcBobFree}},
+};
+}  // namespace
+
+AliceOps const* FindAliceOps(bool table, std::string const& protocol) {
+  auto const& ops = table ? kTableAlice : kPlainAlice;
+  auto it = ops.find(protocol);
+  return it == ops.end() ? nullptr : &it->second;
+}
+
+BobOps const* FindBobOps(bool table, std::string const& protocol) {
+  auto const& ops = table ? kTableBob : kPlainBob;
+  auto it = ops.find(protocol);
+  return it == ops.end() ? nullptr : &it->second;
+}
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <string>
+
+#include "pod_core/capi/c_api.h"
+
+// the alice side of the request/receipt protocols, on_request is async
+struct AliceOps {
+  handle_t (*create)(handle_t c_alice_data, uint8_t const* c_self_id,
+                     uint8_t const* c_peer_id);
+  bool (*on_request)(handle_t c_alice, buffer_t const* request,
+                     buffer_t* response, alloc_t alloc, void* ctx,
+                     handle_t c_task);
+  bool (*on_receipt)(handle_t c_alice, buffer_t const* receipt,
+                     buffer_t* secret, alloc_t alloc, void* ctx);
+  bool (*destroy)(handle_t c_alice);
+};
+
+// the bob side of the protocols that buy ranges
+struct BobOps {
+  handle_t (*create)(handle_t c_bob_data, uint8_t const* c_self_id,
+                     uint8_t const* c_peer_id, range_t const* c_demand,
+                     uint64_t c_demand_count);
+  bool (*get_request)(handle_t c_bob, buffer_t* request, alloc_t alloc,
+                      void* ctx);
+  bool (*on_response)(handle_t c_bob, buffer_t const* response,
+                      buffer_t* receipt, alloc_t alloc, void* ctx);
+  bool (*on_secret)(handle_t c_bob, buffer_t const* secret);
+  bool (*save_decrypted)(handle_t c_bob, char const* file);
+  bool (*destroy)(handle_t c_bob);
+};
+
+// complaint, atomic_swap, atomic_swap_vc and vrfq(table only)
+AliceOps const* FindAliceOps(bool table, std::string const& protocol);
+
+// complaint, atomic_swap, atomic_swap_vc
+BobOps const* FindBobOps(bool table, std::string const& protocol);
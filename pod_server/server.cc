@@ -0,0 +1,190 @@
+#include "server.h"
+
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <future>
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "frame.h"
+#include "protocols.h"
+
+namespace {
+void OnTaskDone(void* ctx, bool ret) {
+  ((std::promise<bool>*)ctx)->set_value(ret);
+}
+
+bool PeerClosed(int fd) {
+  pollfd p{fd, POLLIN, 0};
+  if (poll(&p, 1, 0) <= 0) return false;
+  if (p.revents & (POLLHUP | POLLERR)) return true;
+  char c;
+  return recv(fd, &c, 1, MSG_PEEK | MSG_DONTWAIT) == 0;
+}
+}  // namespace
+
+Server::Server(std::string const& socket_path,
+               std::array<uint8_t, 32> const& id)
+    : socket_path_(socket_path), id_(id) {}
+
+Server::~Server() {
+  for (auto const& i : datasets_) {
+    if (i.second.table) {
+      E_TableAliceDataFree(i.second.data);
+    } else {
+      E_PlainAliceDataFree(i.second.data);
+    }
+  }
+}
+
+bool Server::AddDataset(std::string const& name, bool table,
+                        std::string const& publish_path) {
+  if (datasets_.count(name)) return false;
+  handle_t data = table ? E_TableAliceDataNew(publish_path.c_str())
+                        : E_PlainAliceDataNew(publish_path.c_str());
+  if (!data) return false;
+  datasets_[name] = Dataset{table, data};
+  return true;
+}
+
+bool Server::Run() {
+  int listen_fd = socket(AF_UNIX, SOCK_STREAM, 0);
+  if (listen_fd < 0) return false;
+
+  sockaddr_un addr;
+  memset(&addr, 0, sizeof(addr));
+  addr.sun_family = AF_UNIX;
+  if (socket_path_.size() >= sizeof(addr.sun_path)) {
+    close(listen_fd);
+    return false;
+  }
+  strcpy(addr.sun_path, socket_path_.c_str());
+  unlink(socket_path_.c_str());
+
+  if (bind(listen_fd, (sockaddr*)&addr, sizeof(addr)) != 0 ||
+      listen(listen_fd, SOMAXCONN) != 0) {
+    close(listen_fd);
+    return false;
+  }
+
+  std::cout << "pod_server listening on " << socket_path_ << "\n";
+  for (;;) {
+    int fd = accept(listen_fd, nullptr, nullptr);
+    if (fd < 0) {
+      if (errno == EINTR || errno == ECONNABORTED) continue;
+      close(listen_fd);
+      return false;
+    }
+    // the session thread only does io, the heavy stages go to the capi pool
+    std::thread([this, fd]() { Serve(fd); }).detach();
+  }
+}
+
+void Server::Serve(int fd) {
+  if (!Session(fd)) std::cerr << "session " << fd << " failed\n";
+  close(fd);
+}
+
+bool Server::Session(int fd) {
+  FrameType type;
+  std::vector<uint8_t> payload;
+  if (!RecvFrame(fd, type, payload) || type != FrameType::kOpen ||
+      payload.size() <= 32) {
+    SendError(fd, "want open");
+    return false;
+  }
+
+  // bob id, protocol '\0' dataset
+  std::array<uint8_t, 32> peer_id;
+  memcpy(peer_id.data(), payload.data(), 32);
+  std::string names((char const*)payload.data() + 32, payload.size() - 32);
+  auto pos = names.find('\0');
+  if (pos == std::string::npos) {
+    SendError(fd, "invalid open");
+    return false;
+  }
+  std::string protocol = names.substr(0, pos);
+  std::string dataset_name = names.substr(pos + 1);
+
+  auto dataset = datasets_.find(dataset_name);
+  if (dataset == datasets_.end()) {
+    SendError(fd, "unknown dataset");
+    return false;
+  }
+  auto ops = FindAliceOps(dataset->second.table, protocol);
+  if (!ops) {
+    SendError(fd, "unknown protocol");
+    return false;
+  }
+
+  handle_t alice = ops->create(dataset->second.data, id_.data(),
+                               peer_id.data());
+  if (!alice) {
+    SendError(fd, "create session failed");
+    return false;
+  }
+  ++live_sessions_;
+  std::shared_ptr<void> alice_guard(alice, [this, ops](void* p) {
+    ops->destroy(p);
+    --live_sessions_;
+  });
+
+  if (!SendFrame(fd, FrameType::kAccept, id_.data(), id_.size())) return false;
+
+  // request
+  if (!RecvFrame(fd, type, payload) || type != FrameType::kRequest) {
+    SendError(fd, "want request");
+    return false;
+  }
+  buffer_t request{payload.data(), payload.size()};
+  std::vector<uint8_t> response_frame;
+  buffer_t response;
+  std::promise<bool> done;
+  auto done_future = done.get_future();
+  handle_t task = E_TaskNew(nullptr, OnTaskDone, &done);
+  std::shared_ptr<void> task_guard(task, E_TaskFree);
+  if (!ops->on_request(alice, &request, &response, AllocFrame,
+                       &response_frame, task)) {
+    SendError(fd, "busy");
+    return false;
+  }
+
+  // cancel as soon as bob goes away, the buffers must outlive the task
+  using namespace std::chrono_literals;
+  bool cancelled = false;
+  do {
+    if (!cancelled && PeerClosed(fd)) {
+      E_TaskCancel(task);
+      cancelled = true;
+    }
+  } while (done_future.wait_for(100ms) != std::future_status::ready);
+  if (!done_future.get()) {
+    if (cancelled) ++cancelled_sessions_;
+    SendError(fd, "on request failed");
+    return false;
+  }
+  if (!SendFrame(fd, FrameType::kResponse, response_frame)) return false;
+  response_frame = std::vector<uint8_t>();
+
+  // receipt
+  if (!RecvFrame(fd, type, payload) || type != FrameType::kReceipt) {
+    SendError(fd, "want receipt");
+    return false;
+  }
+  buffer_t receipt{payload.data(), payload.size()};
+  std::vector<uint8_t> secret_frame;
+  buffer_t secret;
+  if (!ops->on_receipt(alice, &receipt, &secret, AllocFrame, &secret_frame)) {
+    SendError(fd, "on receipt failed");
+    return false;
+  }
+  return SendFrame(fd, FrameType::kSecret, secret_frame);
+}
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <map>
+#include <string>
+
+#include "pod_core/capi/c_api.h"
+
+// keeps the datasets loaded and serves one alice session per connection
+class Server {
+ public:
+  Server(std::string const& socket_path, std::array<uint8_t, 32> const& id);
+  ~Server();
+
+  bool AddDataset(std::string const& name, bool table,
+                  std::string const& publish_path);
+
+  // accept loop, only returns on error
+  bool Run();
+
+  // one session on the connected fd, closes fd
+  void Serve(int fd);
+
+  // the alice sessions not freed yet
+  size_t live_sessions() const { return live_sessions_; }
+
+  // the sessions whose request was cancelled because bob went away
+  uint64_t cancelled_sessions() const { return cancelled_sessions_; }
+
+ private:
+  struct Dataset {
+    bool table;
+    handle_t data;
+  };
+
+  bool Session(int fd);
+
+ private:
+  std::string const socket_path_;
+  std::array<uint8_t, 32> const id_;
+  std::map<std::string, Dataset> datasets_;
+  std::atomic<size_t> live_sessions_{0};
+  std::atomic<uint64_t> cancelled_sessions_{0};
+};
@@ -0,0 +1,233 @@
+#include "server_test.h"
+
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <cassert>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <thread>
+
+#include "frame.h"
+#include "protocols.h"
+
+namespace {
+struct SocketPair {
+  SocketPair() {
+    if (socketpair(AF_UNIX, SOCK_STREAM, 0, fd) != 0) fd[0] = fd[1] = -1;
+  }
+  ~SocketPair() {
+    for (int i : fd) {
+      if (i >= 0) close(i);
+    }
+  }
+  // hand one end over to its new owner
+  int Release(int i) {
+    int ret = fd[i];
+    fd[i] = -1;
+    return ret;
+  }
+  int fd[2];
+};
+
+bool SendRaw(int fd, uint64_t size, FrameType type, size_t payload_len) {
+  std::vector<uint8_t> frame(kFrameHeaderSize + payload_len);
+  for (int i = 0; i < 8; ++i) frame[i] = (uint8_t)(size >> (8 * i));
+  frame[8] = (uint8_t)type;
+  return send(fd, frame.data(), frame.size(), MSG_NOSIGNAL) ==
+         (ssize_t)frame.size();
+}
+
+bool TestFrameRoundTrip() {
+  // more than one receive chunk
+  for (size_t len : {(size_t)0, (size_t)1, (size_t)(17 << 20)}) {
+    SocketPair sp;
+    std::vector<uint8_t> sent(len);
+    for (size_t i = 0; i < len; ++i) sent[i] = (uint8_t)i;
+    bool send_ret = false;
+    std::thread sender([&]() {
+      send_ret = SendFrame(sp.fd[0], FrameType::kRequest, sent.data(), len);
+    });
+    FrameType type;
+    std::vector<uint8_t> payload;
+    bool ret = RecvFrame(sp.fd[1], type, payload);
+    sender.join();
+    if (!send_ret || !ret || type != FrameType::kRequest || payload != sent) {
+      assert(false);
+      return false;
+    }
+  }
+  return true;
+}
+
+// a length of 0 or far beyond any message, RecvFrame must fail without
+// waiting for the payload
+bool TestFrameOversized() {
+  for (uint64_t size : {0ULL, 1ULL << 48, 1ULL << 60, ~0ULL}) {
+    SocketPair sp;
+    if (!SendRaw(sp.fd[0], size, FrameType::kRequest, 16)) return false;
+    FrameType type;
+    std::vector<uint8_t> payload;
+    if (RecvFrame(sp.fd[1], type, payload)) {
+      assert(false);
+      return false;
+    }
+  }
+  return true;
+}
+
+bool TestFrameTruncated() {
+  SocketPair sp;
+  if (!SendRaw(sp.fd[0], 1001, FrameType::kRequest, 10)) return false;
+  shutdown(sp.fd[0], SHUT_WR);
+  FrameType type;
+  std::vector<uint8_t> payload;
+  if (RecvFrame(sp.fd[1], type, payload)) {
+    assert(false);
+    return false;
+  }
+  return true;
+}
+
+// serve one connection, send is bob's part, then read until the server
+// closes
+template <typename Send>
+bool RunSession(Server& server, Send const& send_frames,
+                FrameType& last_type) {
+  SocketPair sp;
+  if (sp.fd[0] < 0) return false;
+  int server_fd = sp.Release(0);
+  std::thread serve([&server, server_fd]() { server.Serve(server_fd); });
+
+  int fd = sp.fd[1];
+  bool ret = send_frames(fd);
+  shutdown(fd, SHUT_WR);
+  FrameType type;
+  std::vector<uint8_t> payload;
+  last_type = FrameType::kOpen;
+  while (RecvFrame(fd, type, payload)) last_type = type;
+  serve.join();
+  return ret;
+}
+
+// a broken open frame is answered with an error before any session exists
+bool TestServeBrokenOpen(Server& server) {
+  FrameType last;
+  auto oversized = [](int fd) {
+    return SendRaw(fd, 1ULL << 60, FrameType::kOpen, 64);
+  };
+  auto truncated = [](int fd) {
+    return SendRaw(fd, 1001, FrameType::kOpen, 64);
+  };
+  for (auto f : {+oversized, +truncated}) {
+    if (!RunSession(server, f, last) || last != FrameType::kError ||
+        server.live_sessions()) {
+      assert(false);
+      return false;
+    }
+  }
+  return true;
+}
+
+// bob_id, protocol '\0' dataset, then the alice id comes back
+bool Open(int fd, std::vector<uint8_t> const& bob_id,
+          std::string const& protocol, std::string const& dataset,
+          std::vector<uint8_t>& alice_id) {
+  std::vector<uint8_t> open(bob_id);
+  open.insert(open.end(), protocol.begin(), protocol.end());
+  open.push_back('\0');
+  open.insert(open.end(), dataset.begin(), dataset.end());
+  if (!SendFrame(fd, FrameType::kOpen, open.data(), open.size())) return false;
+  FrameType type;
+  return RecvFrame(fd, type, alice_id) && type == FrameType::kAccept &&
+         alice_id.size() == 32;
+}
+
+// a session is open when the request breaks off or bob hangs up while the
+// response is being computed
+bool TestServeSession(Server& server, std::string const& name,
+                      std::string const& publish_path) {
+  std::string bulletin_file = publish_path + "/bulletin";
+  std::string public_path = publish_path + "/public";
+  handle_t bob_data =
+      E_PlainBobDataNew(bulletin_file.c_str(), public_path.c_str());
+  if (!bob_data) return false;
+  std::shared_ptr<void> data_guard(bob_data, E_PlainBobDataFree);
+
+  plain_bulletin_t bulletin;
+  if (!E_PlainBobBulletin(bob_data, &bulletin)) return false;
+
+  auto ops = FindBobOps(false, "complaint");
+  std::vector<uint8_t> bob_id(32, 0x42);
+  std::vector<uint8_t> alice_id;
+
+  FrameType last;
+  auto truncated = [&](int fd) {
+    return Open(fd, bob_id, "complaint", name, alice_id) &&
+           SendRaw(fd, 1001, FrameType::kRequest, 16);
+  };
+  if (!RunSession(server, truncated, last) || last != FrameType::kError ||
+      server.live_sessions()) {
+    assert(false);
+    return false;
+  }
+
+  // the request for every row, so the response takes a while, then hang up
+  // at once
+  uint64_t cancelled = server.cancelled_sessions();
+  auto hang_up = [&](int fd) {
+    if (!Open(fd, bob_id, "complaint", name, alice_id)) return false;
+    range_t demand{0, bulletin.n};
+    handle_t bob = ops->create(bob_data, bob_id.data(), alice_id.data(),
+                               &demand, 1);
+    if (!bob) return false;
+    std::shared_ptr<void> bob_guard(bob, ops->destroy);
+    std::vector<uint8_t> frame;
+    buffer_t request;
+    if (!ops->get_request(bob, &request, AllocFrame, &frame)) return false;
+    if (!SendFrame(fd, FrameType::kRequest, frame)) return false;
+    return shutdown(fd, SHUT_RDWR) == 0;
+  };
+  if (!RunSession(server, hang_up, last) || server.live_sessions() ||
+      server.cancelled_sessions() != cancelled + 1) {
+    assert(false);
+    return false;
+  }
+  return true;
+}
+}  // namespace
+
+bool UnitTest(Server& server,
+              std::vector<std::pair<std::string, std::string>> const& plain) {
+  struct Item {
+    std::string name;
+    std::function<bool()> test;
+  };
+  std::vector<Item> items{
+      {"FrameRoundTrip", TestFrameRoundTrip},
+      {"FrameOversized", TestFrameOversized},
+      {"FrameTruncated", TestFrameTruncated},
+      {"ServeBrokenOpen", [&server]() { return TestServeBrokenOpen(server); }},
+  };
+  for (auto const& i : plain) {
+    items.push_back({"ServeSession " + i.first, [&server, &i]() {
+                       return TestServeSession(server, i.first, i.second);
+                     }});
+  }
+
+  size_t failed = 0;
+  for (auto const& item : items) {
+    bool ret;
+    try {
+      ret = item.test();
+    } catch (std::exception& e) {
+      std::cerr << item.name << "\t" << e.what() << "\n";
+      ret = false;
+    }
+    std::cout << (ret ? "pass: " : "FAIL: ") << item.name << "\n";
+    if (!ret) ++failed;
+  }
+  std::cout << items.size() - failed << "/" << items.size() << " passed\n";
+  return !failed;
+}
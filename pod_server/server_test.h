@@ -0,0 +1,14 @@
+#pragma once
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "server.h"
+
+// the frame tests, then the session tests against every plain dataset
+// (name, publish path) loaded by server: broken frames and bob hanging up
+// during the async request must free the session, the latter by cancelling
+// the task
+bool UnitTest(Server& server,
+              std::vector<std::pair<std::string, std::string>> const& plain);
@@ -0,0 +1,50 @@
+#!/bin/sh
+# Publish the pod_go test files, run the unit tests, then serve the files
+# and buy them back with --client: the whole plain file by complaint and a
+# few table rows by vrfq. pod_setup and pod_publish must be built.
+set -e
+
+cd "$(dirname "$0")"
+POD_SERVER=${POD_SERVER:-./pod_server}
+POD_SETUP=../pod_setup/pod_setup
+POD_PUBLISH=../pod_publish/pod_publish
+TEST_DATA=../pod_go/test_data
+DIR=./build/test
+SOCKET=/tmp/pod_server_test.$$.sock
+
+rm -rf $DIR
+mkdir -p $DIR/output
+$POD_SETUP -o $DIR/zksnark_key
+$POD_PUBLISH -d $DIR -m plain -f $TEST_DATA/plain.txt -o $DIR/plain -c 1024
+$POD_PUBLISH -d $DIR -m table -f $TEST_DATA/table.csv -o $DIR/table \
+  -t csv -k 0 1 2 3 4 5
+
+$POD_SERVER -d $DIR --unit_test --plain plain=$DIR/plain
+
+$POD_SERVER -d $DIR -s $SOCKET --plain plain=$DIR/plain \
+  --table table=$DIR/table &
+SERVER=$!
+trap 'kill $SERVER 2>/dev/null; rm -f $SOCKET' EXIT
+
+i=0
+while [ ! -S $SOCKET ]; do
+  i=$((i + 1))
+  if [ $i -gt 600 ] || ! kill -0 $SERVER 2>/dev/null; then
+    echo "pod_server did not start"
+    exit 1
+  fi
+  sleep 0.1
+done
+
+# plain.txt is 14 rows of 1024 * 31 bytes
+$POD_SERVER -d $DIR --client -s $SOCKET -m plain -a complaint -n plain \
+  -b $DIR/plain/bulletin -p $DIR/plain/public -o $DIR/output/plain \
+  --demand_ranges 0-14
+cmp $DIR/output/plain $TEST_DATA/plain.txt
+
+$POD_SERVER -d $DIR --client -s $SOCKET -m table -a vrfq -n table \
+  -b $DIR/table/bulletin -p $DIR/table/public -o $DIR/output/positions \
+  -k "date (UTC)" -v 20190417 20180105
+test -s $DIR/output/positions
+
+echo "pod_server test passed"
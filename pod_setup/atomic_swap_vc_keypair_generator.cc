@@ -23,6 +23,7 @@
 
 #include "atomic_swap_gadget.h"
 #include "mimc.h"
+#include "zkp_key_name.h"
 
 typedef libff::Fr<libsnark::default_r1cs_ppzksnark_pp> ZkFr;
 
@@ -83,15 +84,19 @@ bool GenerateAtomicSwapKeyPair(std::string const& output_path, uint64_t count) {
       keypair = libsnark::r1cs_gg_ppzksnark_generator<
           libsnark::default_r1cs_gg_ppzksnark_pp>(constraint_system);
 
+  std::string name = ZkpKeyName(kAtomicSwapVcZkpFamily, count);
+  std::string vk_file = output_path + "/" + name + ".vk";
+  std::string pk_file = output_path + "/" + name + ".pk";
+
   try {
     std::ofstream ofs_vk_data;
-    ofs_vk_data.open(output_path + "/atomic_swap_vc.vk",
+    ofs_vk_data.open(vk_file,
                      std::ofstream::out | std::ofstream::binary);
     ofs_vk_data << keypair.vk;
     ofs_vk_data.close();
 
     std::ofstream ofs_pk_data;
-    ofs_pk_data.open(output_path + "/atomic_swap_vc.pk",
+    ofs_pk_data.open(pk_file,
                      std::ofstream::out | std::ofstream::binary);
     ofs_pk_data << keypair.pk;
     ofs_pk_data.close();
@@ -100,12 +105,12 @@ bool GenerateAtomicSwapKeyPair(std::string const& output_path, uint64_t count) {
         keypair_check;
 
     std::ifstream ifs_vk_data;
-    ifs_vk_data.open(output_path + "/atomic_swap_vc.vk",
+    ifs_vk_data.open(vk_file,
                      std::ifstream::in | std::ifstream::binary);
     ifs_vk_data >> keypair_check.vk;
 
     std::ifstream ifs_pk_data;
-    ifs_pk_data.open(output_path + "/atomic_swap_vc.pk",
+    ifs_pk_data.open(pk_file,
                      std::ifstream::in | std::ifstream::binary);
     ifs_pk_data >> keypair_check.pk;
 
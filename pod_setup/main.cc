@@ -1,3 +1,6 @@
+#include <algorithm>
+#include <vector>
+
 #include "ecc.h"
 #include "public.h"
 #include "zkp.h"
@@ -8,7 +11,7 @@ int main(int argc, char **argv)
 {
   setlocale(LC_ALL, "");
   std::string output_path;
-  uint64_t count;
+  std::vector<uint64_t> counts;
   bool verbose;
 
   try
@@ -18,8 +21,12 @@ int main(int argc, char **argv)
         "output_path,o",
         po::value<std::string>(&output_path)->default_value("zksnark_key"),
         "Provide the output path")(
-        "count,c", po::value<uint64_t>(&count)->default_value(1024),
-        "Provide the count")(
+        "count,c",
+        po::value<std::vector<uint64_t>>(&counts)
+            ->multitoken()
+            ->default_value(std::vector<uint64_t>{64, 256, 1024},
+                            "64 256 1024"),
+        "Provide the circuit sizes (for example: -c 64 256 1024)")(
         "verbose,v", po::value<bool>(&verbose)->default_value(false),
         "Enable libff log");
 
@@ -42,6 +49,15 @@ int main(int argc, char **argv)
       return -1;
     }
 
+    std::sort(counts.begin(), counts.end());
+    counts.erase(std::unique(counts.begin(), counts.end()), counts.end());
+    if (counts.empty() || counts.front() < 2)
+    {
+      std::cout << "count must be at least 2\n";
+      std::cout << options << std::endl;
+      return -1;
+    }
+
     fs::create_directories(output_path);
     if (!fs::is_directory(output_path))
     {
@@ -62,7 +78,11 @@ int main(int argc, char **argv)
   InitEcc();
   InitZkp(verbose);
 
-  GenerateAtomicSwapKeyPair(output_path, count);
+  for (auto count : counts)
+  {
+    std::cout << "Generate atomic_swap_vc keypair, count: " << count << "\n";
+    if (!GenerateAtomicSwapKeyPair(output_path, count)) return -1;
+  }
 
   return 0;
 }
@@ -2,8 +2,12 @@
 
 #include <stdint.h>
 #include <algorithm>
+#include <cstring>
 #include <functional>
+#include <map>
 #include <memory>
+#include <mutex>
+#include <string>
 
 #include <boost/endian/conversion.hpp>
 
@@ -38,6 +42,35 @@ inline G1 MultiExpGH(G1 const* g, Fr const* a, G1 const* h, Fr const* b,
   };
   return MultiExpBdlo12Inner<G1>(get_g, get_f, n * 2);
 }
+
+// L = <g[nn:], a[:nn]> + <h[:nn], b[nn:]>
+// R = <g[:nn], a[nn:]> + <h[nn:], b[:nn]>
+inline void MultiExpLR(G1 const* g, Fr const* a, G1 const* h, Fr const* b,
+                       size_t nn, G1& L, G1& R) {
+  size_t threads = ParallelConcurrency();
+  auto chunk_count = std::max<size_t>(1, std::min(threads, nn / 1024));
+
+  std::vector<G1> parts(chunk_count * 2);
+  ParallelFor(0, parts.size(), [&](int64_t t) {
+    size_t chunk = t / 2;
+    size_t begin = nn * chunk / chunk_count;
+    size_t end = nn * (chunk + 1) / chunk_count;
+    if (t % 2 == 0) {
+      parts[t] = MultiExpGH(g + nn + begin, a + begin, h + begin,
+                            b + nn + begin, end - begin);
+    } else {
+      parts[t] = MultiExpGH(g + begin, a + nn + begin, h + nn + begin,
+                            b + begin, end - begin);
+    }
+  });
+
+  L = G1Zero();
+  R = G1Zero();
+  for (size_t chunk = 0; chunk < chunk_count; ++chunk) {
+    L += parts[chunk * 2];
+    R += parts[chunk * 2 + 1];
+  }
+}
 }  // namespace detail
 
 class Challenge {
@@ -55,47 +88,101 @@ class Challenge {
   }
 
   uint64_t count() const { return count_; }
-  std::vector<Fr> const& x() const { return x_; }
-  std::vector<Fr> const& x_inverse() const { return x_inverse_; }
-  std::vector<Fr> const& x_square() const { return x_square_; }
-  std::vector<Fr> const& x_square_inverse() const { return x_square_inverse_; }
-  G1 const& u() const { return u_; }
-  bool zero_u() const { return u_ == G1Zero(); }
+  std::vector<Fr> const& x() const { return data_->x; }
+  std::vector<Fr> const& x_inverse() const { return data_->x_inverse; }
+  std::vector<Fr> const& x_square() const { return data_->x_square; }
+  std::vector<Fr> const& x_square_inverse() const {
+    return data_->x_square_inverse;
+  }
+  G1 const& u() const { return data_->u; }
+  bool zero_u() const { return data_->u == G1Zero(); }
 
  private:
+  struct Data {
+    std::vector<Fr> x;
+    std::vector<Fr> x_inverse;
+    std::vector<Fr> x_square;
+    std::vector<Fr> x_square_inverse;
+    G1 u;
+  };
+  typedef std::shared_ptr<Data const> DataPtr;
+
+  // The prover and the verifier (and every key column of a table) derive
+  // the same challenge, so keep the recent ones.
+  struct Cache {
+    std::mutex mutex;
+    std::map<std::string, DataPtr> items;
+  };
+
+  static Cache& GetCache() {
+    static Cache cache;
+    return cache;
+  }
+
   void Init(uint8_t const* seed, uint64_t size, bool zero_u) {
+    // cache key: seed || count || zero_u
+    std::string key((char const*)seed, size);
+    auto count_big = boost::endian::native_to_big(count_);
+    key.append((char const*)&count_big, sizeof(count_big));
+    key.push_back(zero_u ? 1 : 0);
+
+    auto& cache = GetCache();
+    {
+      std::lock_guard<std::mutex> lock(cache.mutex);
+      auto it = cache.items.find(key);
+      if (it != cache.items.end()) {
+        data_ = it->second;
+        return;
+      }
+    }
+
+    data_ = Build(seed, size, zero_u);
+
+    std::lock_guard<std::mutex> lock(cache.mutex);
+    if (cache.items.size() >= 256) cache.items.clear();
+    cache.items[key] = data_;
+  }
+
+  DataPtr Build(uint8_t const* seed, uint64_t size, bool zero_u) const {
     Tick tick(__FUNCTION__);
     using namespace detail;
     auto x_count = PackXCount(count_);
-    x_.resize(x_count);
-    x_inverse_.resize(x_count);
-    x_square_.resize(x_count);
-    x_square_inverse_.resize(x_count);
+    auto data = std::make_shared<Data>();
+    data->x.resize(x_count);
+    data->x_square.resize(x_count);
+    data->x_square_inverse.resize(x_count);
+
+    // transcript: seed || be64(i) || tag
+    std::vector<uint8_t> buf(size + sizeof(uint64_t) + 1);
+    memcpy(buf.data(), seed, size);
+    uint8_t* pi = buf.data() + size;
+    buf.back() = 'x';
+    for (uint64_t i = 0; i < x_count; ++i) {
+      auto i_big = boost::endian::native_to_big(i);
+      memcpy(pi, &i_big, sizeof(i_big));
+      data->x[i] = MapToFr(buf.data(), buf.size());
+      Fr::sqr(data->x_square[i], data->x[i]);
+    }
 
-    std::string str_seed((char const*)seed, size);
+    data->x_inverse = data->x;
+    if (x_count) FrInv(data->x_inverse);
     for (uint64_t i = 0; i < x_count; ++i) {
-      auto str_x = str_seed + "_" + std::to_string(i) + "_x";
-      x_[i] = StrHashToFr(str_x);
-      Fr::inv(x_inverse_[i], x_[i]);
-      Fr::sqr(x_square_[i], x_[i]);
-      Fr::inv(x_square_inverse_[i], x_square_[i]);
+      Fr::sqr(data->x_square_inverse[i], data->x_inverse[i]);
     }
 
     if (zero_u) {
-      u_ = G1Zero();
+      data->u = G1Zero();
     } else {
-      auto str_u = str_seed + "_u";
-      u_ = MapToG1(str_u);
+      buf.resize(size + 1);
+      buf.back() = 'u';
+      data->u = MapToG1(buf.data(), buf.size());
     }
+    return data;
   }
 
  private:
   uint64_t const count_;
-  std::vector<Fr> x_;
-  std::vector<Fr> x_inverse_;
-  std::vector<Fr> x_square_;
-  std::vector<Fr> x_square_inverse_;
-  G1 u_;
+  DataPtr data_;
 };
 
 struct P1Committment {
@@ -263,55 +350,37 @@ P2Proof P2Prove(P1Committment const& p1_committment, GET_G const& get_g,
   uint64_t count = challenge.count();
   bool zero_u = challenge.zero_u();
   auto g_count = PackGCount(count);
-  std::vector<Fr> a, b;
-  a.reserve(g_count);
-  b.reserve(g_count);
-  for (size_t i = 0; i < g_count; ++i) {
-    a.push_back(get_f(i));
-    b.push_back(get_f(i + g_count));
-  }
 
-  std::vector<G1> g, h;
-  g.reserve(g_count);
-  h.reserve(g_count);
+  // The vectors are folded in place. Instead of
+  //   g' = g_lo * x^-1 + g_hi * x,   h' = h_lo * x + h_hi * x^-1
+  //   a' = a_lo * x + a_hi * x^-1,   b' = b_lo * x^-1 + b_hi * x
+  // we keep G = g / k, H = h * k, A = a * k, B = b / k with k = prod(x^-1),
+  //   G' = G_lo + G_hi * x^2,        H' = H_lo + H_hi * x^-2
+  //   A' = A_lo + A_hi * x^-2,       B' = B_lo + B_hi * x^2
+  // so every element costs one multiplication. The L, R and <a, b> do not
+  // change because the k cancels out.
+  std::vector<Fr> a(g_count), b(g_count);
+  std::vector<G1> g(g_count), h(g_count);
   for (size_t i = 0; i < g_count; ++i) {
-    g.push_back(get_g(i));
-    h.push_back(get_g(i + g_count));
+    a[i] = get_f(i);
+    b[i] = get_f(i + g_count);
+    g[i] = get_g(i);
+    h[i] = get_g(i + g_count);
   }
 
   p2_proof.q = p1_committment.q(challenge.u());
 
-  G1 p = p2_proof.q;
-
   p2_proof.left.resize(challenge.x().size());
   p2_proof.right.resize(challenge.x().size());
+  auto nn = g_count;
   for (size_t loop = 0; loop < challenge.x().size(); ++loop) {
-    auto const& x = challenge.x()[loop];
-    auto const& x_inverse = challenge.x_inverse()[loop];
     auto const& x_square = challenge.x_square()[loop];
     auto const& x_square_inverse = challenge.x_square_inverse()[loop];
 
-    auto nn = g.size() / 2;
+    nn /= 2;
 
     G1 L, R;
-    if (nn >= (1024 * 32)) {
-#ifdef MULTICORE
-#pragma omp parallel sections
-#endif
-      {
-#ifdef MULTICORE
-#pragma omp section
-#endif
-        { L = MultiExpGH(&g[nn], &a[0], &h[0], &b[nn], nn); }
-#ifdef MULTICORE
-#pragma omp section
-#endif
-        { R = MultiExpGH(&g[0], &a[nn], &h[nn], &b[0], nn); }
-      }
-    } else {
-      L = MultiExpGH(&g[nn], &a[0], &h[0], &b[nn], nn);
-      R = MultiExpGH(&g[0], &a[nn], &h[nn], &b[0], nn);
-    }
+    MultiExpLR(g.data(), a.data(), h.data(), b.data(), nn, L, R);
 
     if (!zero_u) {
       auto CL = InnerProduct(&a[0], &b[nn], nn);
@@ -320,151 +389,119 @@ P2Proof P2Prove(P1Committment const& p1_committment, GET_G const& get_g,
       R += challenge.u() * CR;
     }
 
-    std::vector<G1> gg;
-    gg.resize(nn);
-// very slow
-#ifdef MULTICORE
-#pragma omp parallel for
-#endif
-    for (int64_t i = 0; i < (int64_t)nn; ++i) {
-      gg[i] = MultiExp(g[i], x_inverse, g[nn + i], x);
-    }
-
-    std::vector<G1> hh;
-    hh.resize(nn);
-// very slow
-#ifdef MULTICORE
-#pragma omp parallel for
-#endif
-    for (int64_t i = 0; i < (int64_t)nn; ++i) {
-      hh[i] = MultiExp(h[i], x, h[nn + i], x_inverse);
-    }
-
-    auto pp = p + MultiExp(L, x_square, R, x_square_inverse);
-
-    std::vector<Fr> aa;
-    aa.resize(nn);
-#ifdef MULTICORE
-#pragma omp parallel for
-#endif
-    for (int64_t i = 0; i < (int64_t)nn; ++i) {
-      aa[i] = a[i] * x + a[nn + i] * x_inverse;
-    }
-
-    std::vector<Fr> bb;
-    bb.resize(nn);
-#ifdef MULTICORE
-#pragma omp parallel for
-#endif
-    for (int64_t i = 0; i < (int64_t)nn; ++i) {
-      bb[i] = b[i] * x_inverse + b[nn + i] * x;
-    }
-
-    g.swap(gg);
-    h.swap(hh);
-    p = pp;
-    a.swap(aa);
-    b.swap(bb);
+    ParallelFor(0, nn, [&](int64_t i) {
+      G1 temp;
+      G1::mul(temp, g[nn + i], x_square);
+      G1::add(g[i], g[i], temp);
+      G1::mul(temp, h[nn + i], x_square_inverse);
+      G1::add(h[i], h[i], temp);
+      a[i] += a[nn + i] * x_square_inverse;
+      b[i] += b[nn + i] * x_square;
+    });
 
     p2_proof.left[loop] = L;
     p2_proof.right[loop] = R;
   }
 
-  assert(g.size() == 1 && h.size() == 1);
-  assert(a.size() == 1 && b.size() == 1);
+  assert(nn == 1);
 
-  p2_proof.a = a[0];
-  p2_proof.b = b[0];
+  // a = A / k, b = B * k
+  Fr k_inverse = Fr::one();
+  for (auto const& x : challenge.x()) k_inverse *= x;
+  p2_proof.a = a[0] * k_inverse;
+  p2_proof.b = b[0] * FrInv(k_inverse);
   return p2_proof;
 }
 
-template <typename GET_G>
-bool P2Verify(P1Committment const& p1_committment, GET_G const& get_g,
-              P2Proof const& p2_proof, Challenge const& challenge) {
-  Tick tick(__FUNCTION__);
+namespace detail {
+// ss[i] = prod(bit_j(i) ? x[j] : x_inverse[j]), the bit of x[0] is the msb.
+// Flipping all bits inverts every factor, so 1/ss[i] == ss[g_count - 1 - i].
+inline void BuildS(Challenge const& challenge, std::vector<Fr>& ss) {
+  auto const& x = challenge.x();
+  auto const& x_inverse = challenge.x_inverse();
+  auto g_count = PackGCount(challenge.count());
+  assert(g_count == ((size_t)1 << x.size()));
+  ss.resize(g_count);
+  ss[0] = Fr::one();
+  size_t len = 1;
+  for (size_t j = 0; j < x.size(); ++j, len *= 2) {
+    for (size_t i = len; i-- > 0;) {
+      Fr si = ss[i];
+      ss[2 * i] = si * x_inverse[j];
+      ss[2 * i + 1] = si * x[j];
+    }
+  }
+}
+}  // namespace detail
+
+// Append the terms of
+//   <ss * a, g> + <ss^-1 * b, h> + u * (a * b - c) - p - <x^2, L> - <x^-2, R>
+// scaled by weight, which is zero iff P2Verify() passes. The coefficients of
+// g and h are returned in g_coeff (indexed like get_g), the others are
+// appended to bases and coeffs.
+inline bool AddP2VerifyTerms(P1Committment const& p1_committment,
+                             P2Proof const& p2_proof,
+                             Challenge const& challenge, Fr const& weight,
+                             std::vector<Fr>& g_coeff, std::vector<G1>& bases,
+                             std::vector<Fr>& coeffs) {
   using namespace detail;
   uint64_t count = challenge.count();
   auto g_count = PackGCount(count);
   auto x_count = PackXCount(count);
-  // std::cout << "proof.p: " << proof.p << std::endl;
-  // std::cout << "proof.a: " << proof.a << std::endl;
-  // std::cout << "proof.b: " << proof.b << std::endl;
-  // std::cout << "challenge: " << challenge_seed << std::endl;
-
-  auto const& u = challenge.u();
-  G1 p = p1_committment.q(u);
 
-  assert(p2_proof.left.size() == x_count && p2_proof.right.size() == x_count);
   if (p2_proof.left.size() != x_count || p2_proof.right.size() != x_count)
     return false;
 
-  auto const& x = challenge.x();
-  auto const& x_inverse = challenge.x_inverse();
-  auto const& x_square = challenge.x_square();
-  auto const& x_square_inverse = challenge.x_square_inverse();
-
-  std::vector<G1> g, h;
-  g.resize(g_count);
-  h.resize(g_count);
-  for (size_t i = 0; i < g_count; ++i) {
-    g[i] = get_g(i);
-    h[i] = get_g(i + g_count);
-  }
-
-  // true: 1; false: -1
-  auto get_b = [x_count](size_t i, size_t j) -> bool {
-    auto pow_j = (size_t)1 << (x_count - 1 - j);
-    return (i & pow_j) ? true : false;
-  };
-
   std::vector<Fr> ss;
-  std::vector<Fr> ss_inverse;
-  ss.resize(g_count);
-  ss_inverse.resize(g_count);
-
-#ifdef MULTICORE
-#pragma omp parallel for
-#endif
-  for (int64_t i = 0; i < (int64_t)g_count; ++i) {
-    ss[i] = Fr::one();
-    for (size_t j = 0; j < x_count; ++j) {
-      auto b = get_b(i, j);
-      assert(!x[j].isZero());
-      ss[i] = ss[i] * (b ? x[j] : x_inverse[j]);
-    }
-    Fr::inv(ss_inverse[i], ss[i]);
+  BuildS(challenge, ss);
+
+  Fr wa = weight * p2_proof.a;
+  Fr wb = weight * p2_proof.b;
+  g_coeff.resize(g_count * 2);
+  ParallelFor(0, g_count, [&](int64_t i) {
+    g_coeff[i] = ss[i] * wa;
+    g_coeff[g_count + i] = ss[g_count - 1 - i] * wb;
+  });
+
+  bases.push_back(challenge.u());
+  coeffs.push_back(weight * (p2_proof.a * p2_proof.b - p1_committment.c));
+
+  bases.push_back(p1_committment.p);
+  coeffs.push_back(-weight);
+
+  for (size_t i = 0; i < x_count; ++i) {
+    bases.push_back(p2_proof.left[i]);
+    coeffs.push_back(-weight * challenge.x_square()[i]);
+    bases.push_back(p2_proof.right[i]);
+    coeffs.push_back(-weight * challenge.x_square_inverse()[i]);
   }
+  return true;
+}
 
-  G1 last_g, last_h;
-
-#ifdef MULTICORE
-#pragma omp parallel sections
-#endif
-
-  {
-#ifdef MULTICORE
-#pragma omp section
-#endif
-    { last_g = MultiExpBdlo12(&g[0], &ss[0], g_count); }
+template <typename GET_G>
+bool P2Verify(P1Committment const& p1_committment, GET_G const& get_g,
+              P2Proof const& p2_proof, Challenge const& challenge) {
+  Tick tick(__FUNCTION__);
 
-#ifdef MULTICORE
-#pragma omp section
-#endif
-    { last_h = MultiExpBdlo12(&h[0], &ss_inverse[0], g_count); }
+  std::vector<Fr> g_coeff;
+  std::vector<G1> bases;
+  std::vector<Fr> coeffs;
+  if (!AddP2VerifyTerms(p1_committment, p2_proof, challenge, Fr::one(),
+                        g_coeff, bases, coeffs)) {
+    assert(false);
+    return false;
   }
 
-  G1 out = MultiExp(last_g, p2_proof.a, last_h, p2_proof.b);
-
-  out += u * (p2_proof.a * p2_proof.b);
-
-  if (x_count) {
-    p += MultiExpGH(&p2_proof.left[0], &x_square[0], &p2_proof.right[0],
-                    &x_square_inverse[0], x_count);
-  }
+  auto n = g_coeff.size();
+  auto get_all_g = [&get_g, &bases, n](size_t i) -> G1 {
+    return i < n ? G1(get_g(i)) : bases[i - n];
+  };
+  auto get_all_f = [&g_coeff, &coeffs, n](size_t i) -> Fr const& {
+    return i < n ? g_coeff[i] : coeffs[i - n];
+  };
+  G1 out = MultiExpBdlo12Inner<G1>(get_all_g, get_all_f, n + bases.size());
 
-  // std::cout << "out: " << out << std::endl;
-  // std::cout << "p: " << p << std::endl;
-  bool ret = out == p;
+  bool ret = out.isZero();
   assert(ret);
   return ret;
 }
@@ -51,5 +51,82 @@ bool LoadBulletin(std::string const& input, Bulletin& bulletin) {
     return false;
   }
 }
+
+bool IsManifestValid(Manifest const& manifest, Bulletin const& bulletin) {
+  auto shard_rows = manifest.shard_rows;
+  if (!shard_rows || (shard_rows & (shard_rows - 1))) return false;
+  if (manifest.shards.empty() || manifest.s != bulletin.s) return false;
+  if (manifest.s < 2) return false;
+
+  auto column_size = manifest.s - 1;
+  auto shard_size = shard_rows * column_size * 31;
+  uint64_t size = 0;
+  uint64_t n = 0;
+  std::vector<h256_t> roots;
+  for (size_t i = 0; i < manifest.shards.size(); ++i) {
+    auto const& shard = manifest.shards[i];
+    bool last = i + 1 == manifest.shards.size();
+    if (!shard.n || shard.n > shard_rows) return false;
+    if (!last && (shard.n != shard_rows || shard.size != shard_size)) {
+      return false;
+    }
+    if (shard.n != GetDataBlockCount(shard.size, column_size)) return false;
+    size += shard.size;
+    n += shard.n;
+    roots.push_back(shard.sigma_mkl_root);
+  }
+  if (size != bulletin.size || n != bulletin.n) return false;
+
+  auto root = mkl::MergeRoots(roots, shard_rows, manifest.shards.back().n);
+  return root == bulletin.sigma_mkl_root;
+}
+
+bool SaveManifest(std::string const& output, Manifest const& manifest) {
+  try {
+    pt::ptree tree;
+    tree.put("mode", "plain");
+    tree.put("s", manifest.s);
+    tree.put("shard_rows", manifest.shard_rows);
+    pt::ptree shards;
+    for (auto const& shard : manifest.shards) {
+      pt::ptree node;
+      node.put("path", shard.path);
+      node.put("size", shard.size);
+      node.put("n", shard.n);
+      node.put("sigma_mkl_root", misc::HexToStr(shard.sigma_mkl_root));
+      shards.push_back(std::make_pair("", node));
+    }
+    tree.add_child("shards", shards);
+    pt::write_json(output, tree);
+    return true;
+  } catch (std::exception&) {
+    assert(false);
+    return false;
+  }
+}
+
+bool LoadManifest(std::string const& input, Manifest& manifest) {
+  try {
+    pt::ptree tree;
+    pt::read_json(input, tree);
+    if (tree.get<std::string>("mode") != "plain") return false;
+    manifest.s = tree.get<uint64_t>("s");
+    manifest.shard_rows = tree.get<uint64_t>("shard_rows");
+    manifest.shards.clear();
+    for (auto const& i : tree.get_child("shards")) {
+      Shard shard;
+      shard.path = i.second.get<std::string>("path");
+      shard.size = i.second.get<uint64_t>("size");
+      shard.n = i.second.get<uint64_t>("n");
+      misc::HexStrToH256(i.second.get<std::string>("sigma_mkl_root"),
+                         shard.sigma_mkl_root);
+      manifest.shards.push_back(std::move(shard));
+    }
+    return true;
+  } catch (std::exception&) {
+    assert(false);
+    return false;
+  }
+}
 }  // namespace plain
 }  // namespace scheme
\ No newline at end of file
@@ -21,5 +21,28 @@ bool SaveBulletin(std::string const& output, Bulletin const& bulletin);
 
 bool LoadBulletin(std::string const& input, Bulletin& bulletin);
 
+// a dataset merged from shards published one by one, the shard i holds the
+// rows [i * shard_rows, i * shard_rows + shards[i].n) of the merged bulletin
+struct Shard {
+  std::string path;  // the publish path of the shard
+  uint64_t size;
+  uint64_t n;
+  h256_t sigma_mkl_root;
+};
+
+struct Manifest {
+  uint64_t s;
+  uint64_t shard_rows;  // power of 2
+  std::vector<Shard> shards;
+};
+
+// the shards must cover the bulletin and their roots must merge into the
+// sigma_mkl_root of the bulletin
+bool IsManifestValid(Manifest const& manifest, Bulletin const& bulletin);
+
+bool SaveManifest(std::string const& output, Manifest const& manifest);
+
+bool LoadManifest(std::string const& input, Manifest& manifest);
+
 }  // namespace plain
 }  // namespace scheme
\ No newline at end of file
@@ -15,6 +15,7 @@ G1 HashNameI(h256_t const& name, uint64_t i) {
 Fr ChainKeccak256(uint8_t const* seed_buf, uint64_t seed_len, uint64_t index) {
   uint64_t index_be = boost::endian::native_to_big(index);
 
+  trace::Count(trace::kHashBytes, seed_len + sizeof(index_be));
   h256_t digest_be;
   CryptoPP::Keccak_256 hash;
   hash.Update(seed_buf, seed_len);
@@ -45,12 +46,9 @@ void ChainKeccak256(h256_t const& seed, uint64_t count, std::vector<Fr>& v) {
   Tick _tick_(__FUNCTION__);
   v.resize(count);
 
-#ifdef MULTICORE
-#pragma omp parallel for
-#endif
-  for (int64_t i = 0; i < (int64_t)count; ++i) {
+  ParallelFor(0, count, [&](int64_t i) {
     v[i] = ChainKeccak256(seed, i);
-  }
+  });
 }
 
 Fr ChainMimcInv(Fr const& seed, uint64_t index) {
@@ -61,12 +59,9 @@ void ChainMimcInv(Fr const& seed, uint64_t count, std::vector<Fr>& v) {
   Tick _tick_(__FUNCTION__);
   v.resize(count);
 
-#ifdef MULTICORE
-#pragma omp parallel for
-#endif
-  for (uint64_t i = 0; i < count; ++i) {
+  ParallelFor(0, count, [&](int64_t i) {
     v[i] = ChainMimcInv(seed, i);
-  }
+  });
 }
 
 // inline uint32_t ChainUint32(h256_t const& seed, uint64_t index) {
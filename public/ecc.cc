@@ -1,16 +1,66 @@
 #include "ecc.h"
 
+#include <atomic>
+
 #include <cryptopp/keccak.h>
-#include <cryptopp/osrng.h>
 #include <cryptopp/sha.h>
 
 #include "ecc_pub.h"
 #include "msvc_hack.h"
+#include "rng.h"
+#include "task.h"
 
 namespace {
-// NOTE: NonblockingRng should enough for linux & windows
-// thread_local CryptoPP::AutoSeededRandomPool rng;
-thread_local CryptoPP::NonblockingRng rng;
+thread_local bool g1_wire_uncompressed = false;
+
+const size_t kNormalizeChunk = 1024;
+
+// Montgomery's trick, the inverse of the product gives every inverse z
+void NormalizeChunk(G1* g, size_t n) {
+  std::vector<Fp> prefix;
+  std::vector<size_t> index;
+  prefix.reserve(n);
+  index.reserve(n);
+  Fp product = 1;
+  for (size_t i = 0; i < n; ++i) {
+    if (g[i].isZero() || g[i].isNormalized()) continue;
+    prefix.push_back(product);
+    index.push_back(i);
+    product *= g[i].z;
+  }
+  if (index.empty()) return;
+
+  Fp inv;
+  Fp::inv(inv, product);
+  for (size_t k = index.size(); k-- > 0;) {
+    G1& p = g[index[k]];
+    Fp z_inv = inv * prefix[k];
+    inv *= p.z;
+    if (G1::mode_ == mcl::ec::Jacobi) {
+      Fp z2_inv;
+      Fp::sqr(z2_inv, z_inv);
+      p.x *= z2_inv;
+      p.y *= z2_inv * z_inv;
+    } else {
+      p.x *= z_inv;
+      p.y *= z_inv;
+    }
+    p.z = 1;
+  }
+}
+
+// f(points, buf offset in points, count) on normalized copies of each chunk
+template <typename F>
+void ForEachNormalizedChunk(G1 const* g, size_t n, F const& f) {
+  int64_t chunks = (n + kNormalizeChunk - 1) / kNormalizeChunk;
+  ParallelFor(0, chunks, [g, n, &f](int64_t c) {
+    size_t begin = c * kNormalizeChunk;
+    size_t end = std::min(n, begin + kNormalizeChunk);
+    std::vector<G1> a(g + begin, g + end);
+    NormalizeChunk(a.data(), a.size());
+    f(a.data(), begin, a.size());
+  });
+}
 }  // namespace
 
 void InitEcc() {
@@ -24,7 +74,7 @@ void InitEcc() {
 
 void FpRand(Fp* f) {
   uint8_t buf[32];
-  rng.GenerateBlock(buf, 32);
+  rng::Fill(buf, 32);
   f->setArrayMask(buf, 32);
 }
 
@@ -38,7 +88,7 @@ Fp2 Fp2Rand() { return Fp2(FpRand(), FpRand()); }
 
 void FrRand(Fr* f) {
   uint8_t buf[32];
-  rng.GenerateBlock(buf, 32);
+  rng::Fill(buf, 32);
   f->setArrayMask(buf, 32);
 }
 
@@ -50,38 +100,21 @@ Fr FrRand() {
 
 void FrRand(Fr* r, size_t n) {
   std::vector<uint8_t> h(n * 32);
+  rng::Fill(h.data(), h.size());
 
-#ifdef MULTICORE
-#pragma omp parallel for
-#endif
-  for (size_t i = 0; i < 4; ++i) {
-    rng.GenerateBlock(h.data() + 8 * i * n, 8 * n);
-  }
-
-#ifdef MULTICORE
-#pragma omp parallel for
-#endif
-  for (size_t i = 0; i < n; ++i) {
+  ParallelFor(0, n, [r, &h](int64_t i) {
     r[i].setArrayMask(h.data() + i * 32, 32);
-  }
+  });
 }
 
 void FrRand(std::vector<Fr*>& f) {
   auto n = f.size();
   std::vector<uint8_t> h(n * 32);
-#ifdef MULTICORE
-#pragma omp parallel for
-#endif
-  for (size_t i = 0; i < 4; ++i) {
-    rng.GenerateBlock(h.data() + 8 * i * n, 8 * n);
-  }
+  rng::Fill(h.data(), h.size());
 
-#ifdef MULTICORE
-#pragma omp parallel for
-#endif
-  for (size_t i = 0; i < f.size(); ++i) {
+  ParallelFor(0, n, [&f, &h](int64_t i) {
     f[i]->setArrayMask(h.data() + i * 32, 32);
-  }
+  });
 }
 
 Fr FrInv(Fr const& r) {
@@ -247,8 +280,18 @@ G1 MultiExp(G1 const* g, Fr const* f, size_t n) {
 }
 
 // a * g + b * g
+G1 G1Exp(G1 const& g, Fr const& f) {
+  trace::Count(trace::kG1Exp);
+  return g * f;
+}
+
+G2 G2Exp(G2 const& g, Fr const& f) {
+  trace::Count(trace::kG2Exp);
+  return g * f;
+}
+
 G1 MultiExp(G1 const& g, Fr const& a, G1 const& h, Fr const& b) {
-  return g * a + h * b;
+  return G1Exp(g, a) + G1Exp(h, b);
 }
 
 G1 MultiExp(G1 const* g, Fr const* a, G1 const* h, Fr const* b, size_t n) {
@@ -295,6 +338,32 @@ Fr BinToFr31(void const* start, void const* end) {
   return fr;
 }
 
+void BinToFr31(uint8_t const* data, uint64_t len, Fr* fr, uint64_t n) {
+  // the 31 bytes go into the low bytes of a zeroed 32 bytes buffer, which is
+  // the little endian array of the fr limbs
+  uint8_t buf[32] = {0};
+  for (uint64_t i = 0; i < n; ++i) {
+    uint64_t offset = i * 31;
+    if (offset >= len) {
+      fr[i].clear();
+      continue;
+    }
+    auto size = std::min<uint64_t>(31, len - offset);
+    memcpy(buf, data + offset, size);
+    if (size < 31) memset(buf + size, 0, 31 - size);
+    fr[i].setArrayMask(buf, 32);  // < 2^248, never masked
+  }
+}
+
+bool FrToBin31(Fr const* fr, uint64_t n, uint8_t* buf) {
+  uint8_t bin[32];
+  for (uint64_t i = 0; i < n; ++i) {
+    if (fr[i].serialize(bin, 32) != 32 || bin[31]) return false;
+    memcpy(buf + i * 31, bin, 31);
+  }
+  return true;
+}
+
 // the buffer of start must >= 32
 bool BinToFr32(void const* start, Fr* fr) {
   return fr->deserialize(start, 32) == 32;
@@ -346,6 +415,16 @@ G1 BinToG1(uint8_t const* buf) {
   throw std::runtime_error("");
 }
 
+// buf must n * 32 bytes, the points are decompressed in parallel
+bool BinToG1(uint8_t const* buf, G1* g, size_t n) {
+  std::atomic<int> failed{0};
+  ParallelFor(0, n, [buf, g, &failed](int64_t i) {
+    if (failed) return;
+    if (!BinToG1(buf + i * 32, g + i)) ++failed;
+  });
+  return failed == 0;
+}
+
 // buf must 32 bytes
 void G1ToBin(G1 const& g, uint8_t* buf) {
   if (g.serialize(buf, 32) != 32) throw std::runtime_error("");
@@ -357,6 +436,73 @@ h256_t G1ToBin(G1 const& g) {
   return r;
 }
 
+// buf must 64 bytes
+void G1ToBinUncompressed(G1 const& g, uint8_t* buf) {
+  if (g.isZero()) {
+    memset(buf, 0, 64);
+    return;
+  }
+  G1 a(g);
+  a.normalize();
+  if (a.x.serialize(buf, 32) != 32 || a.y.serialize(buf + 32, 32) != 32)
+    throw std::runtime_error("");
+}
+
+void G1Normalize(G1* g, size_t n) {
+  int64_t chunks = (n + kNormalizeChunk - 1) / kNormalizeChunk;
+  ParallelFor(0, chunks, [g, n](int64_t c) {
+    size_t begin = c * kNormalizeChunk;
+    size_t end = std::min(n, begin + kNormalizeChunk);
+    NormalizeChunk(g + begin, end - begin);
+  });
+}
+
+// buf must n * 32 bytes
+void G1ToBin(G1 const* g, uint8_t* buf, size_t n) {
+  ForEachNormalizedChunk(g, n, [buf](G1 const* a, size_t begin, size_t count) {
+    for (size_t i = 0; i < count; ++i) G1ToBin(a[i], buf + (begin + i) * 32);
+  });
+}
+
+// buf must n * 64 bytes
+void G1ToBinUncompressed(G1 const* g, uint8_t* buf, size_t n) {
+  ForEachNormalizedChunk(g, n, [buf](G1 const* a, size_t begin, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+      G1ToBinUncompressed(a[i], buf + (begin + i) * 64);
+    }
+  });
+}
+
+// buf must 64 bytes
+bool BinToG1Uncompressed(uint8_t const* buf, G1* g) {
+  if (std::all_of(buf, buf + 64, [](uint8_t c) { return c == 0; })) {
+    g->clear();
+    return true;
+  }
+  if (g->x.deserialize(buf, 32) != 32) return false;
+  if (g->y.deserialize(buf + 32, 32) != 32) return false;
+  g->z = 1;
+  return g->isValid();
+}
+
+// buf must n * 64 bytes
+bool BinToG1Uncompressed(uint8_t const* buf, G1* g, size_t n) {
+  std::atomic<int> failed{0};
+  ParallelFor(0, n, [buf, g, &failed](int64_t i) {
+    if (failed) return;
+    if (!BinToG1Uncompressed(buf + i * 64, g + i)) ++failed;
+  });
+  return failed == 0;
+}
+
+G1WireScope::G1WireScope(bool uncompressed) : old_(g1_wire_uncompressed) {
+  g1_wire_uncompressed = uncompressed;
+}
+
+G1WireScope::~G1WireScope() { g1_wire_uncompressed = old_; }
+
+bool G1WireUncompressed() { return g1_wire_uncompressed; }
+
 bool StrToG1(std::string const& s, G1* g) {
   try {
     g->setStr(s);
@@ -386,6 +532,16 @@ G2 BinToG2(uint8_t const* buf) {
   throw std::runtime_error("");
 }
 
+// buf must n * 64 bytes, the points are decompressed in parallel
+bool BinToG2(uint8_t const* buf, G2* g, size_t n) {
+  std::atomic<int> failed{0};
+  ParallelFor(0, n, [buf, g, &failed](int64_t i) {
+    if (failed) return;
+    if (!BinToG2(buf + i * 64, g + i)) ++failed;
+  });
+  return failed == 0;
+}
+
 // buf must 64 bytes
 void G2ToBin(G2 const& g, uint8_t* buf) {
   if (g.serialize(buf, 64) != 64) throw std::runtime_error("");
@@ -412,6 +568,7 @@ std::string G2ToStr(G2 const& g) { return g.getStr(); }
 // very fast if fr is uint64/uint32
 G1 MultiExpBosCoster(std::function<G1(size_t)> const& get_g,
                      std::function<Fr(size_t)> const& get_f, size_t n) {
+  trace::Count(trace::kMultiExpPoints, n);
   if (n == 0) return G1Zero();
   if (n == 1) return get_g(0) * get_f(0);
 
@@ -524,6 +681,7 @@ G1 MultiExpBosCoster(G1 const* pg, Fr const* pf, size_t n) {
 
 // e(a, G2One()) == e(c, d)
 bool PairingMatch(G1 const& a, G1 const& c, G2 const& d) {
+  trace::Count(trace::kPairings, 2);
   auto const& ecc_pub = GetEccPub();
   Fp12 e1;
   mcl::bn256::precomputedMillerLoop(e1, a, ecc_pub.g2_1_coeff());
@@ -536,6 +694,7 @@ bool PairingMatch(G1 const& a, G1 const& c, G2 const& d) {
 
 // e(a, b) == e(c, d)
 bool PairingMatch(G1 const& a, G2 const& b, G1 const& c, G2 const& d) {
+  trace::Count(trace::kPairings, 2);
   Fp12 e1, e2;
   mcl::bn256::pairing(e1, a, b);
   mcl::bn256::pairing(e2, c, d);
@@ -543,6 +702,55 @@ bool PairingMatch(G1 const& a, G2 const& b, G1 const& c, G2 const& d) {
   return (e1 == e2);
 }
 
+namespace {
+size_t constexpr kFp12BinSize = 32 * 12;
+
+// buf must be g1.size() * kFp12BinSize bytes
+bool PairingToBin(std::vector<G1> const& g1, G2 const& g2, uint8_t* buf,
+                  TaskLoop* loop) {
+  trace::Count(trace::kPairings, g1.size());
+  std::vector<Fp6> g2_coeff;
+  mcl::bn256::precomputeG2(g2_coeff, g2);
+
+  ParallelFor(0, g1.size(), [&g1, &g2_coeff, buf, loop](int64_t i) {
+    if (loop && !loop->Step()) return;
+    Fp12 e;
+    mcl::bn256::precomputedMillerLoop(e, g1[i], g2_coeff);
+    mcl::bn256::finalExp(e, e);
+    auto ret_len = e.serialize(buf + i * kFp12BinSize, kFp12BinSize);
+    if (ret_len != kFp12BinSize) {
+      assert(false);
+      throw std::runtime_error("oops");
+    }
+  });
+  return !loop || !loop->cancelled();
+}
+}  // namespace
+
+bool PairingToFr(std::vector<G1> const& g1, G2 const& g2, std::vector<Fr>& fr,
+                 TaskLoop* loop) {
+  std::vector<uint8_t> buf(g1.size() * kFp12BinSize);
+  if (!PairingToBin(g1, g2, buf.data(), loop)) return false;
+
+  fr.resize(g1.size());
+  ParallelFor(0, fr.size(), [&fr, &buf](int64_t i) {
+    fr[i] = MapToFr(buf.data() + i * kFp12BinSize, kFp12BinSize);
+  });
+  return true;
+}
+
+bool PairingToG1(std::vector<G1> const& g1, G2 const& g2, std::vector<G1>& ge,
+                 TaskLoop* loop) {
+  std::vector<uint8_t> buf(g1.size() * kFp12BinSize);
+  if (!PairingToBin(g1, g2, buf.data(), loop)) return false;
+
+  ge.resize(g1.size());
+  ParallelFor(0, ge.size(), [&ge, &buf](int64_t i) {
+    ge[i] = MapToG1(buf.data() + i * kFp12BinSize, kFp12BinSize);
+  });
+  return true;
+}
+
 Fr FrPower(Fr const& base, mpz_class const& exp) {
   Fr z;
   Fr::pow(z, base, exp);
@@ -565,6 +773,7 @@ Fr FrPower(Fr const& base, mpz_class const& exp) {
 }
 
 Fr MapToFr(void const* b, size_t n) {
+  trace::Count(trace::kHashBytes, n);
   CryptoPP::Keccak_256 hash;
   h256_t digest;
   hash.Update((uint8_t const*)b, n);
@@ -21,6 +21,7 @@
 #include <mcl/window_method.hpp>
 
 #include "basic_types.h"
+#include "parallel.h"
 
 #ifdef _WIN32
 #pragma warning(pop)
@@ -96,6 +97,12 @@ Fr MapToFr(void const *b, size_t n);
 
 Fr MapToFr(uint64_t b);
 
+// g * f, counted in trace::kG1Exp
+G1 G1Exp(G1 const &g, Fr const &f);
+
+// g * f, counted in trace::kG2Exp
+G2 G2Exp(G2 const &g, Fr const &f);
+
 // inner product
 G1 MultiExp(G1 const *g, Fr const *f, size_t n);
 
@@ -114,6 +121,13 @@ Fr StrHashToFr(std::string const &s);
 // because the Fr is 254bits, so we only use 31bytes
 Fr BinToFr31(void const *start, void const *end);
 
+// n consecutive 31 bytes slices of data to fr, the bytes past len read as 0
+void BinToFr31(uint8_t const *data, uint64_t len, Fr *fr, uint64_t n);
+
+// the reverse, n * 31 bytes to buf. Return false if a fr does not fit in 31
+// bytes.
+bool FrToBin31(Fr const *fr, uint64_t n, uint8_t *buf);
+
 // the buffer of start must >= 32
 bool BinToFr32(void const *start, Fr *fr);
 
@@ -136,11 +150,48 @@ bool BinToG1(uint8_t const *buf, G1 *g);
 
 G1 BinToG1(uint8_t const *buf);
 
+// buf must n * 32 bytes
+bool BinToG1(uint8_t const *buf, G1 *g, size_t n);
+
 // buf must 32 bytes
 void G1ToBin(G1 const &g, uint8_t *buf);
 
 h256_t G1ToBin(G1 const &g);
 
+// buf must 64 bytes, affine x || y, the zero point is all zero
+void G1ToBinUncompressed(G1 const &g, uint8_t *buf);
+
+// one field inversion per chunk of points instead of one per point
+void G1Normalize(G1 *g, size_t n);
+
+// buf must n * 32 bytes, normalized in batches and compressed in parallel
+void G1ToBin(G1 const *g, uint8_t *buf, size_t n);
+
+// buf must n * 64 bytes
+void G1ToBinUncompressed(G1 const *g, uint8_t *buf, size_t n);
+
+// buf must 64 bytes, only checks that the point is on the curve
+bool BinToG1Uncompressed(uint8_t const *buf, G1 *g);
+
+// buf must n * 64 bytes
+bool BinToG1Uncompressed(uint8_t const *buf, G1 *g, size_t n);
+
+// the G1 vectors saved on this thread go out uncompressed on the binary
+// wire while a G1WireScope(true) is alive, default off. The receiver always
+// accepts both encodings.
+class G1WireScope {
+ public:
+  explicit G1WireScope(bool uncompressed);
+  ~G1WireScope();
+  G1WireScope(G1WireScope const &) = delete;
+  G1WireScope &operator=(G1WireScope const &) = delete;
+
+ private:
+  bool old_;
+};
+
+bool G1WireUncompressed();
+
 bool StrToG1(std::string const &s, G1 *g);
 
 // may throw
@@ -153,6 +204,9 @@ bool BinToG2(uint8_t const *buf, G2 *g);
 
 G2 BinToG2(uint8_t const *buf);
 
+// buf must n * 64 bytes
+bool BinToG2(uint8_t const *buf, G2 *g, size_t n);
+
 // buf must 64 bytes
 void G2ToBin(G2 const &g, uint8_t *buf);
 
@@ -172,6 +226,19 @@ bool PairingMatch(G1 const &a, G1 const &c, G2 const &d);
 
 bool PairingMatch(G1 const &a, G2 const &b, G1 const &c, G2 const &d);
 
+class TaskLoop;
+
+// fr[i] = MapToFr(e(g1[i], g2)), the g2 is precomputed only once. The loop
+// (may be null) steps once per pairing, return false if its task was
+// cancelled.
+bool PairingToFr(std::vector<G1> const &g1, G2 const &g2, std::vector<Fr> &fr,
+                 TaskLoop *loop = nullptr);
+
+// ge[i] = MapToG1(e(g1[i], g2)), the g2 is precomputed only once, returns
+// like PairingToFr
+bool PairingToG1(std::vector<G1> const &g1, G2 const &g2, std::vector<G1> &ge,
+                 TaskLoop *loop = nullptr);
+
 Fr FrPower(Fr const& base, mpz_class const& exp);
 
 inline bool operator==(G1WM const& a, G1WM const& b) {
@@ -57,12 +57,14 @@ class EccPub : boost::noncopyable {
   }
 
   G1 PowerG1(Fr const& f) const {
+    trace::Count(trace::kG1Exp);
     G1 ret;
     g1_wm_.mul(ret, f);
     return ret;
   }
 
   G2 PowerG2(Fr const& f) const {
+    trace::Count(trace::kG2Exp);
     G2 ret;
     g2_wm_.mul(ret, f);
     return ret;
@@ -71,6 +73,7 @@ class EccPub : boost::noncopyable {
   G1 PowerU1(uint64_t u_index, Fr const& f) const {
     if (u_index >= u1_wm_.size()) throw std::runtime_error("bad u_index");
     G1WM const& wm = u1_wm_[u_index];
+    trace::Count(trace::kG1Exp);
     G1 ret;
     wm.mul(ret, f);
     return ret;
@@ -79,6 +82,7 @@ class EccPub : boost::noncopyable {
   G2 PowerU2(uint64_t u_index, Fr const& f) const {
     if (u_index >= u2_wm_.size()) throw std::runtime_error("bad u_index");
     G2WM const& wm = u2_wm_[u_index];
+    trace::Count(trace::kG2Exp);
     G2 ret;
     wm.mul(ret, f);
     return ret;
@@ -1,10 +1,9 @@
 #pragma once
 
-#include <cryptopp/osrng.h>
-
 #include "basic_types.h"
 #include "mpz.h"
 #include "public.h"
+#include "rng.h"
 
 namespace misc {
 inline std::string HexToStr(void const* p, size_t len) {
@@ -48,10 +47,7 @@ std::array<uint8_t, T> StrToH(std::string const& s) {
   return ret;
 }
 
-inline void RandomBytes(uint8_t* x, uint64_t xlen) {
-  CryptoPP::NonblockingRng rng;  // CryptoPP::AutoSeededRandomPool rng;
-  rng.GenerateBlock(x, xlen);
-}
+inline void RandomBytes(uint8_t* x, uint64_t xlen) { rng::Fill(x, xlen); }
 
 inline h256_t RandH256() {
   h256_t ret;
@@ -9,7 +9,33 @@
 namespace mkl {
 h256_t kEmptyH256 = h256_t();
 
+namespace {
+// sorted, disjoint and inside [0, item_count)
+bool CheckRanges(std::vector<Range> const& ranges, uint64_t item_count) {
+  if (ranges.empty()) return false;
+  uint64_t end = 0;
+  for (auto const& range : ranges) {
+    if (!range.count || range.start < end || range.start >= item_count ||
+        range.count > item_count - range.start)
+      return false;
+    end = range.start + range.count;
+  }
+  return true;
+}
+
+// append to the sorted ranges, merge with the last one if they touch
+void AppendRange(std::vector<Range>& ranges, Range const& range) {
+  if (!ranges.empty() &&
+      ranges.back().start + ranges.back().count == range.start) {
+    ranges.back().count += range.count;
+  } else {
+    ranges.push_back(range);
+  }
+}
+}  // namespace
+
 void TwoToOne(h256_t const& a, h256_t const& b, h256_t* r) {
+  trace::Count(trace::kHashBytes, 64);
   CryptoPP::Keccak_256 hash;
   hash.Update(a.data(), 32);
   hash.Update(b.data(), 32);
@@ -295,7 +321,8 @@ Path GetRangePath(uint64_t item_count, GetItem const& get_item,
   if (tree.size() != GetTreeSize(item_count))
     throw std::runtime_error("invaild parameters");
 
-  if (tree.size() == 1) return path;  // empty
+  // a tree of 2 items has 1 node too
+  if (item_count == 1) return path;  // empty
 
   auto align_count = misc::Pow2UB(item_count);
   auto depth = misc::Log2UB(item_count);
@@ -340,4 +367,147 @@ Path GetRangePath(uint64_t item_count, GetItem const& get_item,
   return path;
 }
 
+// throw
+Path GetRangesPath(uint64_t item_count, GetItem const& get_item,
+                   Tree const& tree, std::vector<Range> const& ranges) {
+  Path path;
+  if (tree.size() != GetTreeSize(item_count) ||
+      !CheckRanges(ranges, item_count))
+    throw std::runtime_error("invaild parameters");
+
+  // a tree of 2 items has 1 node too
+  if (item_count == 1) return path;  // empty
+
+  auto align_count = misc::Pow2UB(item_count);
+  auto depth = misc::Log2UB(item_count);
+
+  // level 0 are the items, level l > 0 starts at align - (align >> (l - 1))
+  auto get_node = [align_count, item_count, &get_item, &tree](
+                      uint64_t level, uint64_t pos) -> h256_t {
+    if (level) return tree[align_count - (align_count >> (level - 1)) + pos];
+    if (pos >= item_count) return kEmptyH256;
+    return get_item(pos);
+  };
+
+  std::vector<Range> nodes;
+  for (auto const& range : ranges) AppendRange(nodes, range);
+
+  for (uint64_t level = 0; level < depth; ++level) {
+    std::vector<Range> parents;
+    for (auto const& r : nodes) {
+      uint64_t begin = r.start;
+      uint64_t end = r.start + r.count;
+      if (begin % 2) path.push_back(get_node(level, --begin));
+      if (end % 2) path.push_back(get_node(level, end++));
+      AppendRange(parents, Range(begin / 2, (end - begin) / 2));
+    }
+    nodes.swap(parents);
+  }
+  assert(nodes.size() == 1 && nodes[0].start == 0 && nodes[0].count == 1);
+
+  assert(VerifyRangesPath(get_item, ranges, item_count, tree.back(), path));
+  return path;
+}
+
+bool VerifyRangesPath(GetItem const& get_item, std::vector<Range> const& ranges,
+                      uint64_t item_count, h256_t const& root,
+                      Path const& path) {
+  // the path and the items come from the peer, reject without asserting
+  if (!CheckRanges(ranges, item_count)) return false;
+
+  if (item_count == 1) {
+    if (!path.empty()) return false;
+    return (root == get_item(0));
+  }
+
+  // the known nodes of a level, in runs of adjacent positions
+  struct Run {
+    uint64_t start;
+    std::vector<h256_t> items;
+  };
+
+  std::vector<Run> runs;
+  for (auto const& range : ranges) {
+    if (runs.empty() ||
+        runs.back().start + runs.back().items.size() != range.start) {
+      runs.push_back(Run{range.start, {}});
+    }
+    auto& items = runs.back().items;
+    for (uint64_t i = range.start; i < range.start + range.count; ++i) {
+      items.push_back(get_item(i));
+    }
+  }
+
+  uint64_t depth = misc::Log2UB(item_count);
+  size_t used = 0;
+  for (uint64_t level = 0; level < depth; ++level) {
+    std::vector<Run> parents;
+    for (auto const& run : runs) {
+      uint64_t begin = run.start;
+      uint64_t end = run.start + run.items.size();
+      h256_t const* left = nullptr;
+      h256_t const* right = nullptr;
+      if (begin % 2) {
+        if (used == path.size()) return false;
+        left = &path[used++];
+        --begin;
+      }
+      if (end % 2) {
+        if (used == path.size()) return false;
+        right = &path[used++];
+        ++end;
+      }
+      auto get = [&run, left, right, begin, end](uint64_t pos) {
+        if (left && pos == begin) return *left;
+        if (right && pos == end - 1) return *right;
+        return run.items[pos - run.start];
+      };
+
+      if (parents.empty() ||
+          parents.back().start + parents.back().items.size() != begin / 2) {
+        parents.push_back(Run{begin / 2, {}});
+      }
+      auto& items = parents.back().items;
+      for (uint64_t pos = begin; pos < end; pos += 2) {
+        items.resize(items.size() + 1);
+        TwoToOne(get(pos), get(pos + 1), &items.back());
+      }
+    }
+    runs.swap(parents);
+  }
+
+  if (used != path.size()) return false;
+  assert(runs.size() == 1 && runs[0].items.size() == 1);
+  return runs[0].items[0] == root;
+}
+
+h256_t MergeRoots(std::vector<h256_t> const& roots, uint64_t root_leaves,
+                  uint64_t last_count) {
+  assert(!roots.empty());
+  assert(root_leaves && (root_leaves & (root_leaves - 1)) == 0);
+  assert(last_count && last_count <= root_leaves);
+  if (roots.size() == 1) return roots[0];
+
+  std::vector<h256_t> level(roots);
+
+  // the last tree was padded to Pow2UB(last_count) leaves only, lift it up to
+  // root_leaves with empty subtrees on its right. empty ends up as the root
+  // of root_leaves empty leaves.
+  h256_t empty = kEmptyH256;
+  uint64_t last_leaves = misc::Pow2UB(last_count);
+  for (uint64_t count = 1; count < root_leaves; count *= 2) {
+    if (count >= last_leaves) TwoToOne(level.back(), empty, &level.back());
+    TwoToOne(empty, empty, &empty);
+  }
+
+  level.resize(misc::Pow2UB(level.size()), empty);
+  while (level.size() > 1) {
+    for (size_t i = 0; i < level.size() / 2; ++i) {
+      TwoToOne(level[i * 2], level[i * 2 + 1], &level[i]);
+    }
+    level.resize(level.size() / 2);
+  }
+  return level[0];
+}
+
 }  // namespace mkl
\ No newline at end of file
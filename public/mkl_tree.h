@@ -43,4 +43,22 @@ Tree BuildTree(uint64_t item_count, GetItem const& get_item);
 Path GetRangePath(uint64_t item_count, GetItem const& get_item,
                   Tree const& tree, Range const& range);
 
+// one path for several sorted disjoint ranges. Level by level from the
+// leaves, the siblings that can not be computed from the ranges are emitted
+// once each, left to right, so the ranges share their upper nodes.
+// throw
+Path GetRangesPath(uint64_t item_count, GetItem const& get_item,
+                   Tree const& tree, std::vector<Range> const& ranges);
+
+// get_item is called once per item of the ranges, in order
+bool VerifyRangesPath(GetItem const& get_item, std::vector<Range> const& ranges,
+                      uint64_t item_count, h256_t const& root,
+                      Path const& path);
+
+// the root over all the items of several trees, every tree except the last
+// has root_leaves (power of 2) items, the last has last_count items. Same as
+// CalcRoot over the concatenated items.
+h256_t MergeRoots(std::vector<h256_t> const& roots, uint64_t root_leaves,
+                  uint64_t last_count);
+
 }  // namespace mkl
\ No newline at end of file
@@ -1,9 +1,11 @@
 #pragma once
 
 #include "ecc.h"
+#include "trace.h"
 
 template <typename G, typename GET_G, typename GET_F>
 G MultiExpBdlo12Inner(GET_G const& get_g, GET_F const& get_f, size_t n) {
+  trace::Count(trace::kMultiExpPoints, n);
   G zero;
   zero.clear();
 
@@ -97,6 +99,27 @@ G MultiExpBdlo12Inner(GET_G const& get_g, GET_F const& get_f, size_t n) {
   return result;
 }
 
+// split into chunks and compute the chunks in parallel
+template <typename G, typename GET_G, typename GET_F>
+G ParallelMultiExpBdlo12Inner(GET_G const& get_g, GET_F const& get_f,
+                              size_t n) {
+  size_t threads = ParallelConcurrency();
+  auto chunk_count = std::max<size_t>(1, std::min(threads, n / 1024));
+  std::vector<G> parts(chunk_count);
+  ParallelFor(0, chunk_count, [&](int64_t t) {
+    size_t begin = n * t / chunk_count;
+    size_t end = n * (t + 1) / chunk_count;
+    auto get_chunk_g = [&get_g, begin](size_t i) { return get_g(begin + i); };
+    auto get_chunk_f = [&get_f, begin](size_t i) { return get_f(begin + i); };
+    parts[t] = MultiExpBdlo12Inner<G>(get_chunk_g, get_chunk_f, end - begin);
+  });
+
+  G result;
+  result.clear();
+  for (auto const& i : parts) result += i;
+  return result;
+}
+
 inline G1 MultiExpBdlo12(G1 const* pg, Fr const* pf, size_t n) {
   auto get_g = [pg](size_t i) -> G1 const& { return pg[i]; };
   auto get_f = [pf](size_t i) -> Fr const& { return pf[i]; };
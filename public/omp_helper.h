@@ -1,40 +1,27 @@
 #pragma once
 
-#ifdef MULTICORE
-#ifndef __clang__
-#include <omp.h>
-#endif
-#endif
+#include <atomic>
+#include <vector>
 
+#include "parallel.h"
+
+// kept for the callers, both run on the shared scheduler now
 template <typename T, typename F>
 bool OmpExecuteBool(std::vector<T>& items, F& f) {
-  int failed = 0;
-#ifdef MULTICORE
-#ifndef __clang__
-#pragma omp parallel for
-#endif
-#endif
-  for (size_t i = 0; i < items.size(); ++i) {
-    if (failed) continue;
+  std::atomic<int> failed{0};
+  ParallelFor(0, items.size(), [&items, &f, &failed](int64_t i) {
+    if (failed) return;
     auto& item = items[i];
-    if (!f(item)) {
-#ifdef MULTICORE
-#pragma omp atomic
-#endif
-      ++failed;
-    }
-  }
+    if (!f(item)) ++failed;
+  });
 
   return failed == 0;
 }
 
 template <typename T, typename F>
 void OmpExecuteVoid(std::vector<T>& items, F& f) {
-#ifdef MULTICORE
-#pragma omp parallel for
-#endif
-  for (size_t i = 0; i < items.size(); ++i) {
+  ParallelFor(0, items.size(), [&items, &f](int64_t i) {
     auto& item = items[i];
     f(item);
-  }
-}
\ No newline at end of file
+  });
+}
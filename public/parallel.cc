@@ -0,0 +1,239 @@
+#include "parallel.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#ifdef MULTICORE
+#ifndef __clang__
+#include <omp.h>
+#endif
+#endif
+
+#include "task.h"
+
+namespace {
+
+std::atomic<size_t> configured_threads{0};
+thread_local size_t concurrency_limit = 0;  // 0: the whole pool
+thread_local int worker_index = -1;         // -1: not a pool thread
+
+typedef std::function<void()> Job;
+
+class Scheduler {
+ public:
+  // never destroyed, the workers may still be busy when main returns
+  static Scheduler& Instance() {
+    static Scheduler* scheduler = new Scheduler(ParallelThreads());
+    return *scheduler;
+  }
+
+  size_t size() const { return queues_.size(); }
+
+  void Push(Job job) {
+    auto& queue = worker_index >= 0 ? *queues_[worker_index] : injection_;
+    {
+      std::lock_guard<std::mutex> lock(queue.mutex);
+      queue.jobs.push_back(std::move(job));
+    }
+    {
+      std::lock_guard<std::mutex> lock(wait_mutex_);
+      ++pending_;
+    }
+    wait_cv_.notify_one();
+  }
+
+  // run one queued job, return false if there was none
+  bool RunOne() {
+    Job job;
+    if (!Take(job)) return false;
+    job();
+    return true;
+  }
+
+ private:
+  struct Queue {
+    std::mutex mutex;
+    std::deque<Job> jobs;
+  };
+
+  explicit Scheduler(size_t threads) {
+    // the thread that starts a loop works on it too
+    size_t workers = threads > 1 ? threads - 1 : 1;
+    for (size_t i = 0; i < workers; ++i) {
+      queues_.emplace_back(new Queue);
+    }
+    for (size_t i = 0; i < workers; ++i) {
+      std::thread(&Scheduler::WorkerLoop, this, (int)i).detach();
+    }
+  }
+
+  // own queue from the back, then the injection queue, then steal from the
+  // front of the others
+  bool Take(Job& job) {
+    if (worker_index >= 0 && PopBack(*queues_[worker_index], job)) return true;
+    if (PopFront(injection_, job)) return true;
+    size_t start = worker_index >= 0 ? worker_index + 1 : 0;
+    for (size_t i = 0; i < queues_.size(); ++i) {
+      auto& queue = *queues_[(start + i) % queues_.size()];
+      if (PopFront(queue, job)) return true;
+    }
+    return false;
+  }
+
+  bool PopBack(Queue& queue, Job& job) {
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    if (queue.jobs.empty()) return false;
+    job = std::move(queue.jobs.back());
+    queue.jobs.pop_back();
+    --pending_;
+    return true;
+  }
+
+  bool PopFront(Queue& queue, Job& job) {
+    std::lock_guard<std::mutex> lock(queue.mutex);
+    if (queue.jobs.empty()) return false;
+    job = std::move(queue.jobs.front());
+    queue.jobs.pop_front();
+    --pending_;
+    return true;
+  }
+
+  void WorkerLoop(int index) {
+    worker_index = index;
+#ifdef MULTICORE
+#ifndef __clang__
+    // the omp regions left inside libsnark run serial on the pool threads
+    omp_set_num_threads(1);
+#endif
+#endif
+    for (;;) {
+      if (RunOne()) continue;
+      std::unique_lock<std::mutex> lock(wait_mutex_);
+      wait_cv_.wait(lock, [this]() { return pending_ > 0; });
+    }
+  }
+
+  std::vector<std::unique_ptr<Queue>> queues_;
+  Queue injection_;  // jobs pushed by the threads out of the pool
+  std::mutex wait_mutex_;
+  std::condition_variable wait_cv_;
+  std::atomic<int64_t> pending_{0};
+};
+
+struct LoopState {
+  std::function<void(int64_t, int64_t)> const* f;
+  std::atomic<int64_t> next;
+  int64_t end;
+  int64_t grain;
+  size_t limit;
+  Task* task;
+  std::atomic<int> active{0};  // helpers inside the loop
+  std::atomic<bool> failed{false};
+  std::exception_ptr error;
+  std::mutex mutex;
+  std::condition_variable cv;
+};
+
+void RunLoop(LoopState& state) {
+  while (!state.failed) {
+    int64_t b = state.next.fetch_add(state.grain);
+    if (b >= state.end) return;
+    int64_t e = std::min(b + state.grain, state.end);
+    try {
+      (*state.f)(b, e);
+    } catch (...) {
+      std::lock_guard<std::mutex> lock(state.mutex);
+      if (!state.error) state.error = std::current_exception();
+      state.failed = true;
+    }
+  }
+}
+
+}  // namespace
+
+void SetParallelThreads(size_t threads) { configured_threads = threads; }
+
+size_t ParallelThreads() {
+  size_t threads = configured_threads;
+  if (!threads) threads = std::thread::hardware_concurrency();
+  return threads ? threads : 1;
+}
+
+size_t ParallelConcurrency() {
+#ifdef MULTICORE
+  size_t threads = ParallelThreads();
+  if (concurrency_limit && concurrency_limit < threads) {
+    threads = concurrency_limit;
+  }
+  return threads;
+#else
+  return 1;
+#endif
+}
+
+ConcurrencyScope::ConcurrencyScope(size_t limit) : old_(concurrency_limit) {
+  concurrency_limit = limit;
+}
+
+ConcurrencyScope::~ConcurrencyScope() { concurrency_limit = old_; }
+
+namespace detail {
+void ParallelRange(int64_t begin, int64_t end,
+                   std::function<void(int64_t, int64_t)> const& f) {
+  if (begin >= end) return;
+  auto& scheduler = Scheduler::Instance();
+  int64_t n = end - begin;
+  size_t threads = std::min(ParallelConcurrency(), scheduler.size() + 1);
+  threads = (size_t)std::min<int64_t>((int64_t)threads, n);
+
+  auto state = std::make_shared<LoopState>();
+  state->f = &f;
+  state->next = begin;
+  state->end = end;
+  // several grains per thread so that uneven items still balance
+  state->grain = std::max<int64_t>(1, n / (int64_t)(threads * 8));
+  state->limit = concurrency_limit;
+  state->task = CurrentTask();
+
+  for (size_t i = 1; i < threads; ++i) {
+    scheduler.Push([state]() {
+      // count in before looking at the range, so the caller can not return
+      // while f is still in use
+      ++state->active;
+      if (!state->failed && state->next < state->end) {
+        ConcurrencyScope scope(state->limit);
+        TaskScope task_scope(state->task);
+        RunLoop(*state);
+      }
+      if (--state->active == 0) {
+        std::lock_guard<std::mutex> lock(state->mutex);
+        state->cv.notify_all();
+      }
+    });
+  }
+
+  RunLoop(*state);
+
+  // help with the queued jobs instead of sleeping, a nested loop can not
+  // starve this way
+  while (state->active) {
+    if (scheduler.RunOne()) continue;
+    std::unique_lock<std::mutex> lock(state->mutex);
+    state->cv.wait_for(lock, std::chrono::milliseconds(1),
+                       [&state]() { return state->active == 0; });
+  }
+
+  // take the error out, the last helper job may release the state later on
+  // its own thread
+  std::exception_ptr error = std::move(state->error);
+  if (error) std::rethrow_exception(error);
+}
+}  // namespace detail
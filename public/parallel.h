@@ -0,0 +1,60 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <functional>
+
+// one work stealing pool shared by every parallel loop of the library. The
+// pool is created on the first parallel call with ParallelThreads() threads
+// (the caller counts as one of them). A session may run with less threads
+// than the pool by a ConcurrencyScope, the limit follows the loop into the
+// jobs it spawns. Without MULTICORE every loop runs on the calling thread.
+
+// take effect only before the first parallel call, 0 means
+// std::thread::hardware_concurrency()
+void SetParallelThreads(size_t threads);
+
+size_t ParallelThreads();
+
+// the number of threads a loop started on this thread may use
+size_t ParallelConcurrency();
+
+class ConcurrencyScope {
+ public:
+  explicit ConcurrencyScope(size_t limit);  // 0 means no limit
+  ~ConcurrencyScope();
+  ConcurrencyScope(ConcurrencyScope const&) = delete;
+  ConcurrencyScope& operator=(ConcurrencyScope const&) = delete;
+
+ private:
+  size_t old_;
+};
+
+namespace detail {
+// call f(b, e) on disjoint sub ranges of [begin, end) until all are done,
+// rethrow the first exception
+void ParallelRange(int64_t begin, int64_t end,
+                   std::function<void(int64_t, int64_t)> const& f);
+}  // namespace detail
+
+// the body runs once per index, "return" ends an index like "continue" did in
+// the omp loops
+template <typename F>
+void ParallelFor(int64_t begin, int64_t end, F const& f) {
+#ifdef MULTICORE
+  if (end - begin > 1 && ParallelConcurrency() > 1) {
+    detail::ParallelRange(begin, end, [&f](int64_t b, int64_t e) {
+      for (int64_t i = b; i < e; ++i) f(i);
+    });
+    return;
+  }
+#endif
+  for (int64_t i = begin; i < end; ++i) f(i);
+}
+
+template <typename... F>
+void ParallelInvoke(F const&... f) {
+  std::function<void()> const jobs[] = {f...};
+  ParallelFor(0, sizeof...(F), [&jobs](int64_t i) { jobs[i](); });
+}
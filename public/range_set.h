@@ -0,0 +1,66 @@
+#pragma once
+
+#include <stdint.h>
+#include <algorithm>
+#include <cassert>
+#include <stdexcept>
+#include <vector>
+
+#include "basic_types.h"
+
+// sorted disjoint ranges with the prefix sums of their counts. The rows of
+// the ranges are numbered by offset 0..count()-1 in range order, offset and
+// global index map to each other in O(log r) without a table per row.
+class RangeSet {
+ public:
+  RangeSet() = default;
+
+  // the ranges must be sorted and disjoint, see CheckDemands
+  explicit RangeSet(std::vector<Range> ranges) : ranges_(std::move(ranges)) {
+    offsets_.resize(ranges_.size());
+    for (size_t i = 0; i < ranges_.size(); ++i) {
+      offsets_[i] = count_;
+      count_ += ranges_[i].count;
+    }
+  }
+
+  std::vector<Range> const& ranges() const { return ranges_; }
+
+  uint64_t count() const { return count_; }
+
+  // offset < count()
+  uint64_t IndexOf(uint64_t offset) const {
+    assert(offset < count_);
+    auto it = std::upper_bound(offsets_.begin(), offsets_.end(), offset);
+    auto i = (it - offsets_.begin()) - 1;
+    return ranges_[i].start + (offset - offsets_[i]);
+  }
+
+  // throw if the index is in none of the ranges
+  uint64_t OffsetOf(uint64_t index) const {
+    auto it = std::upper_bound(
+        ranges_.begin(), ranges_.end(), index,
+        [](uint64_t i, Range const& range) { return i < range.start; });
+    if (it == ranges_.begin() || index >= (it - 1)->start + (it - 1)->count)
+      throw std::out_of_range("index not in the ranges");
+    auto i = (it - ranges_.begin()) - 1;
+    return offsets_[i] + (index - ranges_[i].start);
+  }
+
+  // every range of the sorted disjoint ranges lies inside one range of this
+  bool Contains(std::vector<Range> const& ranges) const {
+    auto it = ranges_.begin();
+    for (auto const& range : ranges) {
+      while (it != ranges_.end() && it->start + it->count <= range.start) ++it;
+      if (it == ranges_.end() || range.start < it->start ||
+          range.start + range.count > it->start + it->count)
+        return false;
+    }
+    return true;
+  }
+
+ private:
+  std::vector<Range> ranges_;
+  std::vector<uint64_t> offsets_;
+  uint64_t count_ = 0;
+};
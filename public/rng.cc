@@ -0,0 +1,78 @@
+#include "rng.h"
+
+#include <string.h>
+
+#include <algorithm>
+
+#include <cryptopp/aes.h>
+#include <cryptopp/modes.h>
+#include <cryptopp/osrng.h>
+
+namespace {
+
+class Generator {
+ public:
+  ~Generator() { memset(buffer_, 0, sizeof(buffer_)); }
+
+  void Fill(uint8_t* buf, size_t len) {
+    // the big requests skip the buffer
+    if (len >= sizeof(buffer_)) {
+      Keystream(buf, len);
+      return;
+    }
+    while (len) {
+      if (pos_ == sizeof(buffer_)) {
+        Keystream(buffer_, sizeof(buffer_));
+        pos_ = 0;
+      }
+      size_t n = std::min(len, sizeof(buffer_) - pos_);
+      memcpy(buf, buffer_ + pos_, n);
+      memset(buffer_ + pos_, 0, n);  // never hand out the same bytes twice
+      pos_ += n;
+      buf += n;
+      len -= n;
+    }
+  }
+
+ private:
+  void Keystream(uint8_t* buf, size_t len) {
+    while (len) {
+      if (!seeded_ || generated_ >= rng::kReseedBytes) Reseed();
+      uint64_t left = rng::kReseedBytes - generated_;
+      size_t n = (size_t)std::min<uint64_t>(len, left);
+      memset(buf, 0, n);
+      cipher_.ProcessData(buf, buf, n);
+      generated_ += n;
+      buf += n;
+      len -= n;
+    }
+  }
+
+  void Reseed() {
+    uint8_t seed[CryptoPP::AES::MAX_KEYLENGTH + CryptoPP::AES::BLOCKSIZE];
+    CryptoPP::NonblockingRng os_rng;
+    os_rng.GenerateBlock(seed, sizeof(seed));
+    cipher_.SetKeyWithIV(seed, CryptoPP::AES::MAX_KEYLENGTH,
+                         seed + CryptoPP::AES::MAX_KEYLENGTH,
+                         CryptoPP::AES::BLOCKSIZE);
+    memset(seed, 0, sizeof(seed));
+    generated_ = 0;
+    seeded_ = true;
+  }
+
+  CryptoPP::CTR_Mode<CryptoPP::AES>::Encryption cipher_;
+  uint8_t buffer_[4096];
+  size_t pos_ = sizeof(buffer_);
+  uint64_t generated_ = 0;
+  bool seeded_ = false;
+};
+
+thread_local Generator generator;
+
+}  // namespace
+
+namespace rng {
+
+void Fill(uint8_t* buf, size_t len) { generator.Fill(buf, len); }
+
+}  // namespace rng
@@ -0,0 +1,15 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// every random number of the library comes from here. Each thread has its
+// own AES-256-CTR keystream keyed from the os rng and rekeyed every
+// kReseedBytes, so most calls make no syscall.
+namespace rng {
+
+const uint64_t kReseedBytes = 1ULL << 30;
+
+void Fill(uint8_t* buf, size_t len);
+
+}  // namespace rng
@@ -1,5 +1,10 @@
 #include "scheme_misc.h"
 
+#ifdef __linux__
+#include <unistd.h>
+#endif
+#include <fstream>
+
 #include "basic_types.h"
 #include "chain.h"
 #include "ecc_pub.h"
@@ -7,6 +12,35 @@
 #include "mkl_tree.h"
 #include "multiexp.h"
 #include "public.h"
+#include "range_set.h"
+#include "task.h"
+
+namespace {
+#ifdef __linux__
+// the kernel copies without a pass through user space, a reflink file system
+// only shares the extents. Return false if it can not, the caller then copies
+// by itself.
+bool KernelCopy(std::string const& src, uint64_t offset, uint64_t size,
+                std::string const& dst) {
+  int in = open(src.c_str(), O_RDONLY);
+  if (in < 0) return false;
+  int out = open(dst.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+  if (out < 0) {
+    close(in);
+    return false;
+  }
+  loff_t in_offset = offset;
+  while (size) {
+    auto len = copy_file_range(in, &in_offset, out, nullptr, size, 0);
+    if (len <= 0) break;
+    size -= len;
+  }
+  close(in);
+  close(out);
+  return !size;
+}
+#endif
+}  // namespace
 
 namespace scheme {
 
@@ -43,25 +77,33 @@ void LoadMij(uint8_t const* data_start, uint8_t const* data_end, uint64_t i,
 }
 
 bool CopyData(std::string const& src, std::string const& dst) {
-  try {
-    io::mapped_file_params src_params;
-    src_params.path = src;
-    src_params.flags = io::mapped_file_base::readonly;
-    io::mapped_file_source src_view(src_params);
-
-    io::mapped_file_params dst_params;
-    dst_params.path = dst;
-    dst_params.flags = io::mapped_file_base::readwrite;
-    dst_params.new_file_size = src_view.size();
-    io::mapped_file dst_view(dst_params);
-
-    memcpy(dst_view.data(), src_view.data(), src_view.size());
-
-    return true;
-  } catch (std::exception&) {
+  boost::system::error_code err;
+  auto size = fs::file_size(src, err);
+  if (err) {
     assert(false);
     return false;
   }
+  return CopyData(src, 0, size, dst);
+}
+
+bool CopyData(std::string const& src, uint64_t offset, uint64_t size,
+              std::string const& dst) {
+  Tick _tick_(__FUNCTION__);
+#ifdef __linux__
+  if (KernelCopy(src, offset, size, dst)) return true;
+#endif
+
+  std::ifstream is(src, std::ios::binary);
+  std::ofstream os(dst, std::ios::binary | std::ios::trunc);
+  if (!is || !os) return false;
+  is.seekg(offset);
+  std::vector<char> buf(1024 * 1024);
+  while (size) {
+    auto len = std::min<uint64_t>(size, buf.size());
+    if (!is.read(buf.data(), len) || !os.write(buf.data(), len)) return false;
+    size -= len;
+  }
+  return true;
 }
 
 bool SaveMkl(std::string const& output, std::vector<h256_t> const& mkl_tree) {
@@ -116,10 +158,7 @@ std::vector<G1> CalcSigma(std::vector<Fr> const& m, uint64_t n, uint64_t s) {
 
   auto const& u1 = ecc_pub.u1();
   std::vector<G1> sigmas(n);
-#ifdef MULTICORE
-#pragma omp parallel for
-#endif
-  for (int64_t i = 0; i < (int64_t)n; ++i) {
+  ParallelFor(0, n, [&](int64_t i) {
     G1& sigma = sigmas[i];
     auto is = i * s;
     if (s > 1024) {
@@ -131,21 +170,25 @@ std::vector<G1> CalcSigma(std::vector<Fr> const& m, uint64_t n, uint64_t s) {
         sigma += ecc_pub.PowerU1(j, m[is + j]);
       }
     }
-  }
+  });
   return sigmas;
 }
 
-bool SaveSigma(std::string const& output, std::vector<G1> const& sigma) {
+bool SaveSigma(std::string const& output, std::vector<G1> const& sigma,
+               bool uncompressed) {
   Tick _tick_(__FUNCTION__);
   try {
+    size_t point_size = uncompressed ? 64 : 32;
     io::mapped_file_params params;
     params.path = output;
     params.flags = io::mapped_file_base::readwrite;
-    params.new_file_size = sigma.size() * 32;
+    params.new_file_size = sigma.size() * point_size;
     io::mapped_file view(params);
     uint8_t* start = (uint8_t*)view.data();
-    for (size_t i = 0; i < sigma.size(); ++i) {
-      G1ToBin(sigma[i], start + i * 32);
+    if (uncompressed) {
+      G1ToBinUncompressed(sigma.data(), start, sigma.size());
+    } else {
+      G1ToBin(sigma.data(), start, sigma.size());
     }
     return true;
   } catch (std::exception&) {
@@ -161,9 +204,28 @@ bool LoadSigma(std::string const& input, uint64_t n, h256_t const* root,
     params.path = input;
     params.flags = io::mapped_file_base::readonly;
     io::mapped_file_source view(params);
-    if (view.size() != n * 32) return false;
     auto start = (uint8_t*)view.data();
 
+    if (view.size() == n * 64) {
+      sigmas.resize(n);
+      if (!BinToG1Uncompressed(start, sigmas.data(), n)) {
+        assert(false);
+        return false;
+      }
+      if (root) {
+        std::vector<h256_t> bins(n);
+        G1ToBin(sigmas.data(), bins[0].data(), n);
+        auto get_sigma = [&bins](uint64_t i) -> h256_t { return bins[i]; };
+        if (*root != mkl::CalcRoot(std::move(get_sigma), n)) {
+          assert(false);
+          return false;
+        }
+      }
+      return true;
+    }
+
+    if (view.size() != n * 32) return false;
+
     if (root) {
       auto get_sigma = [start, n](uint64_t i) -> h256_t {
         assert(i < n);
@@ -178,8 +240,9 @@ bool LoadSigma(std::string const& input, uint64_t n, h256_t const* root,
     }
 
     sigmas.resize(n);
-    for (size_t i = 0; i < n; ++i) {
-      sigmas[i] = BinToG1(start + i * 32);
+    if (!BinToG1(start, sigmas.data(), n)) {
+      assert(false);
+      return false;
     }
     return true;
   } catch (std::exception&) {
@@ -188,6 +251,24 @@ bool LoadSigma(std::string const& input, uint64_t n, h256_t const* root,
   }
 }
 
+bool LoadSigmaCached(std::string const& input, std::string const& cache,
+                     uint64_t n, h256_t const* root, std::vector<G1>& sigmas,
+                     bool* cache_updated) {
+  *cache_updated = false;
+  if (!root && fs::is_regular_file(cache) &&
+      LoadSigma(cache, n, nullptr, sigmas)) {
+    return true;
+  }
+
+  if (!LoadSigma(input, n, root, sigmas)) return false;
+
+  // the cache is only an optimization
+  boost::system::error_code err;
+  fs::remove(cache, err);
+  *cache_updated = SaveSigma(cache, sigmas, true);
+  return true;
+}
+
 bool SaveMatrix(std::string const& output, std::vector<Fr> const& m) {
   Tick _tick_(__FUNCTION__);
   try {
@@ -208,6 +289,11 @@ bool SaveMatrix(std::string const& output, std::vector<Fr> const& m) {
 }
 
 bool LoadMatrix(std::string const& input, uint64_t ns, std::vector<Fr>& m) {
+  m.resize(ns);
+  return LoadMatrix(input, ns, m.data());
+}
+
+bool LoadMatrix(std::string const& input, uint64_t ns, Fr* m) {
   try {
     io::mapped_file_params params;
     params.path = input;
@@ -216,8 +302,7 @@ bool LoadMatrix(std::string const& input, uint64_t ns, std::vector<Fr>& m) {
     if (view.size() != 32 * ns) return false;
 
     auto start = (uint8_t*)view.data();
-    m.resize(ns);
-    for (uint64_t i = 0; i < m.size(); ++i) {
+    for (uint64_t i = 0; i < ns; ++i) {
       if (!BinToFr32(start + i * 32, &m[i])) {
         assert(false);
         return false;
@@ -230,9 +315,9 @@ bool LoadMatrix(std::string const& input, uint64_t ns, std::vector<Fr>& m) {
 }
 
 std::vector<h256_t> BuildSigmaMklTree(std::vector<G1> const& sigmas) {
-  auto get_sigma = [&sigmas](uint64_t i) -> h256_t {
-    return G1ToBin(sigmas[i]);
-  };
+  std::vector<h256_t> bins(sigmas.size());
+  if (!bins.empty()) G1ToBin(sigmas.data(), bins[0].data(), sigmas.size());
+  auto get_sigma = [&bins](uint64_t i) -> h256_t { return bins[i]; };
   return mkl::BuildTree(sigmas.size(), get_sigma);
 }
 
@@ -292,6 +377,27 @@ h256_t CalcPathOfK(std::vector<G1> const& k, uint64_t ij,
   return root;
 }
 
+mkl::Tree BuildTreeOfK(std::vector<G1> const& k) {
+  Tick _tick_(__FUNCTION__);
+  // the leaves are as many hashes as the rest of the tree, do them in parallel
+  std::vector<h256_t> leaves(k.size());
+  ParallelFor(0, k.size(), [&k, &leaves](int64_t i) {
+    leaves[i] = KToH256(k[i]);
+  });
+  auto get_leaf = [&leaves](uint64_t i) -> h256_t { return leaves[i]; };
+  return mkl::BuildTree(leaves.size(), get_leaf);
+}
+
+// throw
+void GetPathOfK(std::vector<G1> const& k, mkl::Tree const& tree, uint64_t ij,
+                std::vector<h256_t>& path) {
+  auto get_k = [&k](uint64_t i) -> h256_t {
+    assert(i < k.size());
+    return KToH256(k[i]);
+  };
+  path = mkl::GetRangePath(k.size(), get_k, tree, Range(ij, 1));
+}
+
 // since we need to verify the mkl path in contract, we use plain G1
 bool VerifyPathOfK(G1 const& kij, uint64_t ij, uint64_t ns, h256_t const& root,
                    std::vector<h256_t> const& path) {
@@ -299,7 +405,8 @@ bool VerifyPathOfK(G1 const& kij, uint64_t ij, uint64_t ns, h256_t const& root,
   return mkl::VerifyPath(ij, k_bin, ns, root, path);
 }
 
-void BuildK(std::vector<Fr> const& v, std::vector<G1>& k, uint64_t s) {
+bool BuildK(std::vector<Fr> const& v, std::vector<G1>& k, uint64_t s,
+            TaskLoop* loop) {
   Tick _tick_(__FUNCTION__);
 
   assert(v.size() % s == 0);
@@ -308,16 +415,66 @@ void BuildK(std::vector<Fr> const& v, std::vector<G1>& k, uint64_t s) {
   uint64_t n = v.size() / s;
   k.resize(v.size());
 
-#ifdef MULTICORE
-#pragma omp parallel for
-#endif
-  for (int64_t i = 0; i < (int64_t)n; ++i) {
+  ParallelFor(0, n, [&](int64_t i) {
+    if (loop && !loop->Step()) return;
     for (int64_t j = 0; j < (int64_t)s; ++j) {
       auto offset = i * s + j;
       k[offset] = ecc_pub.PowerU1(j, v[offset]);
-      k[offset].normalize();  // since we will serialize k (mkl root) later
     }
-  }
+  });
+  if (loop && loop->cancelled()) return false;
+
+  // since we will serialize k (mkl root) later
+  G1Normalize(k.data(), k.size());
+  return true;
+}
+
+void AddColumnSums(Fr const* v, Fr const* w, uint64_t rows, uint64_t s,
+                   std::vector<Fr>& sums) {
+  Tick _tick_(__FUNCTION__);
+  assert(sums.size() == s);
+  if (!rows || !s) return;
+
+  // the columns of a tile stay in the cache while the rows go by
+  const uint64_t kTileCols = 256;
+
+  uint64_t blocks = std::min<uint64_t>(rows, ParallelConcurrency());
+  uint64_t block_rows = (rows + blocks - 1) / blocks;
+  blocks = (rows + block_rows - 1) / block_rows;
+
+  std::vector<std::vector<Fr>> partials(blocks);
+  ParallelFor(0, blocks, [&](int64_t b) {
+    auto& partial = partials[b];
+    partial.resize(s, FrZero());
+    uint64_t begin = b * block_rows;
+    uint64_t end = std::min(rows, begin + block_rows);
+    for (uint64_t t = 0; t < s; t += kTileCols) {
+      uint64_t t_end = std::min(s, t + kTileCols);
+      for (uint64_t i = begin; i < end; ++i) {
+        Fr const* vi = v + i * s;
+        if (w) {
+          for (uint64_t j = t; j < t_end; ++j) partial[j] += vi[j] * w[i];
+        } else {
+          for (uint64_t j = t; j < t_end; ++j) partial[j] += vi[j];
+        }
+      }
+    }
+  });
+
+  ParallelFor(0, s, [&](int64_t j) {
+    for (auto const& partial : partials) sums[j] += partial[j];
+  });
+}
+
+std::vector<G1> SumRows(G1 const* k, uint64_t rows, uint64_t s) {
+  Tick _tick_(__FUNCTION__);
+  std::vector<G1> sums(rows);
+  ParallelFor(0, rows, [&](int64_t i) {
+    G1& sum = sums[i];
+    sum = G1Zero();
+    for (uint64_t j = 0; j < s; ++j) sum += k[i * s + j];
+  });
+  return sums;
 }
 
 h256_t CalcRangesDigest(std::vector<Range> const& r) {
@@ -345,12 +502,12 @@ h256_t CalcFrDataDigest(std::vector<Fr> const& m) {
 }
 
 h256_t CalcG1DataDigest(std::vector<G1> const& d) {
+  // same as hashing the points one by one
+  std::vector<uint8_t> bin(d.size() * 32);
+  G1ToBin(d.data(), bin.data(), d.size());
   h256_t digest;
   CryptoPP::Keccak_256 hash;
-  for (auto& i : d) {
-    h256_t bin = G1ToBin(i);
-    hash.Update(bin.data(), bin.size());
-  }
+  hash.Update(bin.data(), bin.size());
   hash.Final(digest.data());
   return digest;
 }
@@ -391,35 +548,8 @@ bool CheckDemandPhantoms(uint64_t n, std::vector<Range> const& demands,
       return false;
   }
 
-  for (size_t i = 0; i < demands.size(); ++i) {
-    auto d_start = demands[i].start;
-    auto d_end = d_start + demands[i].count;
-    bool find = false;
-    for (size_t j = 0; j < phantoms.size(); ++j) {
-      auto p_start = phantoms[j].start;
-      auto p_end = p_start + phantoms[j].count;
-      if (p_start <= d_start && p_end >= d_end) {
-        find = true;
-        break;
-      }
-    }
-    if (!find) return false;
-  }
-  return true;
-}
-
-uint64_t GetRangesOffsetByIndexOfM(std::vector<Range> const& ranges,
-                                   uint64_t index) {
-  uint64_t offset = 0;
-  for (auto const& range : ranges) {
-    if (index >= range.start && index < (range.start + range.count)) {
-      offset += index - range.start;
-      return offset;
-    }
-    offset += range.count;
-  }
-  assert(false);
-  throw std::runtime_error(__FUNCTION__);
+  // both are sorted, one sweep instead of a scan of phantoms per demand
+  return RangeSet(phantoms).Contains(demands);
 }
 
 bool CheckPhantoms(uint64_t n, std::vector<Range> const& phantoms) {
@@ -452,6 +582,49 @@ bool CheckDemands(uint64_t n, std::vector<Range> const& demands) {
   }
   return true;
 }
+
+// throw
+void BuildSigmaSlice(std::vector<G1> const& sigmas, mkl::Tree const& tree,
+                     std::vector<Range> const& ranges, SigmaSlice& slice) {
+  Tick _tick_(__FUNCTION__);
+  if (!CheckDemands(sigmas.size(), ranges))
+    throw std::runtime_error("invalid ranges");
+
+  auto get_sigma = [&sigmas](uint64_t i) -> h256_t {
+    return G1ToBin(sigmas[i]);
+  };
+
+  slice.ranges = ranges;
+  slice.sigmas.clear();
+  for (auto const& range : ranges) {
+    for (uint64_t j = range.start; j < range.start + range.count; ++j) {
+      slice.sigmas.push_back(get_sigma(j));
+    }
+  }
+  slice.path = mkl::GetRangesPath(sigmas.size(), get_sigma, tree, ranges);
+}
+
+bool VerifySigmaSlice(SigmaSlice const& slice, uint64_t n, h256_t const& root,
+                      std::vector<G1>& sigmas) {
+  Tick _tick_(__FUNCTION__);
+  // the slice comes from alice, reject it without asserting
+  if (!CheckDemands(n, slice.ranges)) return false;
+
+  uint64_t count = 0;
+  for (auto const& range : slice.ranges) count += range.count;
+  if (count != slice.sigmas.size()) return false;
+
+  // called in the order of the rows
+  uint64_t offset = 0;
+  auto get_sigma = [&slice, &offset](uint64_t) -> h256_t {
+    return slice.sigmas[offset++];
+  };
+  if (!mkl::VerifyRangesPath(get_sigma, slice.ranges, n, root, slice.path))
+    return false;
+
+  sigmas.resize(count);
+  return BinToG1(slice.sigmas[0].data(), sigmas.data(), count);
+}
 }  // namespace scheme
 
 namespace std {
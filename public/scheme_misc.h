@@ -6,6 +6,7 @@
 
 #include "bp.h"
 #include "ecc.h"
+#include "mkl_tree.h"
 #include "mpz.h"
 #include "vrf.h"
 #include "scheme_error.h"
@@ -30,20 +31,36 @@ void LoadMij(uint8_t const* data_start, uint8_t const* data_end, uint64_t i,
 
 bool CopyData(std::string const& src, std::string const& dst);
 
+// copy size bytes from offset of src, by copy_file_range where it works
+bool CopyData(std::string const& src, uint64_t offset, uint64_t size,
+              std::string const& dst);
+
 bool SaveMkl(std::string const& output, std::vector<h256_t> const& mkl_tree);
 
 bool LoadMkl(std::string const& input, uint64_t n,
              std::vector<h256_t>& mkl_tree);
 
-bool SaveSigma(std::string const& output, std::vector<G1> const& sigma);
+// uncompressed writes 64 bytes (x, y) per sigma instead of 32
+bool SaveSigma(std::string const& output, std::vector<G1> const& sigma,
+               bool uncompressed = false);
 
+// accepts both encodings, the root is always over the compressed sigmas
 bool LoadSigma(std::string const& input, uint64_t n, h256_t const* root,
                std::vector<G1>& sigmas);
 
+// load from the uncompressed cache unless the root must be checked, then
+// load the sigma file and rebuild the cache
+bool LoadSigmaCached(std::string const& input, std::string const& cache,
+                     uint64_t n, h256_t const* root, std::vector<G1>& sigmas,
+                     bool* cache_updated);
+
 bool SaveMatrix(std::string const& output, std::vector<Fr> const& m);
 
 bool LoadMatrix(std::string const& input, uint64_t ns, std::vector<Fr>& m);
 
+// m must have room for ns items
+bool LoadMatrix(std::string const& input, uint64_t ns, Fr* m);
+
 std::vector<G1> CalcSigma(std::vector<Fr> const& m, uint64_t n, uint64_t s);
 
 std::vector<h256_t> BuildSigmaMklTree(std::vector<G1> const& sigmas);
@@ -57,6 +74,14 @@ h256_t CalcRootOfK(std::vector<G1> const& k);
 h256_t CalcPathOfK(std::vector<G1> const& k, uint64_t ij,
                    std::vector<h256_t>& path);
 
+// the root is tree.back(), same as CalcRootOfK
+mkl::Tree BuildTreeOfK(std::vector<G1> const& k);
+
+// same path as CalcPathOfK, but O(log n) with the tree of BuildTreeOfK
+// throw
+void GetPathOfK(std::vector<G1> const& k, mkl::Tree const& tree, uint64_t ij,
+                std::vector<h256_t>& path);
+
 h256_t CalcRangesDigest(std::vector<Range> const& r);
 
 h256_t CalcFrDataDigest(std::vector<Fr> const& m);
@@ -66,19 +91,44 @@ h256_t CalcG1DataDigest(std::vector<G1> const& d);
 bool VerifyPathOfK(G1 const& kij, uint64_t ij, uint64_t ns, h256_t const& root,
                    std::vector<h256_t> const& path);
 
-void BuildK(std::vector<Fr> const& v, std::vector<G1>& k, uint64_t s);
+class TaskLoop;
+
+// the loop (may be null) steps once per row of v, return false if its task
+// was cancelled and k is incomplete
+bool BuildK(std::vector<Fr> const& v, std::vector<G1>& k, uint64_t s,
+            TaskLoop* loop = nullptr);
+
+// sums[j] += v[i * s + j] * w[i] for i < rows, no w means all ones. Every
+// thread adds a block of rows into its own column sums, merged at the end.
+void AddColumnSums(Fr const* v, Fr const* w, uint64_t rows, uint64_t s,
+                   std::vector<Fr>& sums);
+
+// the sum of each row of s points
+std::vector<G1> SumRows(G1 const* k, uint64_t rows, uint64_t s);
 
 h256_t CalcSeed2(std::vector<h256_t> const& h);
 
 bool CheckDemandPhantoms(uint64_t n, std::vector<Range> const& demands,
                          std::vector<Range> const& phantoms);
 
-uint64_t GetRangesOffsetByIndexOfM(std::vector<Range> const& ranges,
-                                   uint64_t index);
-
 bool CheckPhantoms(uint64_t n, std::vector<Range> const& phantoms);
 
 bool CheckDemands(uint64_t n, std::vector<Range> const& demands);
+
+// the sigmas of some rows with one multi range path, enough to check them
+// against the sigma mkl root without the other n rows
+struct SigmaSlice {
+  std::vector<Range> ranges;
+  std::vector<h256_t> sigmas;  // compressed, in the order of ranges
+  mkl::Path path;
+};
+
+// throw
+void BuildSigmaSlice(std::vector<G1> const& sigmas, mkl::Tree const& tree,
+                     std::vector<Range> const& ranges, SigmaSlice& slice);
+
+bool VerifySigmaSlice(SigmaSlice const& slice, uint64_t n, h256_t const& root,
+                      std::vector<G1>& sigmas);
 }  // namespace scheme
 
 namespace std {
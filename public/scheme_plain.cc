@@ -26,12 +26,16 @@ bool DataToM(std::string const& pathname, uint64_t size, uint64_t n,
 
     auto s = column_num + 1;
     m.resize(n * s);
-    for (uint64_t i = 0; i < n; ++i) {
-      m[i * s] = FrRand();  // pad random fr
-      for (uint64_t j = 1; j < s; ++j) {
-        LoadMij(start, end, i, j - 1, column_num, m[i * s + j]);
-      }
-    }
+    std::vector<Fr> pads(n);
+    FrRand(pads.data(), n);  // pad random fr
+
+    // a row is column_num * 31 contiguous bytes
+    uint64_t row_size = column_num * 31;
+    ParallelFor(0, n, [&](int64_t i) {
+      m[i * s] = pads[i];
+      auto p = std::min(start + i * row_size, end);
+      BinToFr31(p, end - p, &m[i * s + 1], column_num);
+    });
     return true;
   } catch (std::exception&) {
     return false;
@@ -52,25 +56,27 @@ bool DecryptedRangeMToFile(std::string const& file, uint64_t size, uint64_t s,
   io::mapped_file_params file_params;
   file_params.path = file;
   file_params.flags = io::mapped_file_base::readwrite;
-  file_params.new_file_size = count * column_num * 31 + 1;
+  file_params.new_file_size = count * column_num * 31;
   io::mapped_file file_view = io::mapped_file(file_params);
   if (!file_view.data()) return false;
 
   uint8_t* p = (uint8_t*)file_view.data();
-  for (uint64_t i = 0; i < count; ++i) {
-    for (uint64_t j = 1; j < s; ++j) {
-      Fr const& fr = m_begin[i * s + j];
-      FrToBin(fr, p);
-      if (p[31]) {
-        assert(false);
-        return false;
-      }
-      p += 31;
+  uint64_t row_size = column_num * 31;
+  std::atomic<int> invalid{0};
+  ParallelFor(0, count, [&](int64_t i) {
+    if (invalid) return;
+    if (!FrToBin31(&m_begin[i * s + 1], column_num, p + i * row_size)) {
+      ++invalid;
     }
-  }
+  });
 
   file_view.close();
 
+  if (invalid) {
+    assert(false);
+    return false;
+  }
+
   uint64_t file_size = column_num * count * 31;
   if (start + count == n) {
     uint64_t tail_pad_len = n * column_num * 31 - size;
@@ -148,10 +148,7 @@ void DataToM(Table const& table, std::vector<uint64_t> columens_index,
   auto record_fr_num = s - 1 - columens_index.size();
   auto n = table.size();
 
-#ifdef MULTICORE
-#pragma omp parallel for
-#endif
-  for (uint64_t i = 0; i < n; ++i) {
+  ParallelFor(0, n, [&](int64_t i) {
     std::vector<uint8_t> bin(31 * record_fr_num);
     auto const& record = table[i];
     auto record_size = GetRecordSize(record);
@@ -168,7 +165,7 @@ void DataToM(Table const& table, std::vector<uint64_t> columens_index,
       uint8_t const* p = bin.data() + j * 31;
       m[offset++] = BinToFr31(p, p + 31);
     }
-  }
+  });
 }
 
 VrfKeyMeta const* GetKeyMetaByName(VrfMeta const& vrf_meta,
@@ -185,70 +182,108 @@ VrfKeyMeta const* GetKeyMetaByName(VrfMeta const& vrf_meta,
   return nullptr;
 }
 
-bool DecryptedRangeMToFile(std::string const& file, uint64_t s,
-                           VrfMeta const& vrf_meta,
-                           std::vector<Range> const& demands,
-                           std::vector<Fr> const& part_m) {
-  boost::system::error_code err;
-  fs::remove(file, err);
+namespace {
+// the record in row i of the decrypted rows
+bool GetDecryptedRecord(std::vector<Fr> const& part_m, uint64_t i, uint64_t s,
+                        VrfMeta const& vrf_meta, Record& record) {
+  uint64_t prefix_count = vrf_meta.keys.size() + 1;
+  auto row = part_m.data() + i * s;
 
-  std::ofstream out(file);
-  if (!out) return false;
+  // pad fr
+  h256_t pad_fr;
+  FrToBin(row[prefix_count - 1], pad_fr.data());
+  uint32_t real_len;
+  memcpy(&real_len, pad_fr.data(), sizeof(real_len));
+  real_len = boost::endian::big_to_native(real_len);
+
+  std::vector<uint8_t> record_bin((s - prefix_count) * 31);
+  if (real_len > record_bin.size()) return false;
+  if (!FrToBin31(row + prefix_count, s - prefix_count, record_bin.data()))
+    return false;
+  record_bin.resize(real_len);
+
+  record.reserve(vrf_meta.column_names.size());
+  if (!BinToRecord(record_bin, record, vrf_meta.column_names.size()))
+    return false;
+  assert(record.size() <= vrf_meta.column_names.size());
+  return true;
+}
 
-  std::string str;
-  for (auto const& i : vrf_meta.column_names) {
-    str += i + ",";
+// the csv line with the "\n"
+uint64_t GetLineSize(Record const& record) {
+  uint64_t size = record.empty() ? 1 : record.size();
+  for (auto const& r : record) size += r.size();
+  return size;
+}
+
+void WriteLine(Record const& record, char* p) {
+  for (size_t i = 0; i < record.size(); ++i) {
+    if (i) *p++ = ',';
+    memcpy(p, record[i].data(), record[i].size());
+    p += record[i].size();
   }
-  str.pop_back();
-  out << str;
-  out << "\n";
+  *p = '\n';
+}
+}  // namespace
 
+bool DecryptedRangeMToFile(std::string const& file, uint64_t s,
+                           VrfMeta const& vrf_meta,
+                           std::vector<Range> const& demands,
+                           std::vector<Fr> const& part_m) {
+  Tick _tick_(__FUNCTION__);
   uint64_t demands_count = 0;
   for (auto const& i : demands) demands_count += i.count;
-  h256_t pad_fr;
-  uint64_t prefix_count = vrf_meta.keys.size() + 1;
-  uint64_t max_record_len = (s - prefix_count) * 31 + 1;
-  std::vector<uint8_t> record_bin;
-  for (size_t i = 0; i < demands_count; ++i) {
-    // pad fr
-    size_t j = vrf_meta.keys.size();
-    FrToBin(part_m[i * s + j], pad_fr.data());
-    uint32_t real_len;
-    memcpy(&real_len, pad_fr.data(), sizeof(real_len));
-    real_len = boost::endian::big_to_native(real_len);
-    record_bin.resize(max_record_len);
-    if (real_len >= record_bin.size()) {
-      assert(false);
-      return false;
-    }
-
-    for (j = j + 1; j < s; ++j) {
-      auto row_index = j - prefix_count;
-      auto prow = record_bin.data() + row_index * 31;
-      FrToBin(part_m[i * s + j], prow);
-      assert(prow[31] == 0);
-    }
-
-    record_bin.resize(real_len);
+  if (part_m.size() != demands_count * s) return false;
 
+  std::string header;
+  for (auto const& i : vrf_meta.column_names) {
+    header += i + ",";
+  }
+  header.pop_back();
+  header += "\n";
+
+  // the rows are formatted twice, once for the size of their lines and then
+  // into the mapped file, so no formatted copy of the rows is kept
+  std::vector<uint64_t> offsets(demands_count + 1);
+  std::atomic<int> invalid{0};
+  ParallelFor(0, demands_count, [&](int64_t i) {
+    if (invalid) return;
     Record record;
-    record.reserve(vrf_meta.column_names.size());
-    if (!BinToRecord(record_bin, record, vrf_meta.column_names.size())) {
-      assert(false);
-      return false;
+    if (!GetDecryptedRecord(part_m, i, s, vrf_meta, record)) {
+      ++invalid;
+      return;
     }
-    assert(record.size() <= vrf_meta.column_names.size());
+    offsets[i + 1] = GetLineSize(record);
+  });
+  if (invalid) {
+    assert(false);
+    return false;
+  }
+  offsets[0] = header.size();
+  std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
 
-    str.clear();
-    for (auto const& r : record) {
-      str += r + ",";
-    }
-    if (!str.empty()) str.pop_back();
+  boost::system::error_code err;
+  fs::remove(file, err);
 
-    out << str << "\n";
+  try {
+    io::mapped_file_params params;
+    params.path = file;
+    params.flags = io::mapped_file_base::readwrite;
+    params.new_file_size = offsets.back();
+    io::mapped_file view(params);
+    char* start = view.data();
+    memcpy(start, header.data(), header.size());
+
+    ParallelFor(0, demands_count, [&](int64_t i) {
+      Record record;
+      GetDecryptedRecord(part_m, i, s, vrf_meta, record);
+      WriteLine(record, start + offsets[i]);
+    });
+    return true;
+  } catch (std::exception&) {
+    assert(false);
+    return false;
   }
-
-  return true;
 }
 
 }  // namespace scheme::table
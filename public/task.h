@@ -0,0 +1,90 @@
+#pragma once
+
+#include <stdint.h>
+
+#include <atomic>
+#include <functional>
+#include <mutex>
+
+// the async capi task running on this thread. The parallel loops pass it on
+// to the pool jobs they spawn.
+struct Task {
+  std::function<void(char const* stage, double fraction)> progress;
+  std::atomic<bool> cancelled{false};
+  std::mutex progress_mutex;  // progress is never called concurrently
+};
+
+inline Task*& CurrentTask() {
+  thread_local Task* task = nullptr;
+  return task;
+}
+
+struct TaskScope {
+  TaskScope(Task* task) : old_(CurrentTask()) { CurrentTask() = task; }
+  ~TaskScope() { CurrentTask() = old_; }
+
+ private:
+  Task* old_;
+};
+
+inline bool TaskCancelled() {
+  Task* task = CurrentTask();
+  return task && task->cancelled;
+}
+
+// called between the stages, return false if the task was cancelled and the
+// caller should give up
+inline bool TaskProgress(char const* stage, double fraction) {
+  Task* task = CurrentTask();
+  if (!task) return true;
+  if (task->progress) {
+    std::lock_guard<std::mutex> lock(task->progress_mutex);
+    task->progress(stage, fraction);
+  }
+  return !task->cancelled;
+}
+
+// a parallel loop of count items that moves the stage from the fraction from
+// to the fraction to. The loop body calls Step() once per item on any
+// thread, which reports about every 1% and returns false once the task was
+// cancelled, the body then skips the item. A report that lost the race to a
+// later one is dropped, so the fractions never go back.
+class TaskLoop {
+ public:
+  TaskLoop(char const* stage, double from, double to, uint64_t count)
+      : task_(CurrentTask()),
+        stage_(stage),
+        from_(from),
+        to_(to),
+        count_(count),
+        every_(count / 100 + 1) {}
+
+  bool Step() {
+    if (!task_) return true;
+    if (task_->cancelled) return false;
+    uint64_t done = done_++;
+    if (task_->progress && done % every_ == 0) {
+      std::unique_lock<std::mutex> lock(task_->progress_mutex,
+                                        std::try_to_lock);
+      double fraction = from_ + (to_ - from_) * done / count_;
+      if (lock && fraction >= reported_) {
+        reported_ = fraction;
+        task_->progress(stage_, fraction);
+      }
+    }
+    return true;
+  }
+
+  // true if the task was cancelled, the loop did not finish
+  bool cancelled() const { return task_ && task_->cancelled; }
+
+ private:
+  Task* const task_;
+  char const* const stage_;
+  double const from_;
+  double const to_;
+  uint64_t const count_;
+  uint64_t const every_;
+  std::atomic<uint64_t> done_{0};
+  double reported_ = 0;  // guarded by task_->progress_mutex
+};
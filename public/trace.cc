@@ -0,0 +1,210 @@
+#include "trace.h"
+
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <map>
+#include <memory>
+
+namespace trace {
+
+namespace {
+// a runaway loop should not eat the memory
+const size_t kMaxEventsPerThread = 1 << 20;
+
+struct Registry {
+  std::mutex mutex;
+  std::vector<std::shared_ptr<detail::Buffer>> buffers;
+  std::vector<std::shared_ptr<detail::Buffer>> free;  // their threads exited
+};
+
+// never destroyed, the detached pool threads may still record at exit
+Registry& GetRegistry() {
+  static Registry* registry = new Registry;
+  return *registry;
+}
+
+// owns the buffer of one thread and gives it back when the thread exits
+class LocalHolder {
+ public:
+  LocalHolder() {
+    auto& registry = GetRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    if (!registry.free.empty()) {
+      buffer_ = std::move(registry.free.back());
+      registry.free.pop_back();
+      return;
+    }
+    buffer_ = std::make_shared<detail::Buffer>();
+    buffer_->tid = (uint32_t)registry.buffers.size();
+    registry.buffers.push_back(buffer_);
+  }
+
+  ~LocalHolder() {
+    auto& registry = GetRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    buffer_->depth = 0;
+    registry.free.push_back(std::move(buffer_));
+  }
+
+  detail::Buffer& buffer() { return *buffer_; }
+
+ private:
+  std::shared_ptr<detail::Buffer> buffer_;
+};
+
+char const* CounterName(int c) {
+  static char const* const kNames[kCounterNum] = {
+      "g1_exp", "g2_exp", "multiexp_points", "pairings", "hash_bytes"};
+  return kNames[c];
+}
+
+std::string JsonEscape(char const* s) {
+  std::string ret;
+  for (; *s; ++s) {
+    if (*s == '"' || *s == '\\') ret.push_back('\\');
+    ret.push_back(*s);
+  }
+  return ret;
+}
+
+struct Snapshot {
+  std::vector<std::pair<uint32_t, detail::Event>> events;  // tid, event
+  std::array<uint64_t, kCounterNum> counters{};
+  uint64_t dropped = 0;
+};
+
+Snapshot TakeSnapshot() {
+  Snapshot snapshot;
+  auto& registry = GetRegistry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  for (auto& buffer : registry.buffers) {
+    std::lock_guard<std::mutex> buffer_lock(buffer->mutex);
+    for (auto const& e : buffer->events) {
+      snapshot.events.emplace_back(buffer->tid, e);
+    }
+    for (int i = 0; i < kCounterNum; ++i) {
+      snapshot.counters[i] += buffer->counters[i];
+    }
+    snapshot.dropped += buffer->dropped;
+  }
+  return snapshot;
+}
+}  // namespace
+
+namespace detail {
+Buffer& LocalBuffer() {
+  thread_local LocalHolder holder;
+  return holder.buffer();
+}
+
+void Record(Buffer& buffer, char const* name, uint64_t begin_ns,
+            uint64_t end_ns) {
+  std::lock_guard<std::mutex> lock(buffer.mutex);
+  if (buffer.events.size() >= kMaxEventsPerThread) {
+    ++buffer.dropped;
+    return;
+  }
+  buffer.events.push_back(Event{name, begin_ns, end_ns});
+}
+
+void Print(char const* name, uint64_t ns) {
+  auto ms = ns / 1000000;
+  if (ms < 10000) {
+    std::cout << "<== " << name << " tick: " << ms << " ms\n";
+  } else {
+    std::cout << "<== " << name << " tick: " << ms / 1000 << " seconds\n";
+  }
+}
+}  // namespace detail
+
+bool SaveChromeTrace(std::string const& file) {
+  auto snapshot = TakeSnapshot();
+  uint64_t base_ns = UINT64_MAX;
+  uint64_t last_ns = 0;
+  for (auto const& i : snapshot.events) {
+    base_ns = std::min(base_ns, i.second.begin_ns);
+    last_ns = std::max(last_ns, i.second.end_ns);
+  }
+  if (snapshot.events.empty()) base_ns = last_ns = 0;
+
+  std::ofstream os(file);
+  os << std::fixed << std::setprecision(3);
+  os << "{\"traceEvents\": [\n";
+  bool first = true;
+  for (auto const& i : snapshot.events) {
+    auto const& e = i.second;
+    os << (first ? "" : ",\n") << "{\"name\": \"" << JsonEscape(e.name)
+       << "\", \"cat\": \"pod\", \"ph\": \"X\", \"pid\": 1, \"tid\": "
+       << i.first << ", \"ts\": " << (e.begin_ns - base_ns) / 1000.0
+       << ", \"dur\": " << (e.end_ns - e.begin_ns) / 1000.0 << "}";
+    first = false;
+  }
+  os << (first ? "" : ",\n") << "{\"name\": \"counters\", \"ph\": \"C\", "
+     << "\"pid\": 1, \"tid\": 0, \"ts\": " << (last_ns - base_ns) / 1000.0
+     << ", \"args\": {";
+  for (int c = 0; c < kCounterNum; ++c) {
+    os << (c ? ", " : "") << "\"" << CounterName(c)
+       << "\": " << snapshot.counters[c];
+  }
+  os << "}}\n], \"otherData\": {\"dropped\": " << snapshot.dropped << "}}\n";
+  return (bool)os;
+}
+
+void DumpSummary(std::ostream& os) {
+  auto snapshot = TakeSnapshot();
+  std::map<std::string, std::vector<uint64_t>> spans;
+  for (auto const& i : snapshot.events) {
+    spans[i.second.name].push_back(i.second.end_ns - i.second.begin_ns);
+  }
+
+  auto ms = [](uint64_t ns) { return ns / 1000000.0; };
+  os << std::fixed << std::setprecision(3);
+  for (auto& span : spans) {
+    auto& v = span.second;
+    std::sort(v.begin(), v.end());
+    uint64_t total = 0;
+    for (auto i : v) total += i;
+    auto pct = [&v](double p) { return v[(size_t)((v.size() - 1) * p)]; };
+    os << span.first << ": count " << v.size() << ", total " << ms(total)
+       << " ms, min " << ms(v.front()) << ", p50 " << ms(pct(0.5))
+       << ", p90 " << ms(pct(0.9)) << ", p99 " << ms(pct(0.99)) << ", max "
+       << ms(v.back()) << "\n";
+
+    // bucket b holds the durations in [2^b, 2^(b+1)) microseconds, bucket
+    // -1 the ones under 1 microsecond
+    std::map<int, uint64_t> histogram;
+    for (auto i : v) {
+      int b = -1;
+      for (uint64_t us = i / 1000; us; us >>= 1) ++b;
+      ++histogram[b];
+    }
+    os << "  us:";
+    for (auto const& h : histogram) {
+      if (h.first < 0) {
+        os << " [0,1) " << h.second << ";";
+      } else {
+        os << " [" << (1ULL << h.first) << ",) " << h.second << ";";
+      }
+    }
+    os << "\n";
+  }
+
+  for (int c = 0; c < kCounterNum; ++c) {
+    os << CounterName(c) << ": " << snapshot.counters[c] << "\n";
+  }
+  if (snapshot.dropped) os << "dropped spans: " << snapshot.dropped << "\n";
+}
+
+void Reset() {
+  auto& registry = GetRegistry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  for (auto& buffer : registry.buffers) {
+    std::lock_guard<std::mutex> buffer_lock(buffer->mutex);
+    buffer->events.clear();
+    for (auto& c : buffer->counters) c = 0;
+    buffer->dropped = 0;
+  }
+}
+
+}  // namespace trace
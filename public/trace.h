@@ -0,0 +1,133 @@
+#pragma once
+
+#include <stdint.h>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// nested spans and counters recorded into per thread buffers. Recording is
+// off by default and switched at runtime; the console output is a separate
+// switch. Export with SaveChromeTrace (chrome://tracing) and DumpSummary.
+namespace trace {
+
+enum Counter {
+  kG1Exp,           // single G1 exponentiations
+  kG2Exp,           // single G2 exponentiations
+  kMultiExpPoints,  // points of the G1 multiexps
+  kPairings,
+  kHashBytes,  // bytes fed to keccak
+  kCounterNum,
+};
+
+namespace detail {
+struct Event {
+  char const* name;
+  uint64_t begin_ns;
+  uint64_t end_ns;
+};
+
+struct Buffer {
+  uint32_t tid = 0;
+  uint32_t depth = 0;
+  uint64_t dropped = 0;
+  std::mutex mutex;  // only contended by the exporter
+  std::vector<Event> events;
+  std::array<std::atomic<uint64_t>, kCounterNum> counters{};  // one writer
+};
+
+// taken from the registry on the first use of every thread. When the thread
+// exits the buffer goes back with its spans and counters, and the next new
+// thread records into it, so short lived threads do not pile up buffers.
+Buffer& LocalBuffer();
+
+inline std::atomic<bool>& EnabledFlag() {
+  static std::atomic<bool> flag{false};
+  return flag;
+}
+
+inline std::atomic<bool>& ConsoleFlag() {
+  static std::atomic<bool> flag{false};
+  return flag;
+}
+
+inline uint64_t NowNs() {
+  auto t = std::chrono::steady_clock::now().time_since_epoch();
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(t).count();
+}
+
+void Record(Buffer& buffer, char const* name, uint64_t begin_ns,
+            uint64_t end_ns);
+
+void Print(char const* name, uint64_t ns);
+}  // namespace detail
+
+inline bool Enabled() {
+  return detail::EnabledFlag().load(std::memory_order_relaxed);
+}
+
+inline bool Console() {
+  return detail::ConsoleFlag().load(std::memory_order_relaxed);
+}
+
+inline void Enable(bool on) { detail::EnabledFlag() = on; }
+
+// the old "==>"/"<==" lines of Tick
+inline void SetConsole(bool on) { detail::ConsoleFlag() = on; }
+
+inline void Count(Counter c, uint64_t n = 1) {
+  if (!Enabled()) return;
+  auto& counter = detail::LocalBuffer().counters[c];
+  counter.store(counter.load(std::memory_order_relaxed) + n,
+                std::memory_order_relaxed);
+}
+
+// name must outlive the export, __FUNCTION__ or a literal
+class Span {
+ public:
+  explicit Span(char const* name) : name_(name) {
+    if (Console()) {
+      console_ = true;
+      std::cout << "==> " << name_ << "\n";
+    }
+    if (Enabled()) {
+      buffer_ = &detail::LocalBuffer();
+      ++buffer_->depth;
+    }
+    if (buffer_ || console_) begin_ns_ = detail::NowNs();
+  }
+
+  ~Span() {
+    if (!buffer_ && !console_) return;
+    uint64_t end_ns = detail::NowNs();
+    if (buffer_) {
+      --buffer_->depth;
+      detail::Record(*buffer_, name_, begin_ns_, end_ns);
+    }
+    if (console_) detail::Print(name_, end_ns - begin_ns_);
+  }
+
+  Span(Span const&) = delete;
+  Span& operator=(Span const&) = delete;
+
+ private:
+  char const* name_;
+  detail::Buffer* buffer_ = nullptr;
+  bool console_ = false;
+  uint64_t begin_ns_ = 0;
+};
+
+// call when no traced work is running, or expect a few spans to be missing
+bool SaveChromeTrace(std::string const& file);
+
+// per span name: count, total, percentiles and a log2 histogram of the
+// durations (spans under 1 us in their own bucket), then the counters
+void DumpSummary(std::ostream& os);
+
+void Reset();
+
+}  // namespace trace
@@ -61,6 +61,7 @@ Fsk Vrf(Sk<N> const& sk, uint8_t const* x) {
   G1 ga = ecc_pub.PowerG1(a);
 
   Fp12 e;
+  trace::Count(trace::kPairings);
   mcl::bn256::pairing(e, ga, detail::GetU());
   return e;
 }
@@ -106,6 +107,7 @@ bool Verify(Pk<N> const& pk, uint8_t const* x, Fsk const& fsk,
   }
 
   Fp12 e;
+  trace::Count(trace::kPairings);
   mcl::bn256::pairing(e, psk.back(), detail::GetU());
 
   ret = e == fsk;
@@ -161,6 +163,7 @@ bool VerifyWithR(Pk<N> const& pk, uint8_t const* x, Psk<N> const& psk_exp_r,
 inline void GetFskFromPskExpR(G1 const& psk_exp_r, Fr const& r, Fsk& fsk) {
   Fr inv_r = FrInv(r);
   G1 psk = psk_exp_r * inv_r;
+  trace::Count(trace::kPairings);
   mcl::bn256::pairing(fsk, psk, detail::GetU());
 }
 
@@ -270,6 +270,104 @@ bool LoadBpP1Proof(std::string const& file, h256_t const& digest,
   }
 }
 
+namespace {
+void BuildKeyBpV(uint64_t n, h256_t const& sigma_mkl_root,
+                 h256_t const& keycol_mkl_root, std::vector<Fr>& v) {
+  uint8_t seed[64];
+  memcpy(seed, sigma_mkl_root.data(), sigma_mkl_root.size());
+  memcpy(seed + 32, keycol_mkl_root.data(), keycol_mkl_root.size());
+  v.resize(n);
+  ParallelFor(0, n, [&](int64_t i) {
+    v[i] = ChainKeccak256(seed, sizeof(seed), i);
+  });
+}
+
+// Every proof gives two equations which must be zero:
+//   <v, sigma> - u[key_pos] * <v, km> - p
+//   the bp::AddP2VerifyTerms()
+// They are summed under random weights, so all of the proofs are checked by
+// one multiexp over sigma, u and the points of the proofs.
+bool VerifyKeyBpsInner(uint64_t n, uint64_t s,
+                       std::vector<std::vector<Fr> const*> const& key_m,
+                       std::vector<G1> const& sigmas,
+                       std::vector<uint64_t> const& key_pos,
+                       h256_t const& sigma_mkl_root,
+                       std::vector<h256_t> const& keycol_mkl_roots,
+                       std::vector<bp::P1Proof> const& proofs) {
+  Tick _tick_(__FUNCTION__);
+  assert(sigmas.size() == n);
+  auto count = proofs.size();
+  if (key_m.size() != count || key_pos.size() != count ||
+      keycol_mkl_roots.size() != count) {
+    assert(false);
+    return false;
+  }
+
+  auto const& ecc_pub = GetEccPub();
+  auto const& u1 = ecc_pub.u1();
+  if (s < 2 || s > u1.size()) return false;
+  auto bp_count = s - 1;
+
+  std::vector<Fr> sigma_coeff(n, FrZero());
+  std::vector<Fr> u1_coeff(s, FrZero());
+  std::vector<G1> bases;
+  std::vector<Fr> coeffs;
+  std::vector<Fr> v;
+  std::vector<Fr> g_coeff;
+  for (size_t k = 0; k < count; ++k) {
+    auto const& km = *key_m[k];
+    auto const& proof = proofs[k];
+    if (km.size() != n || key_pos[k] >= s) {
+      assert(false);
+      return false;
+    }
+
+    bp::Challenge challenge(bp_count, G1ToBin(proof.committment.p), false);
+    if (proof.p2_proof.q != proof.committment.q(challenge.u())) {
+      assert(false);
+      return false;
+    }
+
+    Fr tau = FrRand();
+    Fr rho = FrRand();
+
+    BuildKeyBpV(n, sigma_mkl_root, keycol_mkl_roots[k], v);
+    ParallelFor(0, n, [&](int64_t i) {
+      sigma_coeff[i] += tau * v[i];
+    });
+    u1_coeff[key_pos[k]] -= tau * InnerProduct(v.data(), km.data(), n);
+    bases.push_back(proof.committment.p);
+    coeffs.push_back(-tau);
+
+    if (!bp::AddP2VerifyTerms(proof.committment, proof.p2_proof, challenge,
+                              rho, g_coeff, bases, coeffs)) {
+      assert(false);
+      return false;
+    }
+    // the generators of the bp are u without u[key_pos]
+    for (uint64_t j = 0; j < bp_count; ++j) {
+      u1_coeff[j < key_pos[k] ? j : j + 1] += g_coeff[j];
+    }
+  }
+
+  auto get_g = [&sigmas, &u1, &bases, n, s](size_t i) -> G1 const& {
+    if (i < n) return sigmas[i];
+    if (i < n + s) return u1[i - n];
+    return bases[i - n - s];
+  };
+  auto get_f = [&sigma_coeff, &u1_coeff, &coeffs, n, s](size_t i) -> Fr const& {
+    if (i < n) return sigma_coeff[i];
+    if (i < n + s) return u1_coeff[i - n];
+    return coeffs[i - n - s];
+  };
+  G1 out =
+      ParallelMultiExpBdlo12Inner<G1>(get_g, get_f, n + s + bases.size());
+  bool ret = out.isZero();
+  assert(ret);
+  return ret;
+}
+}  // namespace
+
 void BuildKeyBp(uint64_t n, uint64_t s, std::vector<Fr> const& m,
                 h256_t const& sigma_mkl_root, uint64_t key_pos,
                 h256_t keycol_mkl_root, bp::P1Proof& p1_proof) {
@@ -278,23 +376,18 @@ void BuildKeyBp(uint64_t n, uint64_t s, std::vector<Fr> const& m,
   auto& ecc_pub = GetEccPub();
   auto bp_count = s - 1;
 
-  uint8_t seed[64];
-  memcpy(seed, sigma_mkl_root.data(), sigma_mkl_root.size());
-  memcpy(seed + 32, keycol_mkl_root.data(), keycol_mkl_root.size());
-  std::vector<Fr> v(n);
-  for (uint64_t i = 0; i < n; ++i) {
-    v[i] = ChainKeccak256(seed, sizeof(seed), i);
-  }
+  std::vector<Fr> v;
+  BuildKeyBpV(n, sigma_mkl_root, keycol_mkl_root, v);
 
   std::vector<Fr> mv(bp_count);
-  for (uint64_t j = 0; j < s; ++j) {
-    if (j == key_pos) continue;
-    auto jj = j < key_pos ? j : j - 1;
+  ParallelFor(0, s, [&](int64_t j) {
+    if ((uint64_t)j == key_pos) return;
+    auto jj = (uint64_t)j < key_pos ? j : j - 1;
     mv[jj] = FrZero();
     for (uint64_t i = 0; i < n; ++i) {
       mv[jj] += v[i] * m[i * s + j];
     }
-  }
+  });
 
   Fr f0 = FrZero();
   auto get_f = [&mv, &f0, bp_count](uint64_t j) -> Fr const& {
@@ -325,59 +418,47 @@ bool VerifyKeyBp(uint64_t n, uint64_t s, std::vector<Fr> const& km,
                  std::vector<G1> const& sigmas, uint64_t key_pos,
                  h256_t const& sigma_mkl_root, h256_t keycol_mkl_root,
                  bp::P1Proof const& p1_proof) {
-  assert(sigmas.size() == n);
-  assert(km.size() == n);
-
-  auto& ecc_pub = GetEccPub();
-  auto bp_count = s - 1;
+  return VerifyKeyBpsInner(n, s, {&km}, sigmas, {key_pos}, sigma_mkl_root,
+                           {keycol_mkl_root}, {p1_proof});
+}
 
-  uint8_t seed[64];
-  memcpy(seed, sigma_mkl_root.data(), sigma_mkl_root.size());
-  memcpy(seed + 32, keycol_mkl_root.data(), keycol_mkl_root.size());
-  std::vector<Fr> v(n);
-  for (uint64_t i = 0; i < n; ++i) {
-    v[i] = ChainKeccak256(seed, sizeof(seed), i);
-  }
+bool VerifyKeyBps(uint64_t n, uint64_t s,
+                  std::vector<std::vector<Fr>> const& key_m,
+                  std::vector<G1> const& sigmas,
+                  std::vector<uint64_t> const& key_pos,
+                  h256_t const& sigma_mkl_root,
+                  std::vector<h256_t> const& keycol_mkl_roots,
+                  std::vector<bp::P1Proof> const& p1_proofs) {
+  std::vector<std::vector<Fr> const*> pkey_m(key_m.size());
+  for (size_t i = 0; i < key_m.size(); ++i) pkey_m[i] = &key_m[i];
+  return VerifyKeyBpsInner(n, s, pkey_m, sigmas, key_pos, sigma_mkl_root,
+                           keycol_mkl_roots, p1_proofs);
+}
 
-  std::vector<G1> sigmas2(n);
-  for (uint64_t i = 0; i < n; ++i) {
-    G1 u_exp_mi_key = ecc_pub.PowerU1(key_pos, km[i]);
-    sigmas2[i] = sigmas[i] - u_exp_mi_key;
-  }
-  if (MultiExpBdlo12(sigmas2, v) != p1_proof.committment.p) {
+bool VerifyKeyBps(std::vector<std::string> const& files,
+                  Bulletin const& bulletin, VrfMeta const& vrf_meta,
+                  std::vector<std::vector<Fr>> const& key_m,
+                  std::vector<G1> const& sigmas) {
+  auto const& keys = vrf_meta.keys;
+  if (files.size() != keys.size()) {
     assert(false);
     return false;
   }
 
-  G1 g0 = G1Zero();
-  auto get_g = [&ecc_pub, &g0, key_pos, bp_count](uint64_t j) -> G1 const& {
-    if (j < bp_count) {
-      auto const& u = ecc_pub.u1();
-      if (j < key_pos) {
-        return u[j];
-      } else {
-        return u[j + 1];
-      }
-    } else {
-      return g0;
+  std::vector<bp::P1Proof> proofs(keys.size());
+  std::vector<uint64_t> key_pos(keys.size());
+  std::vector<h256_t> keycol_mkl_roots(keys.size());
+  for (size_t j = 0; j < keys.size(); ++j) {
+    if (!LoadBpP1Proof(files[j], keys[j].bp_digest, proofs[j])) {
+      assert(false);
+      return false;
     }
-  };
-
-  return P1Verify(p1_proof, get_g, bp_count);
-}
-
-bool VerifyKeyBp(std::string const& file, Bulletin const& bulletin,
-                 VrfMeta const& vrf_meta, uint64_t j, std::vector<Fr> const& km,
-                 std::vector<G1> const& sigmas) {
-  auto const& key = vrf_meta.keys[j];
-  bp::P1Proof proof;
-  if (!LoadBpP1Proof(file, key.bp_digest, proof)) {
-    assert(false);
-    return false;
+    key_pos[j] = keys[j].j;
+    keycol_mkl_roots[j] = keys[j].mj_mkl_root;
   }
 
-  return VerifyKeyBp(bulletin.n, bulletin.s, km, sigmas, j,
-                     bulletin.sigma_mkl_root, key.mj_mkl_root, proof);
+  return VerifyKeyBps(bulletin.n, bulletin.s, key_m, sigmas, key_pos,
+                      bulletin.sigma_mkl_root, keycol_mkl_roots, proofs);
 }
 
 bool LoadKeyM(std::string const& input, uint64_t n, bool unique,
@@ -56,9 +56,19 @@ bool VerifyKeyBp(uint64_t n, uint64_t s, std::vector<Fr> const& km,
                  h256_t const& sigma_mkl_root, h256_t keycol_mkl_root,
                  bp::P1Proof const& p1_proof);
 
-bool VerifyKeyBp(std::string const& file, Bulletin const& bulletin,
-                 VrfMeta const& vrf_meta, uint64_t j, std::vector<Fr> const& km,
-                 std::vector<G1> const& sigmas);
+// verify all of the key bps over the same sigmas together
+bool VerifyKeyBps(uint64_t n, uint64_t s,
+                  std::vector<std::vector<Fr>> const& key_m,
+                  std::vector<G1> const& sigmas,
+                  std::vector<uint64_t> const& key_pos,
+                  h256_t const& sigma_mkl_root,
+                  std::vector<h256_t> const& keycol_mkl_roots,
+                  std::vector<bp::P1Proof> const& p1_proofs);
+
+bool VerifyKeyBps(std::vector<std::string> const& files,
+                  Bulletin const& bulletin, VrfMeta const& vrf_meta,
+                  std::vector<std::vector<Fr>> const& key_m,
+                  std::vector<G1> const& sigmas);
 
 h256_t HashVrfKey(std::string const& k, vrf::Sk<> const& vrf_sk);
 
@@ -0,0 +1,28 @@
+#pragma once
+
+#include <stdint.h>
+#include <string>
+
+// the zkp keys are files <family>_<count>.pk/.vk, one keypair per circuit
+// size of the family
+
+// pod_setup generates this family, the count is the MiMC count
+char const kAtomicSwapVcZkpFamily[] = "atomic_swap_vc";
+
+inline std::string ZkpKeyName(std::string const& family, uint64_t count) {
+  return family + "_" + std::to_string(count);
+}
+
+// false if key_name is not <family>_<count>
+inline bool ParseZkpKeyName(std::string const& key_name,
+                            std::string const& family, uint64_t* count) {
+  auto prefix = family + "_";
+  if (key_name.size() <= prefix.size()) return false;
+  if (key_name.compare(0, prefix.size(), prefix)) return false;
+  auto suffix = key_name.substr(prefix.size());
+  if (suffix.size() > 18) return false;
+  if (suffix.find_first_not_of("0123456789") != std::string::npos)
+    return false;
+  *count = std::stoull(suffix);
+  return true;
+}